@@ -6,15 +6,52 @@
  */
 
 #include "src/game/game.hpp"
+#include "src/render/GameRenderer.hpp"
+#include "src/render/AssetManager.hpp"
+#include "src/render/Hud.hpp"
+#include "src/render/RedrawSignal.hpp"
+#include "src/render/FrameProfiler.hpp"
+#include "src/render/ProfilerOverlay.hpp"
 #include "src/controllers/NumericalController.hpp"
 #include "src/controllers/GestureController.hpp"
+#include "src/controllers/ControllerThread.hpp"
 #include "src/ticker/PeriodicTicker.hpp"
-#include "src/ticker/MusicalTicker.hpp"
+#include "src/ticker/MusicFile.hpp"
+#include "src/ticker/Scheduler.hpp"
+#include "src/replay/Replay.hpp"
 #include "src/UI/menu.hpp"
-#include "src/UI/Roboto_Italic_Font.hpp"
 
-// Define maximum FPS of the game
-int MAX_FPS = 30;
+// Define the rate of the simulation step (input sampling, whack resolution and expiry) in Hz. Rendering is synchronised to the display refresh separately.
+int SIMULATION_RATE = 240;
+
+// Redraw the window only when a game changes and sleep in between, instead of redrawing every display refresh, for a lower power draw
+bool RENDER_ON_CHANGE = true;
+// Longest time the render loop sleeps before polling the window for keyboard input while a keyboard player has moles to whack, in milliseconds
+int INPUT_POLL_MS = 4;
+// Longest time the render loop sleeps before polling the window while no keyboard player has a mole to whack (e.g. for Escape), in milliseconds
+int IDLE_INPUT_POLL_MS = 50;
+
+// Longest time the glove reader waits for a glove to send data before checking whether it should stop, in milliseconds
+int GLOVE_READ_TIMEOUT_MS = 250;
+
+// Define the size of the board (the numerical controller covers up to 3x3)
+int BOARD_X = 3, BOARD_Y = 3;
+
+// Define the number of stations (independent games, each with its own controller) hosted side by side in the window
+int STATIONS = 1;
+
+// Record every session to a replay log per station in the working directory (opt-in, also enabled with --record)
+bool RECORD_REPLAYS = false;
+
+// Adapt the spawn period and mole lifetime of every station to its player. With the periodic ticker, the period chosen in the menu is the slowest (easiest) spawn period and the ticker runs at the pacing period; with the musical ticker, beats are skipped while the player is struggling. Off by default so that the difficulty chosen in the menu is kept, also enabled with --adaptive.
+bool ADAPTIVE_DIFFICULTY = false;
+int PACING_PERIOD_MS = 100;
+
+// Spawn a mole on every Nth detected beat of the music
+int BEAT_DIVISOR = 1;
+
+// Minimum rate of moles for quiet passages of music, as the longest time between two spawns in milliseconds (0 to disable)
+int FLOOR_PERIOD_MS = 0;
 
 // Boolean variable indicating when the menu should be closed and game started
 bool closeMenu = false;
@@ -30,8 +67,8 @@ void startCallback(std::variant<int, GestureControllerParams> c, std::variant<in
 	closeMenu = true;
 }
 
-// Boolean variable indicating when the game has ended
-bool end_game = false;
+// Boolean variable indicating when the game has ended (set from the simulation thread)
+std::atomic_bool end_game = false;
 
 // Callback function that will be called when the game has ended
 void game_over_callback() {
@@ -39,14 +76,131 @@ void game_over_callback() {
 	std::cout << "Game over!" << std::endl;
 }
 
-int main() {
+// Struct for a station: a game with its renderer, controller and score display, drawn into its own viewport of the window
+struct Station {
+	std::unique_ptr<Game> game;
+	std::unique_ptr<GameRenderer> renderer;
+	std::unique_ptr<BaseController<int, int>> controller;
+	// Whether the controller reads its own input on a controller thread instead of GUI events
+	bool polled = false;
+	std::unique_ptr<ControllerThread> reader;
+	std::unique_ptr<ReplayWriter> recorder;
+	std::unique_ptr<DifficultyController> difficulty;
+	// Index of the station's simulation step in the scheduler
+	size_t step = 0;
+	sf::FloatRect viewport;
+	std::unique_ptr<Hud> hud;
+	// Version of the game state last drawn
+	uint64_t drawn_version = UINT64_MAX;
+};
+
+// Function to create the stations, each with its own game side by side in a target of the given size, with their renderers and score displays
+std::vector<Station> create_stations(sf::Font &font, sf::Vector2u size) {
+	std::vector<Station> stations(std::max(STATIONS, 1));
+	for (size_t s = 0; s < stations.size(); s++) {
+		Station &station = stations[s];
+		station.game = std::make_unique<Game>(BOARD_X, BOARD_Y);
+		station.game->set_game_over_callback(&game_over_callback);
+		station.renderer = std::make_unique<GameRenderer>(station.game->get_board());
+		station.viewport = sf::FloatRect((float)s / stations.size(), 0, 1.0f / stations.size(), 1);
+
+		// Display the number of moles hit, missed and total and the average response time in the top right corner of the viewport
+		station.hud = std::make_unique<Hud>(font, 24);
+		auto &v = station.viewport;
+		station.hud->set_area(sf::FloatRect(v.left * size.x, v.top * size.y, v.width * size.x, v.height * size.y));
+	}
+	return stations;
+}
+
+// Function to draw the games and the scores of every station to a target. The version is read first, so that a change made while drawing is drawn on the next frame.
+void draw_stations(sf::RenderTarget &target, std::vector<Station> &stations) {
+	target.clear();
+	for (auto &station : stations) {
+		Game &game = *station.game;
+		station.drawn_version = game.get_version();
+		station.hud->update(game.get_n_whacked(), game.get_n_missed(), game.get_n_total(), game.get_avg_whack_time());
+		station.renderer->render(&target, station.viewport);
+		station.hud->draw(target);
+	}
+}
+
+// Function to play the stations by themselves for a number of frames, drawing to an offscreen texture of the given size instead of a window, and print the time of every stage of the frames. Every frame spawns a mole and whacks a random location of every station.
+int run_offscreen(int frames, sf::Vector2u size) {
+	AssetManager assets({ 24 });
+	std::vector<Station> stations = create_stations(assets.get_font(), size);
+	sf::RenderTexture target;
+	if (!target.create(size.x, size.y)) {
+		std::cout << "Could not create an offscreen render target" << std::endl;
+		return 1;
+	}
+
+	FrameProfiler profiler(frames);
+	std::mt19937 rd(0);
+	for (int f = 0; f < frames; f++) {
+		{
+			FrameProfiler::Scope scope(profiler, FrameStage::Simulation);
+			for (auto &station : stations) {
+				station.game->make_mole();
+				station.game->whack_at(rd() % BOARD_X, rd() % BOARD_Y, Clock::system().now());
+				station.game->update();
+			}
+		}
+		{
+			FrameProfiler::Scope scope(profiler, FrameStage::Render);
+			draw_stations(target, stations);
+		}
+		{
+			FrameProfiler::Scope scope(profiler, FrameStage::Present);
+			target.display();
+		}
+		profiler.end_frame();
+	}
+
+	for (auto &station : stations)
+		station.game->stop();
+	profiler.print();
+	return 0;
+}
+
+int main(int argc, char *argv[]) {
+	// Replay a recorded session headlessly instead of playing: musicmole --replay <log> [speed, 0 for as fast as possible]
+	if (argc >= 3 && std::string(argv[1]) == "--replay") {
+		ReplayResult r = replay_session(argv[2], (argc >= 4) ? atof(argv[3]) : 0);
+		if (!r.valid) {
+			std::cout << "Not a valid replay log: " << argv[2] << std::endl;
+			return 1;
+		}
+		std::cout << "Board: " << r.header.width << "x" << r.header.height << ", seed " << r.header.seed << ", beat map hash " << std::hex << r.header.beat_hash << std::dec << std::endl;
+		std::cout << "Records: " << r.n_records << (r.complete ? "" : " (log was cut off)") << std::endl;
+		std::cout << "Recorded hit/missed/total: " << r.recorded.n_whacked << " / " << r.recorded.n_missed << " / " << r.recorded.n_total << std::endl;
+		std::cout << "Replayed hit/missed/total: " << r.replayed.n_whacked << " / " << r.replayed.n_missed << " / " << r.replayed.n_total << std::endl;
+		std::cout << "Average response time: " << r.stats.get_mean() << " ms" << std::endl;
+		std::cout << "Replay matches recording: " << (replay_matches(r) ? "yes" : "no") << std::endl;
+		return replay_matches(r) ? 0 : 1;
+	}
+
+	// Draw to an offscreen texture instead of a window to measure the cost of a frame: musicmole --offscreen <frames> [width height]
+	if (argc >= 3 && std::string(argv[1]) == "--offscreen")
+		return run_offscreen(atoi(argv[2]), (argc >= 5) ? sf::Vector2u(atoi(argv[3]), atoi(argv[4])) : sf::Vector2u(1920, 1080));
+
+	// Opt in to recording replays and adapting the difficulty: musicmole [--record] [--adaptive]
+	for (int i = 1; i < argc; i++) {
+		if (std::string(argv[i]) == "--record")
+			RECORD_REPLAYS = true;
+		else if (std::string(argv[i]) == "--adaptive")
+			ADAPTIVE_DIFFICULTY = true;
+	}
+
+	// Start loading the textures and the font (with the glyphs of the score and game over texts) while the menu is shown
+	AssetManager assets({ 24, 36 });
+
 	// Initialise SFGUI and the renderwindow
 	sfg::SFGUI sfgui;
 	sf::RenderWindow window(sf::VideoMode::getFullscreenModes()[0], "Game with menu test", sf::Style::Fullscreen);
 
-	// Get window size and set FPS limit
+	// Get window size and synchronise rendering to the display refresh
 	auto windowSize = window.getSize();
-	window.setFramerateLimit(MAX_FPS);
+	window.setVerticalSyncEnabled(true);
 
 	// Create the SFGUI desktop
 	sfg::Desktop desktop;
@@ -99,52 +253,29 @@ int main() {
 	if (!window.isOpen())
 		exit(0);
 
-	// Create the game variable and set the gameover callback
-	Game game(3, 3);
-	game.set_game_over_callback(&game_over_callback);
-
-	// Load the font
-	sf::Font font;
-	font.loadFromMemory(Roboto_Italic_ttf, Roboto_Italic_ttf_len);
-
-	// Create Text to display the number of moles hit, missed and total and the average response time
-	sf::Text hit, missed, total, hitTime;
-	hit.setFont(font);
-	hit.setFillColor(sf::Color::White);
-	hit.setCharacterSize(24);
-	hit.setString("Hit: 0");
-	missed.setFont(font);
-	missed.setFillColor(sf::Color::White);
-	missed.setCharacterSize(24);
-	missed.setString("Missed: 0");
-	total.setFont(font);
-	total.setFillColor(sf::Color::White);
-	total.setCharacterSize(24);
-	total.setString("Total: 0");
-	hitTime.setFont(font);
-	hitTime.setFillColor(sf::Color::White);
-	hitTime.setCharacterSize(24);
-	hitTime.setString("Average Response Time: -");
-
-	// Set the positions of the texts
-	auto textBounds = hit.getLocalBounds();
-	hit.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, textBounds.height/2));
-	textBounds = missed.getLocalBounds();
-	missed.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 2*textBounds.height));
-	textBounds = total.getLocalBounds();
-	total.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 3.5*textBounds.height));
-	textBounds = hitTime.getLocalBounds();
-	hitTime.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 5*textBounds.height));
-	
-	// Create the controller and ticker based on the passed parameters
-	std::unique_ptr<BaseController<int, int>> controller;
+	// Get the font, which has normally finished loading during the menu
+	sf::Font &font = assets.get_font();
+
+	// Create the stations, each with its own game side by side in the window
+	std::vector<Station> stations = create_stations(font, windowSize);
+	sf::FloatRect textBounds;
+
+	// Record the time of every stage of a frame, graphed by the overlay toggled with F3
+	FrameProfiler profiler;
+	ProfilerOverlay overlay(font, profiler);
+
+	// Create the controllers and ticker based on the passed parameters. The menu configures the controller of the first station; the other stations are played on the keyboard.
 	serialib lserial, rserial;
 	df_t lmodel, rmodel;
 	std::unique_ptr<BaseTicker> ticker;
+	std::vector<NumericalKeys> keyboards;
 
 	if (controller_params.index() == 0) {
-		// Numerical controller
-		controller = std::make_unique<NumericalController>(std::bind(&Game::whack, &game, std::placeholders::_1, std::placeholders::_2));
+		// Numerical controller, sharing the keyboard between the first two stations (numpad and number row) if there is more than one
+		if (stations.size() > 1)
+			keyboards = { NumericalKeys::Numpad, NumericalKeys::Row };
+		else
+			keyboards = { NumericalKeys::All };
 	} else if (controller_params.index() == 1) {
 		// Gesture Controller
 		GestureControllerParams p = std::get<GestureControllerParams>(controller_params);
@@ -177,106 +308,219 @@ int main() {
 		// Load gesture models
 		loadGestureModel(lmodel, p.lmodelPath);
 		loadGestureModel(rmodel, p.rmodelPath);
-		controller = std::make_unique<GestureController>(lserial, lmodel, rserial, rmodel, std::bind(&Game::whack, &game, std::placeholders::_1, std::placeholders::_2));
+		Game &game = *stations[0].game;
+		auto gestureController = std::make_unique<GestureController>(lserial, lmodel, rserial, rmodel, std::bind(&Game::whack, &game, std::placeholders::_1, std::placeholders::_2));
+		gestureController->setReadTimeout(std::chrono::milliseconds(GLOVE_READ_TIMEOUT_MS));
+		stations[0].controller = std::move(gestureController);
+		// The gesture controller reads the gloves on its own thread rather than GUI events
+		stations[0].polled = true;
+		keyboards = { NumericalKeys::All };
+	}
+
+	// Give the stations without a controller the keyboard layouts that are free. Stations beyond the number of layouts have no local controller.
+	for (size_t s = 0, k = 0; s < stations.size() && k < keyboards.size(); s++) {
+		if (stations[s].controller)
+			continue;
+		Game &game = *stations[s].game;
+		stations[s].controller = std::make_unique<NumericalController>(std::bind(&Game::whack, &game, std::placeholders::_1, std::placeholders::_2), keyboards[k++]);
 	}
 
-	if (ticker_params.index() == 0)
+	// Give every station its own difficulty controller, starting from the spawn period chosen in the menu with the periodic ticker
+	if (ADAPTIVE_DIFFICULTY) {
+		DifficultyParams params = DEFAULT_DIFFICULTY;
+		if (ticker_params.index() == 0)
+			params.max_spawn_period = std::max(params.min_spawn_period, std::chrono::milliseconds(std::get<int>(ticker_params) * 1000));
+		for (auto &station : stations) {
+			station.difficulty = std::make_unique<DifficultyController>(params);
+			station.game->set_difficulty(station.difficulty.get());
+		}
+	}
+
+	// A single ticker is shared by all the stations, so that every station gets the same moles at the same times (unless their difficulty differs)
+	if (ticker_params.index() == 0 && ADAPTIVE_DIFFICULTY)
+		// Periodic ticker pacing the spawns of every station by its own difficulty
+		ticker = std::make_unique<PeriodicTicker>(PACING_PERIOD_MS, [&stations]() {
+			for (auto &station : stations)
+				station.game->make_mole_paced();
+		});
+	else if (ticker_params.index() == 0)
 		// Periodic ticker
-		ticker = std::make_unique<PeriodicTicker>(std::get<int>(ticker_params) * 1000, std::bind(&Game::make_mole, &game));
+		ticker = std::make_unique<PeriodicTicker>(std::get<int>(ticker_params) * 1000, [&stations]() {
+			for (auto &station : stations)
+				station.game->make_mole();
+		});
 	else if (ticker_params.index() == 1) {
 		// Musical Ticker
 		MusicalTickerParams p = std::get<MusicalTickerParams>(ticker_params);
-		ticker = std::make_unique<MusicalTicker>(p.filename, std::bind(&Game::make_mole, &game), p.analysisPeriod, p.lowFreq, p.highFreq, p.threshold, p.ignorePeriod);
+		auto musicalTicker = loadMusicalTicker(p.filename, [&stations, &ticker]() {
+			auto beat = dynamic_cast<MusicalTicker&>(*ticker).getCurrentBeat();
+			for (auto &station : stations)
+				station.game->advance_plan(beat);
+		}, p.analysisPeriod, p.lowFreq, p.highFreq, p.threshold, p.ignorePeriod, p.latency);
+		// Compose the beats with the floor rate, all timed against the music on the one ticker thread
+		musicalTicker->setBeatDivisor(BEAT_DIVISOR);
+		musicalTicker->setFloorPeriod(std::chrono::milliseconds(FLOOR_PERIOD_MS));
+		// Plan the position of every mole up front from the merged ticks, so the ticker callback does not draw random numbers. Every station plays the same plan.
+		SpawnPlan plan(musicalTicker->getSchedule(), BOARD_X, BOARD_Y);
+		for (auto &station : stations)
+			station.game->set_spawn_plan(plan);
+		std::cout << "Spawn plan seed: " << plan.get_seed() << std::endl;
+		ticker = std::move(musicalTicker);
 	}
 
 	// Clean up fftw since it is not needed anymore
 	fftw_cleanup();
 
+	// Record every station to its own replay log, named after the start time of the session
+	if (RECORD_REPLAYS) {
+		auto stamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		for (size_t s = 0; s < stations.size(); s++) {
+			std::string path = "musicmole-" + std::to_string(stamp) + "-" + std::to_string(s + 1) + ".mmr";
+			stations[s].recorder = std::make_unique<ReplayWriter>(path, stations[s].game->get_replay_header());
+			if (stations[s].recorder->is_open())
+				stations[s].game->set_recorder(stations[s].recorder.get());
+			else
+				std::cout << "Could not open replay log " << path << std::endl;
+		}
+	}
+
+	// Run the simulation step of every station at a fixed rate on a shared pool of worker threads. Each station's step owns its game state: it applies the posted spawns, whacks and expiries, so whack latency is bounded by the simulation step and not by the frame rate.
+	// The simulation steps wake the render loop whenever they change a game. A step pauses itself while its game has no moles and no posted events, and is resumed by the next spawn or whack posted to the game.
+	RedrawSignal redraw_signal;
+	Scheduler simulation(std::min((unsigned)stations.size(), std::max(1u, std::thread::hardware_concurrency())));
+	for (auto &station : stations) {
+		station.step = simulation.every(std::chrono::microseconds(1000000 / SIMULATION_RATE), [&station, &redraw_signal, &profiler, &simulation]() {
+			FrameProfiler::Scope scope(profiler, FrameStage::Simulation);
+			uint64_t version = station.game->get_version();
+			station.game->update();
+			if (station.game->get_version() != version)
+				redraw_signal.notify();
+			// Check the game again after pausing, in case an event was posted before the pause took effect
+			if (station.game->is_idle()) {
+				simulation.pause(station.step);
+				if (!station.game->is_idle())
+					simulation.resume(station.step);
+			}
+		}, true);
+		station.game->set_wake_callback([&station, &simulation]() {
+			simulation.resume(station.step);
+		});
+	}
+
+	// Read the gloves of the stations with a gesture controller on their own threads, so that waiting on the serial ports and running the gesture models never holds up a simulation step. The controller is run with an empty event (it reads the gloves, not the GUI) and posts its whacks to the game's event queue.
+	for (auto &station : stations) {
+		if (!station.polled)
+			continue;
+		BaseController<int, int> *controller = station.controller.get();
+		station.reader = std::make_unique<ControllerThread>([controller, &profiler]() {
+			FrameProfiler::Scope scope(profiler, FrameStage::Gesture);
+			controller->run(sf::Event());
+		});
+	}
+
 	// Start the ticker
-	if (ticker_params.index() == 1)
-		dynamic_cast<MusicalTicker&>(*ticker).start();
-	else
-		ticker->start();
+	ticker->start();
 
 	// Guard against exceptions
 	try {
+		bool redraw = true;
 		while (window.isOpen() && !end_game && ticker->isRunning()) {
-			sf::Event event;
-			// If using a gesture controller, run it using an empty event (so that the controller updates even on framess that have no GUI event)
-			if (controller_params.index() == 1)
-				controller->run(sf::Event());
-			while (window.pollEvent(event)) {
-				// Pass GUI events to controller so that numerical controller works
-				controller->run(event);
-				if (event.type == sf::Event::KeyPressed)
-					if (event.key.code == sf::Keyboard::Escape) {
-						end_game = true;
-						// Stop ticker when exiting
-						if (ticker_params.index() == 1)
-							dynamic_cast<MusicalTicker&>(*ticker).stop();
-						else
+			// Poll the window for input
+			{
+				FrameProfiler::Scope scope(profiler, FrameStage::Input);
+				sf::Event event;
+				while (window.pollEvent(event)) {
+					// Pass GUI events to the keyboard controllers
+					for (auto &station : stations)
+						if (station.controller && !station.polled)
+							station.controller->run(event);
+					if (event.type == sf::Event::KeyPressed)
+						if (event.key.code == sf::Keyboard::Escape) {
+							end_game = true;
+							// Stop ticker when exiting
 							ticker->stop();
-						// Stop game when exiting
-						game.stop();
-						break;
+							// Stop the simulation and then the games when exiting
+							simulation.stop();
+							for (auto &station : stations)
+								station.game->stop();
+							break;
+						}
+					if (event.type == sf::Event::Closed)
+						window.close();
+					// Redraw when the window contents may have been lost
+					if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+						redraw = true;
+					// Toggle the frame profiler overlay
+					if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+						overlay.toggle();
+						redraw = true;
 					}
-				if (event.type == sf::Event::Closed)
-					window.close();
+				}
+			}
+
+			// Redraw if any game changed since it was last drawn or any mole is animating, and every frame while the profiler overlay is shown
+			for (auto &station : stations)
+				if (station.game->get_version() != station.drawn_version || station.renderer->is_animating())
+					redraw = true;
+			if (overlay.is_visible())
+				redraw = true;
+
+			if (!redraw && RENDER_ON_CHANGE) {
+				// Nothing to draw: sleep until a game changes, the next animation starts or mole vanishes, or it is time to poll the window for input. The window is polled often only while a keyboard player has moles to whack.
+				auto now = Clock::system().now();
+				auto wake = now + std::chrono::milliseconds(IDLE_INPUT_POLL_MS);
+				for (auto &station : stations) {
+					wake = std::min(wake, station.renderer->get_next_animation());
+					auto deadline = station.game->get_next_deadline();
+					if (deadline == Clock::time_point::max())
+						continue;
+					if (deadline > now)
+						wake = std::min(wake, deadline);
+					if (!station.polled)
+						wake = std::min(wake, now + std::chrono::milliseconds(INPUT_POLL_MS));
+				}
+				// Nothing was drawn, so the input polled in this iteration is not part of a frame
+				profiler.skip_frame();
+				redraw_signal.wait_for(std::chrono::duration_cast<std::chrono::microseconds>(std::max(wake - now, Clock::duration::zero())));
+				continue;
 			}
 
-			// Update the values of moles hit, missed and total
-			char h[5] = "", m[5] = "", t[5] = "", ht[15] = "";
-			itoa(game.get_n_whacked(), h, 10);
-			itoa(game.get_n_missed(), m, 10);
-			itoa(game.get_n_total(), t, 10);
-			sprintf(ht, "%0.2fms", game.get_avg_whack_time());
-			
-			// Create the strings
-			std::string hitString = "Hit: ";
-			hitString += h;
-			std::string missedString = "Missed: ";
-			missedString += m;
-			std::string totalString = "Total: ";
-			totalString += t;
-			std::string hitTimeString = "Average Response Time: ";
-			hitTimeString += ht;
-
-			//Set the strings to the SFML Texts
-			hit.setString(hitString);
-			missed.setString(missedString);
-			total.setString(totalString);
-			hitTime.setString(hitTimeString);
-			
-			// Update the positions
-			textBounds = hit.getLocalBounds();
-			hit.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, textBounds.height/2));
-			textBounds = missed.getLocalBounds();
-			missed.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 2*textBounds.height));
-			textBounds = total.getLocalBounds();
-			total.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 3.5*textBounds.height));
-			textBounds = hitTime.getLocalBounds();
-			hitTime.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 5*textBounds.height));
-
-			// Render the game and the texts
-			window.clear();
-			game.render(&window);
-			window.draw(hit);
-			window.draw(missed);
-			window.draw(total);
-			window.draw(hitTime);
-			window.display();
+			// Render the games and the scores of every station and the profiler overlay. Presenting waits for the display refresh (VSync).
+			{
+				FrameProfiler::Scope scope(profiler, FrameStage::Render);
+				draw_stations(window, stations);
+				overlay.draw(window);
+			}
+			{
+				FrameProfiler::Scope scope(profiler, FrameStage::Present);
+				window.display();
+			}
+			profiler.end_frame();
+			redraw = false;
 		}
 	} catch (std::exception e) {
 		std::cerr << "Error: " << e.what() << std::endl;
 		exit(1);
 	}
 
-	// If the loop did not exit because of game over, manually stop the game
+	// Stop reading the gloves, and the simulation so that the game states can be read from this thread
+	for (auto &station : stations)
+		if (station.reader)
+			station.reader->stop();
+	simulation.stop();
+
+	// If the loop did not exit because of game over, manually stop the games
 	if (!end_game) {
 		end_game = true;
-		game.stop();
+		for (auto &station : stations)
+			station.game->stop();
 	}
 
+	// Finish the replay logs with the final counts, flushing them off the simulation thread
+	for (auto &station : stations)
+		if (station.recorder)
+			station.recorder->finish(station.game->get_replay_footer());
+
 	// Guard against exceptions
 	try {
 		// Verify that the window is open
@@ -294,21 +538,29 @@ int main() {
 			auto start = std::chrono::high_resolution_clock::now();
 
 			// GUI and time loop
+			bool redraw = true;
 			while ((std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - start).count() < 10) && window.isOpen()) {
 				sf::Event event;
 				while (window.pollEvent(event)) {
 					if (event.type == sf::Event::Closed)
 						window.close();
+					if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+						redraw = true;
+				}
+
+				// The screen does not change, so sleep between polls of the window unless it has to be drawn again
+				if (!redraw && RENDER_ON_CHANGE) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_INPUT_POLL_MS));
+					continue;
 				}
 
 				// Draw the game over and score texts
 				window.clear();
 				window.draw(gameOver);
-				window.draw(hit);
-				window.draw(missed);
-				window.draw(total);
-				window.draw(hitTime);
+				for (auto &station : stations)
+					station.hud->draw(window);
 				window.display();
+				redraw = false;
 			}
 		}
 	} catch (std::exception e) {
@@ -316,11 +568,18 @@ int main() {
 		exit(1);
 	}
 
-	// Print out the scores to the console
-	std::cout << "Hit: " << game.get_n_whacked() << std::endl;
-	std::cout << "Missed: " << game.get_n_missed() << std::endl;
-	std::cout << "Total: " << game.get_n_total() << std::endl;
-	std::cout << "Average response time: " << game.get_avg_whack_time() << std::endl;
+	// Print out the scores of every station to the console
+	for (size_t s = 0; s < stations.size(); s++) {
+		Game &game = *stations[s].game;
+		if (stations.size() > 1)
+			std::cout << "Station " << s + 1 << ":" << std::endl;
+		std::cout << "Hit: " << game.get_n_whacked() << std::endl;
+		std::cout << "Missed: " << game.get_n_missed() << std::endl;
+		std::cout << "Total: " << game.get_n_total() << std::endl;
+		auto stats = game.get_whack_stats();
+		std::cout << "Average response time: " << stats.get_mean() << " ms (sd " << stats.get_stddev() << " ms)" << std::endl;
+		std::cout << "Response time min/p50/p90/p99/max: " << stats.get_min() << " / " << stats.get_p50() << " / " << stats.get_p90() << " / " << stats.get_p99() << " / " << stats.get_max() << " ms" << std::endl;
+	}
 
 	// Close serial devices if gesture controller was used
 	if (controller_params.index() == 1) {
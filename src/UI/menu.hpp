@@ -13,7 +13,7 @@
 #include <atomic>
 #include "../serial/availableSerial.hpp"
 #include "../ticker/PeriodicTicker.hpp"
-#include "../ticker/MusicalTicker.hpp"
+#include "../ticker/MusicFile.hpp"
 #include "../controllers/NumericalController.hpp"
 #include "modelTrainPopup.hpp"
 #include <SFGUI/SFGUI.hpp>
@@ -43,7 +43,7 @@ namespace fs = std::filesystem;
 typedef struct {
 	std::string filename;
 	double lowFreq, highFreq, threshold;
-	std::chrono::microseconds analysisPeriod, ignorePeriod;
+	std::chrono::microseconds analysisPeriod, ignorePeriod, latency;
 } MusicalTickerParams;
 
 // Struct for storing and passing the required variables for a Gesture Controller
@@ -321,6 +321,17 @@ public:
 		tickerMusicIgnoreBox->Pack(tickerMusicIgnoreMS);
 		musicalTickerBox->Pack(tickerMusicIgnoreBox);
 
+		auto tickerMusicLatencyBox = sfg::Box::Create(sfg::Box::Orientation::HORIZONTAL, 5.f);
+
+		auto tickerMusicLatencyLabel = sfg::Label::Create("Audio output latency:");
+		tickerLatencySpinButton = sfg::SpinButton::Create(0, 500, 1);
+		auto tickerMusicLatencyMS = sfg::Label::Create("ms");
+
+		tickerMusicLatencyBox->Pack(tickerMusicLatencyLabel);
+		tickerMusicLatencyBox->Pack(tickerLatencySpinButton);
+		tickerMusicLatencyBox->Pack(tickerMusicLatencyMS);
+		musicalTickerBox->Pack(tickerMusicLatencyBox);
+
 		box->Pack(periodicTickerBox);
 		box->Pack(musicalTickerBox);
 
@@ -502,6 +513,7 @@ public:
 			tp.threshold = tickerThresholdScale->GetValue();
 			tp.analysisPeriod = std::chrono::milliseconds((int)tickerAnalysisSpinButton->GetValue());
 			tp.ignorePeriod = std::chrono::milliseconds((int)tickerIgnoreSpinButton->GetValue());
+			tp.latency = std::chrono::milliseconds((int)tickerLatencySpinButton->GetValue());
 			std::variant<int, MusicalTickerParams> tickerParam = tp;
 			std::variant<int, GestureControllerParams> controllerParam = 0;
 			std::visit(this->startCallback, controllerParam, tickerParam);
@@ -528,6 +540,7 @@ public:
 			tp.threshold = tickerThresholdScale->GetValue();
 			tp.analysisPeriod = std::chrono::milliseconds((int)tickerAnalysisSpinButton->GetValue());
 			tp.ignorePeriod = std::chrono::milliseconds((int)tickerIgnoreSpinButton->GetValue());
+			tp.latency = std::chrono::milliseconds((int)tickerLatencySpinButton->GetValue());
 			std::variant<int, MusicalTickerParams> tickerParam = tp;
 			GestureControllerParams cp = GestureControllerParams{};
 			cp.lCOMport = serialComboLeft->GetSelectedText();
@@ -555,7 +568,7 @@ private:
 	sfg::Box::Ptr box, glovesBox, periodicTickerBox, musicalTickerBox;
 	sfg::ComboBox::Ptr serialComboLeft, serialComboRight, controllerDropdown, tickerDropdown, tickerMusicFileCombo, modelComboLeft, modelComboRight;
 	sf::RectangleShape background;
-	sfg::SpinButton::Ptr tickerPeriodSpinButton, tickerLowFreqSpinButton, tickerHighFreqSpinButton, tickerAnalysisSpinButton, tickerIgnoreSpinButton;
+	sfg::SpinButton::Ptr tickerPeriodSpinButton, tickerLowFreqSpinButton, tickerHighFreqSpinButton, tickerAnalysisSpinButton, tickerIgnoreSpinButton, tickerLatencySpinButton;
 	sfg::Scale::Ptr tickerThresholdScale;
 	sfg::Label::Ptr tickerMusicThresholdValue;
 	std::function<void(std::variant<int, GestureControllerParams>, std::variant<int, MusicalTickerParams>)> startCallback;
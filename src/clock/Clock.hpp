@@ -0,0 +1,127 @@
+/*
+ * Filename: Clock.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Classes implementing an injectable clock, so that game sessions can run against real time or be simulated faster than real time.
+ */
+
+#if !defined(CLOCK_HPP)
+#define CLOCK_HPP
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Base class for a clock. All timing in the game, tickers and glove interface goes through a Clock so that it can be replaced in tests and benchmarks.
+class Clock {
+public:
+	typedef std::chrono::steady_clock::time_point time_point;
+	typedef std::chrono::steady_clock::duration duration;
+
+	virtual ~Clock() {}
+
+	// Returns the current time of the clock.
+	virtual time_point now() = 0;
+
+	// Blocks until the clock reaches the given time. May return early, so callers must check the time again.
+	virtual void sleep_until(time_point t) = 0;
+
+	// Blocks on a condition variable (whose mutex is held by the lock) until it is notified or the clock reaches the given time. May return early, so callers must check the time again.
+	virtual void wait_until(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point t) = 0;
+
+	// Blocks for the given duration of clock time.
+	void sleep_for(duration d) {
+		sleep_until(now() + d);
+	}
+
+	// Returns the real-time clock shared by default.
+	static Clock& system();
+};
+
+// Clock following the real steady clock.
+class SteadyClock : public Clock {
+public:
+	time_point now() {
+		return std::chrono::steady_clock::now();
+	}
+
+	void sleep_until(time_point t) {
+		std::this_thread::sleep_until(t);
+	}
+
+	void wait_until(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point t) {
+		cv.wait_until(lock, t);
+	}
+};
+
+inline Clock& Clock::system() {
+	static SteadyClock clock;
+	return clock;
+}
+
+// Clock that runs a fixed factor faster (or slower) than real time, e.g. 1000x for simulating whole sessions with ticker threads in tests.
+class ScaledClock : public Clock {
+public:
+	// Constructor accepting the factor by which the clock runs faster than real time.
+	ScaledClock(double scale) : scale(scale) {
+		realOrigin = std::chrono::steady_clock::now();
+	}
+
+	time_point now() {
+		auto real = std::chrono::steady_clock::now() - realOrigin;
+		return realOrigin + std::chrono::duration_cast<duration>(real * scale);
+	}
+
+	void sleep_until(time_point t) {
+		auto remaining = t - now();
+		if (remaining.count() > 0)
+			std::this_thread::sleep_for(std::chrono::duration_cast<duration>(remaining / scale));
+	}
+
+	void wait_until(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point t) {
+		auto remaining = t - now();
+		if (remaining.count() > 0)
+			cv.wait_for(lock, std::chrono::duration_cast<duration>(remaining / scale));
+	}
+
+private:
+	double scale;
+	std::chrono::steady_clock::time_point realOrigin;
+};
+
+// Clock that only advances when told to, for deterministic simulation. Sleepers wake when the clock is advanced past their deadline, and wake at least every millisecond of real time so that threads can still be stopped.
+class ManualClock : public Clock {
+public:
+	time_point now() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return current;
+	}
+
+	void sleep_until(time_point t) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv.wait_for(lock, std::chrono::milliseconds(1), [&]() { return current >= t; });
+	}
+
+	// The clock cannot notify another condition variable when it is advanced, so waiters poll it every millisecond of real time.
+	void wait_until(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, time_point t) {
+		if (now() < t)
+			cv.wait_for(lock, std::chrono::milliseconds(1));
+	}
+
+	// Advances the clock by the given duration and wakes up the sleepers.
+	void advance(duration d) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			current += d;
+		}
+		m_cv.notify_all();
+	}
+
+private:
+	time_point current = std::chrono::steady_clock::now();
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+};
+
+#endif // CLOCK_HPP
\ No newline at end of file
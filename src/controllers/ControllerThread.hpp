@@ -0,0 +1,47 @@
+/*
+ * Filename: ControllerThread.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class running a polled controller on its own thread.
+ */
+
+#if !defined(CONTROLLERTHREAD_HPP)
+#define CONTROLLERTHREAD_HPP
+
+#include <thread>
+#include <atomic>
+#include <functional>
+
+// The ControllerThread class calls a polling function (e.g. running the gesture controller, which blocks while it reads the gloves over serial and runs the gesture models) in a loop on its own thread until it is stopped. The controller's callback posts whacks to the game's event queue, which is safe from any thread, so slow input never holds up the simulation step.
+class ControllerThread {
+public:
+	// Constructor accepting the polling function. Starts the thread.
+	ControllerThread(std::function<void()> poll) : poll(poll) {
+		m_thread = std::thread(&ControllerThread::m_run, this);
+	}
+
+	// Destructor stops the thread
+	~ControllerThread() {
+		stop();
+	}
+
+	// Function to stop the thread, waiting for the polling function in progress to return
+	void stop() {
+		m_running = false;
+		if (m_thread.joinable())
+			m_thread.join();
+	}
+
+private:
+	std::function<void()> poll;
+	std::thread m_thread;
+	std::atomic_bool m_running = true;
+
+	// Function run by the thread, calling the polling function until stopped
+	void m_run() {
+		while (m_running)
+			poll();
+	}
+};
+
+#endif // CONTROLLERTHREAD_HPP
\ No newline at end of file
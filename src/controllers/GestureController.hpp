@@ -19,11 +19,15 @@ public:
 	// NumericalController derived from BaseController with callback that accepts two ints that uses the serial ports and gesture models to determine the desired callback values from the hand gesture
 	GestureController(serialib& lserial, df_t& lmodel, serialib& rserial, df_t& rmodel, std::function<void(int, int)> callback) : lserial(lserial), lmodel(lmodel), rserial(rserial), rmodel(rmodel), BaseController<int, int>(callback) {}
 
-	// The run function requires an SFML event to be passed, but doesn't use it.
+	// The run function requires an SFML event to be passed, but doesn't use it. Blocks while reading the gloves, so it should be run on its own thread (see ControllerThread).
 	void run(sf::Event event) {
-		// Read the raw data from the gloves
-		auto ldata = getCurrentData(lserial);
-		auto rdata = getCurrentData(rserial);
+		// Read the raw data from the gloves, giving up if a glove sends nothing within the read timeout
+		auto ldata = getCurrentData(lserial, readTimeout);
+		if (ldata.empty())
+			return;
+		auto rdata = getCurrentData(rserial, readTimeout);
+		if (rdata.empty())
+			return;
 
 		// Convert from vector to sample type and predict the gesture using the gesture model
 		auto lpred = lmodel(convertToSampleType(std::vector<float>(ldata.begin(), ldata.end())));
@@ -33,8 +37,14 @@ public:
 		callback((int)lpred, (int)rpred);
 	}
 
+	// Sets the longest time to wait for a glove to send data, so that a thread running the controller can be stopped even if a glove goes quiet (zero to wait forever)
+	void setReadTimeout(std::chrono::milliseconds timeout) {
+		readTimeout = timeout;
+	}
+
 private:
 	serialib lserial, rserial;
+	std::chrono::milliseconds readTimeout = std::chrono::milliseconds(0);
 	df_t lmodel, rmodel;
 };
 
@@ -11,14 +11,21 @@
 #include <iostream>
 #include "BaseController.hpp"
 
+// Sets of number keys a NumericalController listens to: both the number row and the numpad, or only one of them so that two players can share a keyboard
+enum class NumericalKeys { All, Row, Numpad };
+
 // NumericalController derived from BaseController with callback that accepts two ints that uses number keys 1-9 from the keyboard to map from (1, 1) to (3, 3)
 class NumericalController : public BaseController<int, int> {
 public:
 	// NumericalController derived from BaseController with callback that accepts two ints that uses number keys 1-9 from the keyboard to map from (1, 1) to (3, 3)
-	NumericalController(std::function<void(int, int)> callback) : BaseController<int, int>(callback) {}
+	NumericalController(std::function<void(int, int)> callback, NumericalKeys keys = NumericalKeys::All) : BaseController<int, int>(callback), keys(keys) {}
 
 	// Run function accepts an SFML event and calls the desired callback based on the number key pressed.
 	void run(sf::Event event) {
+		// Ignore the keys of the other player when only listening to one set of number keys
+		if (keys != NumericalKeys::All && (event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased) && !listens(event.key.code))
+			return;
+
 		// Check if the event type is KeyReleased and if a key was previously pressed (to avoid multiple callbacks)
 		if (event.type == sf::Event::KeyReleased && keyPressed) {
 			// Set keyPressed to false to reset for next key
@@ -72,6 +79,14 @@ public:
 private:
 	bool keyPressed = false;
 	sf::Keyboard::Key pressed;
+	NumericalKeys keys;
+
+	// Function to check whether a key is one of the number keys listened to
+	bool listens(sf::Keyboard::Key key) {
+		bool row = key >= sf::Keyboard::Num0 && key <= sf::Keyboard::Num9;
+		bool numpad = key >= sf::Keyboard::Numpad0 && key <= sf::Keyboard::Numpad9;
+		return (keys != NumericalKeys::Numpad && row) || (keys != NumericalKeys::Row && numpad);
+	}
 };
 
 #endif // NumericalController_hpp
\ No newline at end of file
@@ -0,0 +1,226 @@
+/*
+ * Filename: Board.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing the flat board of the mole game.
+ */
+
+#if !defined(BOARD_HPP)
+#define BOARD_HPP
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <bitset>
+#include "../clock/Clock.hpp"
+#include "MolePool.hpp"
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+// Function to count the number of set bits in a 64 bit word. MSVC only has the 64 bit intrinsic on x64.
+inline int popcount64(uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+	return (int)__popcnt64(v);
+#elif defined(_MSC_VER)
+	return (int)std::bitset<64>(v).count();
+#else
+	return __builtin_popcountll(v);
+#endif
+}
+
+// Function to get the index of the lowest set bit of a non-zero 64 bit word. MSVC only has the 64 bit intrinsic on 64 bit targets, so 32 bit targets scan the low and then the high word.
+inline int ctz64(uint64_t v) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+	unsigned long i;
+	_BitScanForward64(&i, v);
+	return (int)i;
+#elif defined(_MSC_VER)
+	unsigned long i;
+	if (_BitScanForward(&i, (unsigned long)v))
+		return (int)i;
+	_BitScanForward(&i, (unsigned long)(v >> 32));
+	return (int)i + 32;
+#else
+	return __builtin_ctzll(v);
+#endif
+}
+
+// The Board class stores the state of every location of the board in flat arrays indexed by y * width + x. Occupancy is an atomic bitmask so that it can be read from any thread, while the moles themselves are records in a pool, referred to from their locations by generation-tagged handles and written by the thread that owns the game state. The spawn time and deadline of a mole are kept only with its location, in atomics that the renderer can read.
+// A permutation of all indices is kept with the empty locations first and the occupied locations after them, along with the position of every index in the permutation, so that picking a random empty location, checking for a full board and iterating over the moles take constant time per element.
+class Board {
+public:
+	// Constructor accepting the width (x size) and height (y size) of the board, and the size of the mole pool (the number of locations by default, since a mole record is destroyed when its mole is removed and so never outlives its location)
+	Board(int width = 3, int height = 3, size_t pool_size = 0) : width(width), height(height), words((width * height + 63) / 64), occupancy(new std::atomic<uint64_t>[(width * height + 63) / 64]), pool(pool_size ? pool_size : width * height), moles(width * height, MoleHandle{0, 0}), cells(width * height), positions(width * height), n_free(width * height), spawn_ticks(new std::atomic<Clock::duration::rep>[width * height]), deadline_ticks(new std::atomic<Clock::duration::rep>[width * height]) {
+		for (int w = 0; w < words; w++)
+			occupancy[w].store(0, std::memory_order_relaxed);
+		for (int i = 0; i < width * height; i++) {
+			cells[i] = i;
+			positions[i] = i;
+			spawn_ticks[i].store(0, std::memory_order_relaxed);
+			deadline_ticks[i].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	// Function to get the width (x size) of the board
+	int get_width() const {
+		return width;
+	}
+
+	// Function to get the height (y size) of the board
+	int get_height() const {
+		return height;
+	}
+
+	// Function to get the number of locations on the board
+	int size() const {
+		return width * height;
+	}
+
+	// Function to check whether a location x and y is on the board
+	bool contains(int x, int y) const {
+		return x >= 0 && x < width && y >= 0 && y < height;
+	}
+
+	// Function to get the index of a location x and y from [0, width-1] and [0, height-1]
+	int index(int x, int y) const {
+		return y * width + x;
+	}
+
+	// Function to check whether there is a mole at an index
+	bool is_occupied(int i) const {
+		return (occupancy[i / 64].load(std::memory_order_acquire) >> (i % 64)) & 1;
+	}
+
+	// Function to check whether there is a mole at a location x and y
+	bool is_occupied(int x, int y) const {
+		return is_occupied(index(x, y));
+	}
+
+	// Function to get the number of moles on the board by counting the occupancy bits (safe from any thread)
+	int count() const {
+		int n = 0;
+		for (int w = 0; w < words; w++)
+			n += popcount64(occupancy[w].load(std::memory_order_acquire));
+		return n;
+	}
+
+	// Function to call f(index) for every mole on the board by scanning the occupancy bits (safe from any thread). Skips 64 empty locations at a time, so the cost is dominated by the number of moles.
+	template<typename F>
+	void for_each_occupied(F f) const {
+		for (int w = 0; w < words; w++) {
+			uint64_t bits = occupancy[w].load(std::memory_order_acquire);
+			while (bits) {
+				f(w * 64 + ctz64(bits));
+				bits &= bits - 1;
+			}
+		}
+	}
+
+	// Function to get the number of 64 bit words in the occupancy bitmask
+	int get_n_words() const {
+		return words;
+	}
+
+	// Function to get a word of the occupancy bitmask, where bit b of word w is set if there is a mole at index 64 * w + b (safe from any thread)
+	uint64_t get_occupancy(int w) const {
+		return occupancy[w].load(std::memory_order_acquire);
+	}
+
+	// Function to get the number of empty locations
+	int get_n_free() const {
+		return n_free;
+	}
+
+	// Function to check whether the board is full of moles
+	bool is_full() const {
+		return n_free == 0;
+	}
+
+	// Function to get the index of the k-th empty location, for k from [0, get_n_free()-1]
+	int get_free(int k) const {
+		return cells[k];
+	}
+
+	// Function to get the number of moles on the board
+	int get_n_occupied() const {
+		return size() - n_free;
+	}
+
+	// Function to get the index of the k-th mole on the board, for k from [0, get_n_occupied()-1]
+	int get_occupied(int k) const {
+		return cells[n_free + k];
+	}
+
+	// Function to place a mole at an empty index with its spawn time and deadline. The times of the location are written before the occupancy bit is published. Returns the handle of the mole, or a handle to no mole (without placing it) if the pool is exhausted.
+	MoleHandle spawn(int i, Clock::time_point spawn_time, Clock::time_point deadline) {
+		MoleHandle h = pool.create(MoleRecord{i});
+		if (!pool.is_alive(h))
+			return h;
+		moles[i] = h;
+		spawn_ticks[i].store(spawn_time.time_since_epoch().count(), std::memory_order_relaxed);
+		deadline_ticks[i].store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+		// Move the index to the end of the empty locations and shrink them by one
+		swap_cells(positions[i], n_free - 1);
+		n_free--;
+		occupancy[i / 64].fetch_or(uint64_t(1) << (i % 64), std::memory_order_release);
+		return h;
+	}
+
+	// Function to remove the mole at an occupied index and destroy its record, so that stale handles to the mole can be detected
+	void remove(int i) {
+		occupancy[i / 64].fetch_and(~(uint64_t(1) << (i % 64)), std::memory_order_release);
+		pool.destroy(moles[i]);
+		moles[i] = MoleHandle{0, 0};
+		// Move the index to the start of the occupied locations and grow the empty locations by one
+		swap_cells(positions[i], n_free);
+		n_free++;
+	}
+
+	// Function to get the handle of the mole at an occupied index
+	MoleHandle get_mole(int i) const {
+		return moles[i];
+	}
+
+	// Function to check whether a handle refers to a mole that is still on the board
+	bool is_alive(MoleHandle h) const {
+		return pool.is_alive(h);
+	}
+
+	// Function to get the record of a live mole
+	const MoleRecord& get_record(MoleHandle h) const {
+		return pool.get(h);
+	}
+
+	// Function to get the time at which the last mole placed at an index was spawned (safe from any thread, e.g. for animating). It stays readable after the mole is removed, until the next mole is placed there.
+	Clock::time_point get_spawn_time(int i) const {
+		return Clock::time_point(Clock::duration(spawn_ticks[i].load(std::memory_order_relaxed)));
+	}
+
+	// Function to get the time at which the last mole placed at an index vanishes if not whacked (safe from any thread, e.g. for animating)
+	Clock::time_point get_deadline(int i) const {
+		return Clock::time_point(Clock::duration(deadline_ticks[i].load(std::memory_order_relaxed)));
+	}
+
+private:
+	int width, height, words;
+	std::unique_ptr<std::atomic<uint64_t>[]> occupancy;
+	MolePool pool;
+	std::vector<MoleHandle> moles;
+	std::vector<int> cells, positions;
+	std::atomic<int> n_free;
+	// Spawn times and deadlines of the last mole placed at every index, in ticks of the clock
+	std::unique_ptr<std::atomic<Clock::duration::rep>[]> spawn_ticks, deadline_ticks;
+
+	// Function to swap two positions of the permutation of indices
+	void swap_cells(int a, int b) {
+		std::swap(cells[a], cells[b]);
+		positions[cells[a]] = a;
+		positions[cells[b]] = b;
+	}
+};
+
+#endif // BOARD_HPP
\ No newline at end of file
@@ -0,0 +1,115 @@
+/*
+ * Filename: Difficulty.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing a difficulty controller that adapts the spawn period and mole lifetime to the player.
+ */
+
+#if !defined(DIFFICULTY_HPP)
+#define DIFFICULTY_HPP
+
+#include <chrono>
+#include <atomic>
+#include <algorithm>
+#include "../clock/Clock.hpp"
+
+// Struct for the parameters of the difficulty controller: the hit rate to keep the player at, the weight of the latest event in the rolling averages, how fast the difficulty level follows the hit rate, the range of spawn periods and mole lifetimes from the easiest to the hardest level, and the margin kept between the lifetime and the player's 90th percentile reaction time
+typedef struct {
+	double target_hit_rate;
+	double alpha;
+	double gain;
+	std::chrono::milliseconds min_spawn_period, max_spawn_period;
+	std::chrono::milliseconds min_lifetime, max_lifetime;
+	double reaction_margin;
+} DifficultyParams;
+
+// Default difficulty parameters: keep the player at 75% hits, with spawns from every 2 s down to every 400 ms and lifetimes from 7 s down to 1.5 s
+const DifficultyParams DEFAULT_DIFFICULTY = DifficultyParams{0.75, 0.1, 0.05, std::chrono::milliseconds(400), std::chrono::milliseconds(2000), std::chrono::milliseconds(1500), std::chrono::milliseconds(7000), 1.5};
+
+// The DifficultyController class keeps a rolling (exponentially weighted) hit rate and reaction time and a rolling estimate of the 90th percentile reaction time, updated in constant time on every whack and miss. The difficulty level moves up while the player hits more than the target rate and down while they hit less, and sets the spawn period and mole lifetime, never making the lifetime shorter than the player can react in.
+// The events are fed from the thread that owns the game state. The spawn period is also read from the ticker thread, so it is kept in an atomic.
+class DifficultyController {
+public:
+	// Constructor accepting the parameters. Starts at the easiest level.
+	DifficultyController(DifficultyParams params = DEFAULT_DIFFICULTY) : params(params) {
+		hit_rate = params.target_hit_rate;
+		update();
+	}
+
+	// Function to feed a whack with the reaction time of the player
+	void on_hit(Clock::duration reaction) {
+		double ms = std::chrono::duration<double, std::milli>(reaction).count();
+		if (n_reactions == 0) {
+			mean_reaction = ms;
+			p90_reaction = ms;
+		} else {
+			mean_reaction += params.alpha * (ms - mean_reaction);
+			// Move the percentile estimate up by 9 steps when the sample is above it and down by 1 step when it is below, which settles where 90% of the samples are below. The step follows the scale of the reaction times.
+			double step = params.alpha * mean_reaction;
+			p90_reaction += (ms > p90_reaction) ? 0.9 * step : -0.1 * step;
+		}
+		n_reactions++;
+		hit_rate += params.alpha * (1 - hit_rate);
+		update();
+	}
+
+	// Function to feed a mole that vanished without being whacked
+	void on_miss() {
+		hit_rate += params.alpha * (0 - hit_rate);
+		update();
+	}
+
+	// Function to get the difficulty level, from 0 (easiest) to 1 (hardest)
+	double get_level() {
+		return level;
+	}
+
+	// Function to get the rolling hit rate
+	double get_hit_rate() {
+		return hit_rate;
+	}
+
+	// Function to get the rolling mean reaction time in milliseconds
+	double get_mean_reaction() {
+		return mean_reaction;
+	}
+
+	// Function to get the rolling estimate of the 90th percentile reaction time in milliseconds
+	double get_p90_reaction() {
+		return p90_reaction;
+	}
+
+	// Function to get the time between spawns for the current level, from any thread
+	std::chrono::milliseconds get_spawn_period() {
+		return std::chrono::milliseconds(spawn_period.load(std::memory_order_relaxed));
+	}
+
+	// Function to get the mole lifetime for the current level, in whole milliseconds
+	std::chrono::milliseconds get_mole_lifetime() {
+		return lifetime;
+	}
+
+private:
+	DifficultyParams params;
+	double level = 0, hit_rate, mean_reaction = 0, p90_reaction = 0;
+	long long n_reactions = 0;
+	std::atomic<long long> spawn_period;
+	std::chrono::milliseconds lifetime;
+
+	// Function to move the level towards the target hit rate and compute the spawn period and lifetime for it
+	void update() {
+		level = std::clamp(level + params.gain * (hit_rate - params.target_hit_rate), 0.0, 1.0);
+
+		auto lerp = [&](std::chrono::milliseconds easy, std::chrono::milliseconds hard) {
+			return (double)easy.count() + level * (double)(hard.count() - easy.count());
+		};
+		spawn_period.store((long long)lerp(params.max_spawn_period, params.min_spawn_period), std::memory_order_relaxed);
+
+		// Keep the lifetime long enough for the player's slower reactions
+		double ms = std::max(lerp(params.max_lifetime, params.min_lifetime), params.reaction_margin * p90_reaction);
+		ms = std::clamp(ms, (double)params.min_lifetime.count(), (double)params.max_lifetime.count());
+		lifetime = std::chrono::milliseconds((long long)ms);
+	}
+};
+
+#endif // DIFFICULTY_HPP
\ No newline at end of file
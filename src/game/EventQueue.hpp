@@ -0,0 +1,93 @@
+/*
+ * Filename: EventQueue.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing a bounded lock-free queue with many producers and a single consumer.
+ */
+
+#if !defined(EVENTQUEUE_HPP)
+#define EVENTQUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// The EventQueue class is a bounded queue in a ring of cells (after Dmitry Vyukov's bounded queue). Every cell carries a sequence number that tells producers and the consumer whether it is free or full, so producers only contend on a single compare-and-swap of the tail and never block, and the single consumer does not need any atomic read-modify-write at all.
+template<typename T>
+class EventQueue {
+public:
+	// Constructor accepting the capacity, rounded up to a power of two
+	EventQueue(size_t capacity = 1024) {
+		size_t n = 1;
+		while (n < capacity)
+			n <<= 1;
+		mask = n - 1;
+		cells.reset(new Cell[n]);
+		for (size_t i = 0; i < n; i++)
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		tail.store(0, std::memory_order_relaxed);
+		head = 0;
+	}
+
+	// Function to add an item to the queue, from any thread. Returns false without blocking if the queue is full.
+	bool push(const T &item) {
+		size_t pos = tail.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell &cell = cells[pos & mask];
+			size_t seq = cell.sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+			if (diff == 0) {
+				// The cell is free for this position, so try to claim it
+				if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					cell.item = item;
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				// The cell still holds an item from one lap ago, so the queue is full
+				return false;
+			} else {
+				// Another producer claimed this position first
+				pos = tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Function to take the oldest item from the queue, from the consumer thread only. Returns false if the queue is empty.
+	bool pop(T &item) {
+		Cell &cell = cells[head & mask];
+		size_t seq = cell.sequence.load(std::memory_order_acquire);
+		if ((intptr_t)seq - (intptr_t)(head + 1) < 0)
+			return false;
+		item = cell.item;
+		// Free the cell for the producers of the next lap
+		cell.sequence.store(head + mask + 1, std::memory_order_release);
+		head++;
+		return true;
+	}
+
+	// Function to check whether the queue is empty, from the consumer thread only. An item whose push has returned is always seen.
+	bool empty() const {
+		return (intptr_t)cells[head & mask].sequence.load(std::memory_order_acquire) - (intptr_t)(head + 1) < 0;
+	}
+
+	// Function to get the capacity of the queue
+	size_t capacity() const {
+		return mask + 1;
+	}
+
+private:
+	struct Cell {
+		std::atomic<size_t> sequence;
+		T item;
+	};
+
+	std::unique_ptr<Cell[]> cells;
+	size_t mask;
+	// The tail is written by all producers and the head only by the consumer, so they are kept on separate cache lines
+	alignas(64) std::atomic<size_t> tail;
+	alignas(64) size_t head;
+};
+
+#endif // EVENTQUEUE_HPP
\ No newline at end of file
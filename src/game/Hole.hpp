@@ -1,1164 +0,0 @@
-/*
- * Filename: Hole.hpp
- * Author: Malolan Venkataraghavan
- * 
- * Array containing the data for the hole sprite
- */
-
-#if !defined(Hole_HPP)
-#define Hole_HPP
-
-unsigned char Hole_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x04, 0xe2, 0x00, 0x00, 0x04, 0xe2,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x17, 0x86, 0x4c, 0x46, 0x00, 0x00, 0x00,
-  0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e,
-  0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44,
-  0x41, 0x54, 0x78, 0x9c, 0xec, 0xdd, 0xd1, 0x55, 0x15, 0xd9, 0xb6, 0xc7,
-  0xe1, 0xb9, 0xce, 0xb8, 0xef, 0x90, 0x81, 0xdc, 0x08, 0x20, 0x03, 0x39,
-  0x11, 0xb4, 0x19, 0x48, 0x08, 0x66, 0x70, 0x0d, 0x81, 0x0c, 0x0e, 0x1d,
-  0x41, 0xd3, 0x11, 0xf4, 0x36, 0x82, 0x03, 0x11, 0x34, 0x66, 0x20, 0x11,
-  0xd4, 0x7d, 0xa8, 0xda, 0xcd, 0x16, 0x51, 0x51, 0xd9, 0xff, 0x55, 0x55,
-  0xfb, 0xfb, 0xc6, 0x60, 0xa0, 0xdd, 0x6a, 0xcf, 0x37, 0xe1, 0xd7, 0x73,
-  0xad, 0xd5, 0x86, 0x61, 0x28, 0x00, 0x00, 0x00, 0x00, 0x60, 0xbf, 0xfe,
-  0xd5, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0xc0, 0xff, 0xf4, 0x1e, 0x00, 0x00, 0x60, 0x6d, 0x5a, 0x6b,
-  0x27, 0x55, 0x75, 0xf2, 0xc2, 0x7f, 0xec, 0xf9, 0x37, 0xfe, 0xdd, 0x4d,
-  0x55, 0x7d, 0x7a, 0xe1, 0xff, 0xde, 0xcd, 0x30, 0x0c, 0x2f, 0xfd, 0x67,
-  0x02, 0x00, 0x1c, 0xb4, 0x36, 0x0c, 0x43, 0xef, 0x19, 0x00, 0x00, 0xf6,
-  0xa6, 0xb5, 0x76, 0x56, 0x55, 0xc7, 0x8f, 0xfe, 0xf1, 0x71, 0x55, 0x9d,
-  0x7d, 0xe5, 0xb7, 0x3c, 0xf5, 0xeb, 0x77, 0x7f, 0xdf, 0xe9, 0x0b, 0x8d,
-  0xb6, 0x16, 0xb7, 0xf5, 0xf5, 0x08, 0xf8, 0xa9, 0xc6, 0x48, 0xf8, 0x94,
-  0xa7, 0xe2, 0xe1, 0xa7, 0x61, 0x18, 0xbe, 0xf6, 0xeb, 0x01, 0x00, 0x16,
-  0x4f, 0x88, 0x03, 0x00, 0x66, 0xe9, 0x89, 0x80, 0xf6, 0xf8, 0xe7, 0x27,
-  0xf5, 0xe5, 0xd6, 0xd9, 0x59, 0x55, 0x1d, 0xed, 0x75, 0x30, 0xd2, 0xee,
-  0xeb, 0xcb, 0x98, 0x77, 0x37, 0x7d, 0x6c, 0x3d, 0x0e, 0x7e, 0x82, 0x1e,
-  0x00, 0x30, 0x4b, 0x42, 0x1c, 0x00, 0xb0, 0x57, 0xad, 0xb5, 0xf3, 0x9d,
-  0x9f, 0xee, 0xc6, 0xb4, 0xc7, 0x5b, 0x69, 0x22, 0x1a, 0xfb, 0xf2, 0x38,
-  0xe6, 0xed, 0x6e, 0xe3, 0x7d, 0x16, 0xf1, 0x86, 0x61, 0xd8, 0xe4, 0xc6,
-  0x02, 0x00, 0x0e, 0x8d, 0x10, 0x07, 0x00, 0x3c, 0x5b, 0x6b, 0x6d, 0x37,
-  0x9e, 0xed, 0xfe, 0xf8, 0xa4, 0x1e, 0xb6, 0xd3, 0x1c, 0xdf, 0x64, 0x2d,
-  0x76, 0x8f, 0xdd, 0xde, 0x7c, 0xed, 0xc7, 0xee, 0xd2, 0x03, 0x00, 0x9e,
-  0x4b, 0x88, 0x03, 0x00, 0x76, 0x8f, 0x81, 0xee, 0xc6, 0xb5, 0xdd, 0xed,
-  0xb5, 0xd7, 0x3d, 0xe6, 0x82, 0x85, 0xf9, 0x30, 0x7d, 0xde, 0xdd, 0xb2,
-  0xdb, 0x46, 0x3b, 0xc7, 0x65, 0x01, 0x00, 0x21, 0x0e, 0x00, 0xd6, 0x6c,
-  0xe7, 0xf5, 0xce, 0xa7, 0x02, 0x9b, 0xcd, 0x35, 0xe8, 0x63, 0xbb, 0x69,
-  0xf7, 0x54, 0xb0, 0xbb, 0x1b, 0x86, 0xe1, 0xae, 0xd3, 0x5c, 0x00, 0xc0,
-  0x9e, 0x09, 0x71, 0x00, 0xb0, 0x50, 0x3b, 0xc7, 0x44, 0x77, 0x23, 0xdb,
-  0xf9, 0xf4, 0xd9, 0x7d, 0x6b, 0xb0, 0x6c, 0xbb, 0xf7, 0xda, 0x6d, 0xa6,
-  0xcf, 0xdb, 0x58, 0xe7, 0x38, 0x2c, 0x00, 0x2c, 0x94, 0x10, 0x07, 0x00,
-  0x33, 0xb5, 0xb3, 0xcd, 0xf6, 0xd4, 0xc7, 0xab, 0x0e, 0x23, 0x01, 0xf3,
-  0xf2, 0xb1, 0x1e, 0x5e, 0x90, 0xfd, 0xec, 0xc3, 0x56, 0x1d, 0x00, 0xcc,
-  0x93, 0x10, 0x07, 0x00, 0x9d, 0x3c, 0xb1, 0xd1, 0x76, 0x52, 0x42, 0x1b,
-  0xf0, 0x72, 0x1e, 0x87, 0x3a, 0x1b, 0x75, 0x00, 0xd0, 0x99, 0x10, 0x07,
-  0x00, 0x7b, 0xb4, 0xb3, 0xd5, 0xb6, 0x0d, 0x6e, 0xe7, 0xd3, 0xbf, 0xf2,
-  0xf8, 0x01, 0xd0, 0xdb, 0xf6, 0x71, 0x89, 0x4d, 0x3d, 0xdc, 0x57, 0x67,
-  0x9b, 0x0e, 0x00, 0xf6, 0x48, 0x88, 0x03, 0x80, 0x5f, 0xb4, 0xb3, 0xd9,
-  0xb6, 0x1b, 0xdb, 0x3c, 0x84, 0x00, 0x2c, 0xd9, 0xf6, 0x41, 0x89, 0x4d,
-  0x3d, 0x44, 0x3a, 0x9b, 0x74, 0x00, 0xf0, 0x8b, 0x84, 0x38, 0x00, 0x78,
-  0xa6, 0xd6, 0xda, 0xf6, 0xf8, 0xe8, 0xee, 0x31, 0x52, 0x9b, 0x6d, 0xc0,
-  0xa1, 0xf9, 0x50, 0x9f, 0x1f, 0x77, 0xbd, 0x1b, 0x86, 0xe1, 0xe6, 0x5b,
-  0xbf, 0x01, 0x00, 0x18, 0x09, 0x71, 0x00, 0xf0, 0x48, 0x6b, 0xed, 0xbc,
-  0x1e, 0x42, 0xdb, 0xf6, 0xc7, 0xee, 0x6c, 0x03, 0xf8, 0xb6, 0xed, 0x9d,
-  0x74, 0x9b, 0x7a, 0x78, 0x34, 0x62, 0xd3, 0x6f, 0x1c, 0x00, 0x98, 0x1f,
-  0x21, 0x0e, 0x80, 0x83, 0x25, 0xb8, 0x01, 0x44, 0x08, 0x74, 0x00, 0x30,
-  0x11, 0xe2, 0x00, 0x58, 0xbd, 0x47, 0x47, 0x4a, 0xcf, 0x4b, 0x70, 0x03,
-  0x98, 0x83, 0xdd, 0x40, 0xe7, 0x88, 0x2b, 0x00, 0x07, 0x41, 0x88, 0x03,
-  0x60, 0x35, 0x1e, 0x3d, 0x9a, 0xb0, 0x8d, 0x6f, 0xee, 0x70, 0x03, 0x58,
-  0x96, 0xed, 0x1d, 0x74, 0x37, 0xe5, 0x91, 0x08, 0x00, 0x56, 0x46, 0x88,
-  0x03, 0x60, 0x91, 0x5a, 0x6b, 0x27, 0xf5, 0x10, 0xdc, 0xce, 0xcb, 0x96,
-  0x1b, 0xc0, 0x9a, 0x3d, 0xde, 0x9e, 0xbb, 0x19, 0x86, 0xe1, 0xae, 0xe3,
-  0x3c, 0x00, 0xf0, 0x53, 0x84, 0x38, 0x00, 0x66, 0xef, 0x89, 0xa3, 0xa5,
-  0x67, 0x55, 0x75, 0xd4, 0x71, 0x24, 0x00, 0xfa, 0xbb, 0xaf, 0x31, 0xca,
-  0x6d, 0xca, 0xd1, 0x56, 0x00, 0x16, 0x42, 0x88, 0x03, 0x60, 0x56, 0x76,
-  0x36, 0xdd, 0xce, 0xa7, 0xcf, 0x8e, 0x96, 0x02, 0xf0, 0x23, 0x3e, 0xd4,
-  0x4e, 0xa0, 0xb3, 0x39, 0x07, 0xc0, 0x9c, 0x08, 0x71, 0x00, 0x74, 0xf3,
-  0xc4, 0xf1, 0x52, 0x9b, 0x6e, 0x00, 0xbc, 0xb4, 0xc7, 0x9b, 0x73, 0xe2,
-  0x1c, 0x00, 0xdd, 0x08, 0x71, 0x00, 0xc4, 0xb4, 0xd6, 0xce, 0xeb, 0x21,
-  0xb8, 0x9d, 0x95, 0x3b, 0xdd, 0x00, 0xe8, 0xe3, 0x63, 0x3d, 0x3c, 0x06,
-  0xb1, 0x19, 0x86, 0x61, 0xd3, 0x77, 0x1c, 0x00, 0x0e, 0x85, 0x10, 0x07,
-  0xc0, 0x5e, 0x4c, 0xdb, 0x6e, 0xe7, 0xf5, 0xb0, 0xed, 0x76, 0xda, 0x6f,
-  0x1a, 0x00, 0xf8, 0xae, 0xdb, 0x7a, 0xd8, 0x9a, 0xdb, 0xd8, 0x9a, 0x03,
-  0x60, 0x1f, 0x84, 0x38, 0x00, 0x5e, 0xc4, 0xb4, 0xed, 0xb6, 0x8d, 0x6e,
-  0xe7, 0xe5, 0x88, 0x29, 0x00, 0xcb, 0x76, 0x5f, 0x63, 0x98, 0xdb, 0xd4,
-  0x78, 0x9c, 0x75, 0xd3, 0x73, 0x18, 0x00, 0xd6, 0x41, 0x88, 0x03, 0xe0,
-  0x87, 0xb5, 0xd6, 0x8e, 0xeb, 0xf3, 0x6d, 0x37, 0x0f, 0x2a, 0x00, 0x70,
-  0x08, 0x3e, 0xd4, 0xe7, 0x5b, 0x73, 0x9f, 0xfa, 0x8e, 0x03, 0xc0, 0xd2,
-  0x08, 0x71, 0x00, 0x7c, 0xd7, 0xa3, 0x97, 0x4c, 0xcf, 0xcb, 0x31, 0x53,
-  0x00, 0xa8, 0x7a, 0x38, 0xce, 0xba, 0x29, 0x8f, 0x40, 0x00, 0xf0, 0x0c,
-  0x42, 0x1c, 0x00, 0x5f, 0xd8, 0xb9, 0xdf, 0x6d, 0xfb, 0xe1, 0x51, 0x05,
-  0x00, 0xf8, 0xbe, 0x8f, 0xf5, 0x10, 0xe6, 0xdc, 0x33, 0x07, 0xc0, 0x17,
-  0x84, 0x38, 0x00, 0x84, 0x37, 0x00, 0xd8, 0x0f, 0x61, 0x0e, 0x80, 0xcf,
-  0x08, 0x71, 0x00, 0x07, 0x68, 0xe7, 0x8e, 0xb7, 0xed, 0x87, 0xa3, 0xa6,
-  0x00, 0xb0, 0x7f, 0xbb, 0x47, 0x59, 0xdd, 0x31, 0x07, 0x70, 0x80, 0x84,
-  0x38, 0x80, 0x03, 0x31, 0xbd, 0x6a, 0xfa, 0xa6, 0x84, 0x37, 0x00, 0x98,
-  0x8b, 0x6d, 0x98, 0xbb, 0xf6, 0x2a, 0x2b, 0xc0, 0x61, 0x10, 0xe2, 0x00,
-  0x56, 0xaa, 0xb5, 0xb6, 0xfb, 0xb8, 0xc2, 0x6f, 0x5d, 0x87, 0x01, 0x00,
-  0x9e, 0xe3, 0xcf, 0x7a, 0xd8, 0x96, 0xbb, 0xe9, 0x3c, 0x0b, 0x00, 0x7b,
-  0x20, 0xc4, 0x01, 0xac, 0xc4, 0x74, 0xdc, 0x74, 0xbb, 0xf1, 0x76, 0x5e,
-  0xee, 0x79, 0x03, 0x80, 0x25, 0xdb, 0xbd, 0x5f, 0xee, 0xda, 0x31, 0x56,
-  0x80, 0x75, 0x10, 0xe2, 0x00, 0x16, 0x6c, 0xda, 0x7a, 0x7b, 0x33, 0x7d,
-  0x38, 0x6e, 0x0a, 0x00, 0xeb, 0x75, 0x5b, 0x55, 0xd7, 0x35, 0x46, 0x39,
-  0xdb, 0x72, 0x00, 0x0b, 0x25, 0xc4, 0x01, 0x2c, 0xc8, 0xce, 0x23, 0x0b,
-  0xdb, 0xf8, 0x76, 0xd4, 0x75, 0x20, 0x00, 0xa0, 0x87, 0xfb, 0x9a, 0xa2,
-  0x5c, 0x79, 0xf4, 0x01, 0x60, 0x51, 0x84, 0x38, 0x80, 0x99, 0x6b, 0xad,
-  0x9d, 0xd4, 0x43, 0x78, 0x7b, 0xdd, 0x75, 0x18, 0x00, 0x60, 0x8e, 0x3e,
-  0xd4, 0xc3, 0xb6, 0xdc, 0x5d, 0xe7, 0x59, 0x00, 0xf8, 0x06, 0x21, 0x0e,
-  0x60, 0x86, 0xa6, 0x23, 0xa7, 0x17, 0x35, 0xc6, 0x37, 0x77, 0xbd, 0x01,
-  0x00, 0xcf, 0xf5, 0xb1, 0xc6, 0x28, 0x77, 0xe5, 0x08, 0x2b, 0xc0, 0xfc,
-  0x08, 0x71, 0x00, 0x33, 0xd1, 0x5a, 0xdb, 0x6e, 0xbd, 0x39, 0x72, 0x0a,
-  0x00, 0xbc, 0x84, 0x7f, 0x8e, 0xb0, 0x0e, 0xc3, 0x70, 0xdd, 0x7b, 0x18,
-  0x00, 0x84, 0x38, 0x80, 0x6e, 0x76, 0x5e, 0x39, 0x7d, 0x53, 0x55, 0xbf,
-  0x75, 0x1e, 0x07, 0x00, 0x58, 0xbf, 0x3f, 0xeb, 0x21, 0xcc, 0xb9, 0x57,
-  0x0e, 0xa0, 0x03, 0x21, 0x0e, 0x20, 0x48, 0x7c, 0x03, 0x00, 0x66, 0x42,
-  0x94, 0x03, 0xe8, 0x40, 0x88, 0x03, 0xd8, 0x33, 0xf1, 0x0d, 0x00, 0x98,
-  0x39, 0x51, 0x0e, 0x20, 0x44, 0x88, 0x03, 0xd8, 0x03, 0xf1, 0x0d, 0x00,
-  0x58, 0x28, 0x51, 0x0e, 0x60, 0x8f, 0x84, 0x38, 0x80, 0x17, 0x22, 0xbe,
-  0x01, 0x00, 0x2b, 0x23, 0xca, 0x01, 0xbc, 0x30, 0x21, 0x0e, 0xe0, 0x17,
-  0xb5, 0xd6, 0x2e, 0x4a, 0x7c, 0x03, 0x00, 0xd6, 0xed, 0xcf, 0x1a, 0x83,
-  0xdc, 0x55, 0xef, 0x41, 0x00, 0x96, 0x4c, 0x88, 0x03, 0xf8, 0x09, 0xad,
-  0xb5, 0xed, 0xe6, 0xdb, 0x9b, 0xaa, 0x3a, 0xea, 0x3c, 0x0e, 0x00, 0x40,
-  0xca, 0x7d, 0x3d, 0x6c, 0xc9, 0x5d, 0xf7, 0x1e, 0x06, 0x60, 0x69, 0x84,
-  0x38, 0x80, 0x67, 0x6a, 0xad, 0x9d, 0x55, 0xd5, 0x45, 0x8d, 0xf1, 0xed,
-  0x55, 0xdf, 0x69, 0x00, 0x00, 0xba, 0xfb, 0x58, 0x63, 0x94, 0xbb, 0x1a,
-  0x86, 0xe1, 0xa6, 0xf7, 0x30, 0x00, 0x4b, 0x20, 0xc4, 0x01, 0x7c, 0xc3,
-  0x74, 0xef, 0xdb, 0xc5, 0xf4, 0x71, 0xda, 0x75, 0x18, 0x00, 0x80, 0xf9,
-  0xba, 0xad, 0xaa, 0xab, 0x1a, 0xa3, 0x9c, 0xfb, 0xe4, 0x00, 0xbe, 0x42,
-  0x88, 0x03, 0x78, 0xc2, 0x74, 0xf4, 0xf4, 0xa2, 0xdc, 0xfb, 0x06, 0x00,
-  0xf0, 0xa3, 0xfe, 0xac, 0x31, 0xc8, 0x39, 0xba, 0x0a, 0xf0, 0x88, 0x10,
-  0x07, 0x30, 0x69, 0xad, 0x9d, 0x54, 0xd5, 0xbb, 0x1a, 0x03, 0x9c, 0x7b,
-  0xdf, 0x00, 0x00, 0x7e, 0xcd, 0x7d, 0x8d, 0x5b, 0x72, 0x97, 0xc3, 0x30,
-  0xdc, 0xf5, 0x1d, 0x05, 0x60, 0x1e, 0x84, 0x38, 0xe0, 0xa0, 0x4d, 0x47,
-  0x4f, 0xdf, 0xd4, 0x18, 0xe0, 0x1c, 0x3d, 0x05, 0x00, 0xd8, 0x8f, 0xdb,
-  0xaa, 0xba, 0xac, 0xf1, 0x91, 0x07, 0x47, 0x57, 0x81, 0x83, 0x25, 0xc4,
-  0x01, 0x07, 0x69, 0x7a, 0x78, 0xe1, 0x5d, 0x79, 0xf5, 0x14, 0x00, 0x20,
-  0x69, 0xfb, 0xea, 0xea, 0xa5, 0x07, 0x1e, 0x80, 0x43, 0x24, 0xc4, 0x01,
-  0x07, 0xa5, 0xb5, 0x76, 0x51, 0xb6, 0xdf, 0x00, 0x00, 0xe6, 0xe0, 0xb6,
-  0xc6, 0x20, 0x77, 0xd5, 0x7b, 0x10, 0x80, 0x14, 0x21, 0x0e, 0x58, 0x3d,
-  0x77, 0xbf, 0x01, 0x00, 0xcc, 0x9a, 0xbb, 0xe4, 0x80, 0x83, 0x21, 0xc4,
-  0x01, 0xab, 0x35, 0xbd, 0x7c, 0xfa, 0xae, 0xaa, 0x5e, 0xf7, 0x9e, 0x05,
-  0x00, 0x80, 0x67, 0xf9, 0x50, 0x63, 0x90, 0xf3, 0xe2, 0x2a, 0xb0, 0x4a,
-  0x42, 0x1c, 0xb0, 0x2a, 0xd3, 0xe3, 0x0b, 0x17, 0x35, 0x06, 0xb8, 0x57,
-  0x7d, 0xa7, 0x01, 0x00, 0xe0, 0x27, 0x7d, 0xac, 0xf1, 0x71, 0x87, 0x2b,
-  0x8f, 0x3b, 0x00, 0x6b, 0x22, 0xc4, 0x01, 0xab, 0x30, 0x1d, 0x3f, 0x7d,
-  0x5f, 0x1e, 0x5f, 0x00, 0x00, 0x58, 0x93, 0xed, 0xe3, 0x0e, 0xef, 0x1d,
-  0x5b, 0x05, 0xd6, 0x40, 0x88, 0x03, 0x16, 0xad, 0xb5, 0x76, 0x5e, 0xe3,
-  0xf6, 0xdb, 0x6f, 0x9d, 0x47, 0x01, 0x00, 0x60, 0xbf, 0xfe, 0xac, 0xf1,
-  0xd8, 0xea, 0xa6, 0xf7, 0x20, 0x00, 0x3f, 0x4b, 0x88, 0x03, 0x16, 0xc9,
-  0xeb, 0xa7, 0x00, 0x00, 0x07, 0xcb, 0x6b, 0xab, 0xc0, 0x62, 0x09, 0x71,
-  0xc0, 0x62, 0xb8, 0xff, 0x0d, 0x00, 0x80, 0x1d, 0xee, 0x91, 0x03, 0x16,
-  0x47, 0x88, 0x03, 0x66, 0x6f, 0x0a, 0x70, 0xef, 0xa6, 0x0f, 0xf7, 0xbf,
-  0x01, 0x00, 0xb0, 0xeb, 0xbe, 0xc6, 0x20, 0x77, 0x29, 0xc8, 0x01, 0x73,
-  0x27, 0xc4, 0x01, 0xb3, 0x35, 0x3d, 0xc0, 0xf0, 0xae, 0xc6, 0x2d, 0x38,
-  0x01, 0x0e, 0x00, 0x80, 0x6f, 0xb9, 0xaf, 0xaa, 0xab, 0x1a, 0x83, 0xdc,
-  0x5d, 0xdf, 0x51, 0x00, 0x9e, 0x26, 0xc4, 0x01, 0xb3, 0xb3, 0xf3, 0x02,
-  0xea, 0xdb, 0xae, 0x83, 0x00, 0x00, 0xb0, 0x54, 0xbf, 0x97, 0x97, 0x56,
-  0x81, 0x19, 0x12, 0xe2, 0x80, 0xd9, 0x10, 0xe0, 0x00, 0x00, 0x78, 0x61,
-  0x82, 0x1c, 0x30, 0x2b, 0x42, 0x1c, 0xd0, 0x9d, 0x00, 0x07, 0x00, 0xc0,
-  0x9e, 0x09, 0x72, 0xc0, 0x2c, 0x08, 0x71, 0x40, 0x37, 0x02, 0x1c, 0x00,
-  0x00, 0x61, 0x82, 0x1c, 0xd0, 0x95, 0x10, 0x07, 0xc4, 0x09, 0x70, 0x00,
-  0x00, 0x74, 0x26, 0xc8, 0x01, 0x5d, 0x08, 0x71, 0x40, 0x4c, 0x6b, 0xed,
-  0xb8, 0xc6, 0x57, 0x50, 0xff, 0xaf, 0xf7, 0x2c, 0x00, 0x00, 0x1c, 0xbc,
-  0xfb, 0xaa, 0xba, 0xac, 0xf1, 0x95, 0xd5, 0x4f, 0xbd, 0x87, 0x01, 0x0e,
-  0x83, 0x10, 0x07, 0xec, 0xdd, 0x4e, 0x80, 0x7b, 0x57, 0x55, 0x47, 0x9d,
-  0xc7, 0x01, 0x00, 0x80, 0x5d, 0x82, 0x1c, 0x10, 0x23, 0xc4, 0x01, 0x7b,
-  0xd5, 0x5a, 0xbb, 0xa8, 0xf1, 0x18, 0xea, 0xab, 0xbe, 0x93, 0x00, 0x00,
-  0xc0, 0x37, 0x7d, 0xac, 0xf1, 0xb8, 0xea, 0x55, 0xef, 0x41, 0x80, 0xf5,
-  0x12, 0xe2, 0x80, 0xbd, 0x68, 0xad, 0x9d, 0x57, 0xd5, 0x55, 0x09, 0x70,
-  0x00, 0x00, 0x2c, 0xcb, 0x6d, 0x55, 0xbd, 0x1b, 0x86, 0x61, 0xd3, 0x7b,
-  0x10, 0x60, 0x7d, 0x84, 0x38, 0xe0, 0x45, 0x4d, 0x0f, 0x31, 0x5c, 0x55,
-  0xd5, 0xeb, 0xae, 0x83, 0x00, 0x00, 0xc0, 0xaf, 0xf9, 0x50, 0x55, 0x17,
-  0x1e, 0x74, 0x00, 0x5e, 0xd2, 0xbf, 0x7a, 0x0f, 0x00, 0xac, 0x43, 0x6b,
-  0xed, 0xb8, 0xb5, 0x76, 0x59, 0x55, 0x7f, 0x97, 0x08, 0x07, 0x00, 0xc0,
-  0xf2, 0xbd, 0xae, 0xaa, 0xbf, 0x5b, 0x6b, 0x97, 0xd3, 0x9d, 0xc7, 0x00,
-  0xbf, 0xcc, 0x46, 0x1c, 0xf0, 0xcb, 0x5a, 0x6b, 0xef, 0x6a, 0xbc, 0x07,
-  0xce, 0x43, 0x0c, 0x00, 0x00, 0xac, 0xd1, 0x7d, 0x8d, 0xc7, 0x55, 0xaf,
-  0x7a, 0x0f, 0x02, 0x2c, 0x9b, 0x10, 0x07, 0xfc, 0xb4, 0xe9, 0x1e, 0xb8,
-  0xcb, 0xaa, 0x3a, 0xed, 0x3c, 0x0a, 0x00, 0x00, 0x24, 0xb8, 0x3f, 0x0e,
-  0xf8, 0x25, 0x42, 0x1c, 0xf0, 0xc3, 0xa6, 0xd5, 0xfc, 0xcb, 0xaa, 0x7a,
-  0xdb, 0x7b, 0x16, 0x00, 0x00, 0xe8, 0xe0, 0xf7, 0x1a, 0x83, 0xdc, 0xa7,
-  0xde, 0x83, 0x00, 0xcb, 0xe2, 0x8e, 0x38, 0xe0, 0x87, 0xb4, 0xd6, 0x2e,
-  0xaa, 0xea, 0xae, 0x44, 0x38, 0x00, 0x00, 0x0e, 0xd7, 0xdb, 0xaa, 0xba,
-  0x9b, 0xbe, 0x36, 0x06, 0x78, 0x36, 0x1b, 0x71, 0xc0, 0xb3, 0x78, 0x0d,
-  0x15, 0x00, 0x00, 0x9e, 0xe4, 0x75, 0x55, 0xe0, 0xd9, 0x6c, 0xc4, 0x01,
-  0xdf, 0xd5, 0x5a, 0x7b, 0x5f, 0x5e, 0x43, 0x05, 0x00, 0x80, 0xa7, 0x6c,
-  0x5f, 0x57, 0x7d, 0xdf, 0x7b, 0x10, 0x60, 0xfe, 0x6c, 0xc4, 0x01, 0x5f,
-  0xd5, 0x5a, 0x3b, 0xab, 0x71, 0x0b, 0xce, 0x63, 0x0c, 0x00, 0x00, 0xf0,
-  0x7d, 0xb7, 0x35, 0x6e, 0xc7, 0xdd, 0xf4, 0x1e, 0x04, 0x98, 0x27, 0x1b,
-  0x71, 0xc0, 0x93, 0xa6, 0xff, 0xa3, 0xf7, 0xdf, 0x12, 0xe1, 0x00, 0x00,
-  0xe0, 0xb9, 0x4e, 0xab, 0xea, 0xbf, 0xb6, 0xe3, 0x80, 0xaf, 0xb1, 0x11,
-  0x07, 0x7c, 0xc6, 0x16, 0x1c, 0x00, 0x00, 0xbc, 0x08, 0xdb, 0x71, 0xc0,
-  0x17, 0x6c, 0xc4, 0x01, 0xff, 0xb0, 0x05, 0x07, 0x00, 0x00, 0x2f, 0xc6,
-  0x76, 0x1c, 0xf0, 0x05, 0x1b, 0x71, 0x80, 0x17, 0x51, 0x01, 0x00, 0x60,
-  0xbf, 0xbc, 0xac, 0x0a, 0x54, 0x95, 0x8d, 0x38, 0x38, 0x78, 0xad, 0xb5,
-  0x37, 0x55, 0x75, 0x53, 0x22, 0x1c, 0x00, 0x00, 0xec, 0xcb, 0xeb, 0xaa,
-  0xba, 0x99, 0xbe, 0xf6, 0x06, 0x0e, 0x98, 0x10, 0x07, 0x07, 0xaa, 0xb5,
-  0x76, 0xdc, 0x5a, 0xbb, 0xaa, 0xaa, 0x3f, 0xaa, 0xea, 0xa8, 0xf3, 0x38,
-  0x00, 0x00, 0xb0, 0x76, 0x47, 0x55, 0xf5, 0x47, 0x6b, 0xed, 0xaa, 0xb5,
-  0x76, 0xdc, 0x7b, 0x18, 0xa0, 0x0f, 0x47, 0x53, 0xe1, 0x00, 0x79, 0x90,
-  0x01, 0x00, 0x00, 0xba, 0xf2, 0x90, 0x03, 0x1c, 0x28, 0x1b, 0x71, 0x70,
-  0x60, 0x5a, 0x6b, 0x17, 0x55, 0xb5, 0x29, 0x11, 0x0e, 0x00, 0x00, 0x7a,
-  0x39, 0xad, 0xaa, 0xcd, 0xf4, 0xb5, 0x39, 0x70, 0x40, 0x6c, 0xc4, 0xc1,
-  0x81, 0x98, 0xd6, 0xdf, 0x2f, 0xab, 0xea, 0x6d, 0xef, 0x59, 0x00, 0x00,
-  0x80, 0x7f, 0xfc, 0x3e, 0x0c, 0xc3, 0x45, 0xef, 0x21, 0x80, 0x0c, 0x21,
-  0x0e, 0x0e, 0xc0, 0xf4, 0x2a, 0xea, 0x75, 0xd9, 0x82, 0x03, 0x00, 0x80,
-  0x39, 0xba, 0xad, 0xaa, 0x37, 0x5e, 0x55, 0x85, 0xf5, 0x73, 0x34, 0x15,
-  0x56, 0xae, 0xb5, 0x76, 0x5e, 0xe3, 0xab, 0xa8, 0x22, 0x1c, 0x00, 0x00,
-  0xcc, 0xd3, 0x69, 0x8d, 0xaf, 0xaa, 0x9e, 0xf7, 0x1e, 0x04, 0xd8, 0x2f,
-  0x21, 0x0e, 0x56, 0x6c, 0xba, 0x73, 0xe2, 0xaf, 0xf2, 0x2a, 0x2a, 0x00,
-  0x00, 0xcc, 0xdd, 0x51, 0x55, 0xfd, 0xe5, 0xde, 0x38, 0x58, 0x37, 0x47,
-  0x53, 0x61, 0xa5, 0x5a, 0x6b, 0x57, 0xe5, 0x3e, 0x38, 0x00, 0x00, 0x58,
-  0x22, 0xf7, 0xc6, 0xc1, 0x4a, 0x09, 0x71, 0xb0, 0x32, 0xd3, 0xa3, 0x0c,
-  0xd7, 0x55, 0xf5, 0xba, 0xf7, 0x2c, 0x00, 0x00, 0xc0, 0x4f, 0xfb, 0x50,
-  0xe3, 0xbd, 0x71, 0x9f, 0x7a, 0x0f, 0x02, 0xbc, 0x1c, 0x21, 0x0e, 0x56,
-  0x64, 0x8a, 0x70, 0x9b, 0x72, 0x1f, 0x1c, 0x00, 0x00, 0xac, 0xc1, 0x6d,
-  0x55, 0x9d, 0x8b, 0x71, 0xb0, 0x1e, 0xee, 0x88, 0x83, 0x95, 0x68, 0xad,
-  0x9d, 0x55, 0xd5, 0x5d, 0x89, 0x70, 0x00, 0x00, 0xb0, 0x16, 0xa7, 0x55,
-  0x75, 0x37, 0x7d, 0xad, 0x0f, 0xac, 0x80, 0x10, 0x07, 0x2b, 0x30, 0xfd,
-  0xc5, 0xbc, 0x29, 0x8f, 0x32, 0x00, 0x00, 0xc0, 0xda, 0x1c, 0x55, 0xd5,
-  0x46, 0x8c, 0x83, 0x75, 0x10, 0xe2, 0x60, 0xe1, 0x5a, 0x6b, 0x6f, 0x4a,
-  0x84, 0x03, 0x00, 0x80, 0x35, 0xdb, 0xc6, 0xb8, 0x37, 0xbd, 0x07, 0x01,
-  0x7e, 0x8d, 0x10, 0x07, 0x0b, 0x36, 0x3d, 0x6d, 0xfe, 0x47, 0x89, 0x70,
-  0x00, 0x00, 0xb0, 0x76, 0x47, 0x55, 0xf5, 0xc7, 0xf4, 0x3d, 0x00, 0xb0,
-  0x50, 0x42, 0x1c, 0x2c, 0xd4, 0xf4, 0x17, 0xf0, 0x7f, 0x7a, 0xcf, 0x01,
-  0x00, 0x00, 0x44, 0xfd, 0x47, 0x8c, 0x83, 0xe5, 0x12, 0xe2, 0x60, 0x81,
-  0x44, 0x38, 0x00, 0x00, 0x38, 0x68, 0x62, 0x1c, 0x2c, 0x94, 0x10, 0x07,
-  0x0b, 0x23, 0xc2, 0x01, 0x00, 0x00, 0x25, 0xc6, 0xc1, 0x22, 0x09, 0x71,
-  0xb0, 0x20, 0x22, 0x1c, 0x00, 0x00, 0xb0, 0x43, 0x8c, 0x83, 0x85, 0x69,
-  0xc3, 0x30, 0xf4, 0x9e, 0x01, 0x78, 0x86, 0xd6, 0xda, 0x79, 0x55, 0xfd,
-  0xd5, 0x7b, 0x0e, 0x00, 0x00, 0x60, 0x76, 0xfe, 0x3d, 0x0c, 0xc3, 0xa6,
-  0xf7, 0x10, 0xc0, 0xf7, 0xd9, 0x88, 0x83, 0x05, 0x68, 0xad, 0x9d, 0x55,
-  0xd5, 0x75, 0xef, 0x39, 0x00, 0x00, 0x80, 0x59, 0xba, 0x9e, 0xbe, 0x67,
-  0x00, 0x66, 0x4e, 0x88, 0x83, 0x99, 0x9b, 0xfe, 0x42, 0xdd, 0xd4, 0xf8,
-  0x5c, 0x39, 0x00, 0x00, 0xc0, 0x63, 0x47, 0x55, 0xb5, 0x11, 0xe3, 0x60,
-  0xfe, 0x1c, 0x4d, 0x85, 0x19, 0x6b, 0xad, 0x1d, 0x57, 0xd5, 0x4d, 0x55,
-  0xbd, 0xea, 0x3d, 0x0b, 0x00, 0x00, 0x30, 0x7b, 0x1f, 0xab, 0xea, 0x6c,
-  0x18, 0x86, 0x4f, 0xbd, 0x07, 0x01, 0x9e, 0x66, 0x23, 0x0e, 0x66, 0x6a,
-  0x8a, 0x70, 0x9b, 0x12, 0xe1, 0x00, 0x00, 0x80, 0xe7, 0x79, 0x55, 0xe3,
-  0x66, 0xdc, 0x71, 0xef, 0x41, 0x80, 0xa7, 0x09, 0x71, 0x30, 0x5f, 0x97,
-  0x55, 0x75, 0xda, 0x7b, 0x08, 0x00, 0x00, 0x60, 0x51, 0x4e, 0x6b, 0xfc,
-  0x5e, 0x02, 0x98, 0x21, 0x21, 0x0e, 0x66, 0xa8, 0xb5, 0xf6, 0xbe, 0xaa,
-  0xde, 0xf6, 0x9e, 0x03, 0x00, 0x00, 0x58, 0xa4, 0xb7, 0xd3, 0xf7, 0x14,
-  0xc0, 0xcc, 0xb8, 0x23, 0x0e, 0x66, 0xa6, 0xb5, 0x76, 0x5e, 0x55, 0x7f,
-  0xf5, 0x9e, 0x03, 0x00, 0x00, 0x58, 0xbc, 0x7f, 0x0f, 0xc3, 0xb0, 0xe9,
-  0x3d, 0x04, 0xf0, 0x40, 0x88, 0x83, 0x19, 0x69, 0xad, 0x9d, 0xd4, 0xf8,
-  0x38, 0x83, 0x17, 0x52, 0x01, 0x00, 0x80, 0x5f, 0x75, 0x5f, 0xe3, 0xe3,
-  0x0d, 0x77, 0xbd, 0x07, 0x01, 0x46, 0x8e, 0xa6, 0xc2, 0xbc, 0x5c, 0x97,
-  0x08, 0x07, 0x00, 0x00, 0xbc, 0x8c, 0xa3, 0x1a, 0xbf, 0xc7, 0x00, 0x66,
-  0x42, 0x88, 0x83, 0x99, 0x68, 0xad, 0x79, 0x9c, 0x01, 0x00, 0x00, 0x78,
-  0x69, 0xa7, 0xd3, 0xf7, 0x1a, 0xc0, 0x0c, 0x38, 0x9a, 0x0a, 0x33, 0xe0,
-  0x5e, 0x38, 0x00, 0x00, 0x60, 0xcf, 0xdc, 0x17, 0x07, 0x33, 0x20, 0xc4,
-  0x41, 0x67, 0xad, 0xb5, 0xe3, 0x1a, 0xef, 0x85, 0x7b, 0xd5, 0x7b, 0x16,
-  0x00, 0x00, 0x60, 0xb5, 0x3e, 0xd6, 0x78, 0x5f, 0xdc, 0xa7, 0xde, 0x83,
-  0xc0, 0x21, 0x73, 0x34, 0x15, 0xfa, 0x7b, 0x5f, 0x22, 0x1c, 0x00, 0x00,
-  0xb0, 0x5f, 0xaf, 0x6a, 0xfc, 0xde, 0x03, 0xe8, 0xc8, 0x46, 0x1c, 0x74,
-  0xe4, 0x48, 0x2a, 0x00, 0x00, 0x10, 0xe6, 0x88, 0x2a, 0x74, 0x24, 0xc4,
-  0x41, 0x27, 0x8e, 0xa4, 0x02, 0x00, 0x00, 0x1d, 0x38, 0xa2, 0x0a, 0x1d,
-  0x39, 0x9a, 0x0a, 0xfd, 0xbc, 0x2b, 0x11, 0x0e, 0x00, 0x00, 0xc8, 0x7a,
-  0x55, 0xe3, 0xf7, 0x22, 0x40, 0x07, 0x36, 0xe2, 0xa0, 0x83, 0xd6, 0xda,
-  0x49, 0x55, 0xfd, 0xdd, 0x79, 0x0c, 0x00, 0x00, 0xe0, 0x70, 0xfd, 0xef,
-  0x30, 0x0c, 0x77, 0xbd, 0x87, 0xe0, 0xff, 0xdb, 0xbb, 0xd7, 0xe3, 0x28,
-  0xb2, 0x24, 0x00, 0xa3, 0x79, 0xd7, 0x01, 0xb4, 0x16, 0x8c, 0xc6, 0x02,
-  0xe4, 0x01, 0xf2, 0x60, 0xe5, 0xc1, 0x08, 0x0f, 0x58, 0x0f, 0xc0, 0x03,
-  0xc6, 0x03, 0xe1, 0x01, 0x78, 0xd0, 0x78, 0x20, 0x59, 0x30, 0x92, 0x05,
-  0x2b, 0x59, 0x70, 0xf7, 0x47, 0x57, 0x8f, 0x5a, 0x0c, 0x0f, 0x3d, 0xba,
-  0x32, 0xeb, 0x71, 0x4e, 0x84, 0x42, 0x40, 0xc4, 0x4c, 0xe4, 0x1f, 0xa2,
-  0xa9, 0x4f, 0x79, 0xeb, 0xb2, 0x36, 0x36, 0xe2, 0xa0, 0xc6, 0xc7, 0xea,
-  0x01, 0x00, 0x00, 0x80, 0x55, 0xf3, 0x4c, 0x02, 0x05, 0x6c, 0xc4, 0x41,
-  0x32, 0x17, 0x34, 0x00, 0x00, 0x00, 0x13, 0xe1, 0xe2, 0x06, 0x48, 0x66,
-  0x23, 0x0e, 0xf2, 0xbd, 0xaf, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x3c, 0x9b,
-  0x40, 0x3a, 0x21, 0x0e, 0x12, 0x0d, 0xdb, 0x70, 0x6f, 0xaa, 0xe7, 0x00,
-  0x00, 0x00, 0x88, 0x88, 0x37, 0xc3, 0x33, 0x0a, 0x90, 0x44, 0x88, 0x83,
-  0x5c, 0xef, 0xab, 0x07, 0x00, 0x00, 0x00, 0xd8, 0xf3, 0xbe, 0x7a, 0x00,
-  0x58, 0x13, 0x21, 0x0e, 0x92, 0xd8, 0x86, 0x03, 0x00, 0x00, 0x26, 0xc8,
-  0x56, 0x1c, 0x24, 0x12, 0xe2, 0x20, 0xcf, 0xbb, 0xea, 0x01, 0x00, 0x00,
-  0x00, 0xbe, 0xc3, 0xb3, 0x0a, 0x24, 0x71, 0x6b, 0x2a, 0x24, 0x68, 0xad,
-  0x1d, 0x47, 0xc4, 0x5f, 0xc5, 0x63, 0x00, 0x00, 0x00, 0xfc, 0xc8, 0xef,
-  0xbd, 0xf7, 0xeb, 0xea, 0x21, 0x60, 0xe9, 0x6c, 0xc4, 0x41, 0x0e, 0x3f,
-  0x61, 0x02, 0x00, 0x00, 0xa6, 0xcc, 0x33, 0x0b, 0x24, 0xb0, 0x11, 0x07,
-  0x09, 0x5a, 0x6b, 0xb7, 0x11, 0xf1, 0xaa, 0x7a, 0x0e, 0x00, 0x00, 0x80,
-  0x1f, 0xb8, 0xeb, 0xbd, 0x1f, 0x55, 0x0f, 0x01, 0x4b, 0x67, 0x23, 0x0e,
-  0x46, 0xd6, 0x5a, 0x3b, 0x0f, 0x11, 0x0e, 0x00, 0x00, 0x98, 0xb6, 0x57,
-  0xc3, 0xb3, 0x0b, 0x30, 0x22, 0x21, 0x0e, 0xc6, 0x77, 0x56, 0x3d, 0x00,
-  0x00, 0x00, 0xc0, 0x23, 0x78, 0x76, 0x81, 0x91, 0x39, 0x9a, 0x0a, 0x23,
-  0x6a, 0xad, 0x1d, 0x45, 0xc4, 0xff, 0xaa, 0xe7, 0x00, 0x00, 0x00, 0x78,
-  0xa4, 0x7f, 0xf7, 0xde, 0x6f, 0xab, 0x87, 0x80, 0xa5, 0xb2, 0x11, 0x07,
-  0xe3, 0xf2, 0x13, 0x25, 0x00, 0x00, 0x60, 0x4e, 0x3c, 0xc3, 0xc0, 0x88,
-  0x84, 0x38, 0x18, 0x97, 0x0f, 0x31, 0x00, 0x00, 0x60, 0x4e, 0x3c, 0xc3,
-  0xc0, 0x88, 0x1c, 0x4d, 0x85, 0x11, 0xb9, 0x2d, 0x15, 0x00, 0x00, 0x98,
-  0x19, 0xb7, 0xa7, 0xc2, 0x88, 0x6c, 0xc4, 0xc1, 0x48, 0x5a, 0x6b, 0xa7,
-  0x21, 0xc2, 0x01, 0x00, 0x00, 0xf3, 0xf2, 0x6a, 0x78, 0x96, 0x01, 0x46,
-  0x20, 0xc4, 0xc1, 0x78, 0x4e, 0xab, 0x07, 0x00, 0x00, 0x00, 0x78, 0x86,
-  0xd3, 0xea, 0x01, 0x60, 0xa9, 0x84, 0x38, 0x18, 0xcf, 0x69, 0xf5, 0x00,
-  0x00, 0x00, 0x00, 0xcf, 0x70, 0x5a, 0x3d, 0x00, 0x2c, 0x95, 0x77, 0xc4,
-  0xc1, 0x48, 0x5a, 0x6b, 0xfe, 0x72, 0x01, 0x00, 0x00, 0xb3, 0xd4, 0x7b,
-  0x6f, 0xd5, 0x33, 0xc0, 0x12, 0xd9, 0x88, 0x83, 0x11, 0xb4, 0xd6, 0x4e,
-  0xaa, 0x67, 0x00, 0x00, 0x00, 0x78, 0x2e, 0xcf, 0x34, 0x30, 0x0e, 0x21,
-  0x0e, 0xc6, 0x71, 0x5c, 0x3d, 0x00, 0x00, 0x00, 0xc0, 0x0b, 0x1c, 0x57,
-  0x0f, 0x00, 0x4b, 0x24, 0xc4, 0xc1, 0x38, 0xfc, 0xf4, 0x08, 0x00, 0x00,
-  0x98, 0x33, 0xcf, 0x34, 0x30, 0x02, 0x21, 0x0e, 0xc6, 0xe1, 0x43, 0x0b,
-  0x00, 0x00, 0x98, 0x33, 0xcf, 0x34, 0x30, 0x02, 0x21, 0x0e, 0xc6, 0x71,
-  0x54, 0x3d, 0x00, 0x00, 0x00, 0xc0, 0x0b, 0x78, 0xa6, 0x81, 0x11, 0x08,
-  0x71, 0x30, 0x8e, 0xe3, 0xea, 0x01, 0x00, 0x00, 0x00, 0x5e, 0xe0, 0xb8,
-  0x7a, 0x00, 0x58, 0xa2, 0xd6, 0x7b, 0xaf, 0x9e, 0x01, 0x16, 0xa7, 0xb5,
-  0xe6, 0x2f, 0x16, 0x00, 0x00, 0x30, 0x6b, 0xbd, 0xf7, 0x56, 0x3d, 0x03,
-  0x2c, 0x8d, 0x8d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0xc1,
-  0x81, 0xb5, 0xd6, 0xbc, 0x4b, 0x01, 0x00, 0x00, 0x98, 0x3d, 0xcf, 0x36,
-  0x70, 0x78, 0x42, 0x1c, 0x1c, 0x9e, 0xdb, 0x85, 0x00, 0x00, 0x80, 0x25,
-  0xf0, 0x6c, 0x03, 0x07, 0x26, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x40, 0x88, 0x83, 0xc3, 0xbb, 0xae, 0x1e, 0x00, 0x00, 0x00,
-  0xe0, 0x00, 0xae, 0xab, 0x07, 0x80, 0xa5, 0x69, 0xbd, 0xf7, 0xaa, 0x23,
-  0x8b, 0x89, 0x00, 0x00, 0x15, 0x81, 0x49, 0x44, 0x41, 0x54, 0xea, 0x19,
-  0x60, 0x71, 0x5a, 0x6b, 0xfe, 0x62, 0x01, 0x00, 0x00, 0xb3, 0xd6, 0x7b,
-  0x6f, 0xd5, 0x33, 0xc0, 0xd2, 0xd8, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x60, 0x1c,
-  0x5f, 0xab, 0x07, 0x00, 0x00, 0x00, 0x78, 0x01, 0xcf, 0x34, 0x30, 0x02,
-  0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x30, 0x8e, 0x4d,
-  0xf5, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xb0, 0xa9, 0x1e, 0x00, 0x96, 0x48,
-  0x88, 0x83, 0x71, 0x5c, 0x57, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x02, 0xd7,
-  0xd5, 0x03, 0xc0, 0x12, 0x09, 0x71, 0x30, 0x8e, 0xeb, 0xea, 0x01, 0x00,
-  0x00, 0x00, 0x5e, 0xe0, 0xba, 0x7a, 0x00, 0x58, 0xa2, 0xd6, 0x7b, 0xaf,
-  0x9e, 0x01, 0x16, 0xa9, 0xb5, 0xe6, 0x2f, 0x17, 0x00, 0x00, 0x30, 0x4b,
-  0xbd, 0xf7, 0x56, 0x3d, 0x03, 0x2c, 0x91, 0x8d, 0x38, 0x18, 0xcf, 0x55,
-  0xf5, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xe0, 0x59, 0x06, 0x46, 0x22, 0xc4,
-  0xc1, 0x78, 0x36, 0xd5, 0x03, 0x00, 0x00, 0x00, 0x3c, 0xc3, 0xa6, 0x7a,
-  0x00, 0x58, 0x2a, 0x21, 0x0e, 0xc6, 0xb3, 0xa9, 0x1e, 0x00, 0x00, 0x00,
-  0xe0, 0x19, 0x36, 0xd5, 0x03, 0xc0, 0x52, 0x79, 0x47, 0x1c, 0x8c, 0xa4,
-  0xb5, 0x76, 0x14, 0x11, 0xff, 0xab, 0x9e, 0x03, 0x00, 0x00, 0xe0, 0x89,
-  0xfe, 0xdd, 0x7b, 0xbf, 0xad, 0x1e, 0x02, 0x96, 0xc8, 0x46, 0x1c, 0x8c,
-  0x64, 0xf8, 0xe0, 0xf2, 0x6e, 0x05, 0x00, 0x00, 0x60, 0x4e, 0xae, 0x44,
-  0x38, 0x18, 0x8f, 0x10, 0x07, 0xe3, 0xba, 0xa8, 0x1e, 0x00, 0x00, 0x00,
-  0xe0, 0x09, 0x2e, 0xaa, 0x07, 0x80, 0x25, 0x13, 0xe2, 0x60, 0x5c, 0x9b,
-  0xea, 0x01, 0x00, 0x00, 0x00, 0x9e, 0x60, 0x53, 0x3d, 0x00, 0x2c, 0x99,
-  0x77, 0xc4, 0xc1, 0xc8, 0x5a, 0x6b, 0xd7, 0x11, 0xf1, 0x5b, 0xf5, 0x1c,
-  0x00, 0x00, 0x00, 0xbf, 0x70, 0xd5, 0x7b, 0x3f, 0xa9, 0x1e, 0x02, 0x96,
-  0xcc, 0x46, 0x1c, 0x8c, 0xef, 0x63, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x8f,
-  0x70, 0x51, 0x3d, 0x00, 0x2c, 0x9d, 0x8d, 0x38, 0x18, 0x59, 0x6b, 0xed,
-  0x38, 0x22, 0xfe, 0x2a, 0x1e, 0x03, 0x00, 0x00, 0xe0, 0x57, 0x7e, 0xef,
-  0xbd, 0x5f, 0x57, 0x0f, 0x01, 0x4b, 0x66, 0x23, 0x0e, 0x46, 0x36, 0x7c,
-  0x90, 0x7d, 0xa9, 0x9e, 0x03, 0x00, 0x00, 0xe0, 0x27, 0xbe, 0x88, 0x70,
-  0x30, 0x3e, 0x21, 0x0e, 0x72, 0x5c, 0x54, 0x0f, 0x00, 0x00, 0x00, 0xf0,
-  0x13, 0x17, 0xd5, 0x03, 0xc0, 0x1a, 0x38, 0x9a, 0x0a, 0x49, 0x5c, 0xda,
-  0x00, 0x00, 0x00, 0x4c, 0xd4, 0x4d, 0xef, 0xfd, 0xb8, 0x7a, 0x08, 0x58,
-  0x03, 0x1b, 0x71, 0x90, 0xe7, 0x7d, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xdf,
-  0xf1, 0xbe, 0x7a, 0x00, 0x58, 0x0b, 0x1b, 0x71, 0x90, 0xa8, 0xb5, 0x76,
-  0x1b, 0x11, 0xaf, 0xaa, 0xe7, 0x00, 0x00, 0x00, 0x18, 0xdc, 0xf5, 0xde,
-  0x8f, 0xaa, 0x87, 0x80, 0xb5, 0xb0, 0x11, 0x07, 0xb9, 0x3e, 0x56, 0x0f,
-  0x00, 0x00, 0x00, 0xb0, 0xc7, 0x33, 0x0a, 0x24, 0xb2, 0x11, 0x07, 0x89,
-  0x5a, 0x6b, 0x47, 0x11, 0x71, 0x1d, 0xb6, 0xe2, 0x00, 0x00, 0x80, 0x7a,
-  0x77, 0x11, 0x71, 0xdc, 0x7b, 0xbf, 0xad, 0x1e, 0x04, 0xd6, 0xc2, 0x46,
-  0x1c, 0x24, 0x1a, 0x3e, 0xe0, 0xde, 0x55, 0xcf, 0x01, 0x00, 0x00, 0x10,
-  0x11, 0xef, 0x44, 0x38, 0xc8, 0x65, 0x23, 0x0e, 0x0a, 0xb8, 0x41, 0x15,
-  0x00, 0x00, 0x28, 0xe6, 0xa6, 0x54, 0x28, 0x60, 0x23, 0x0e, 0x6a, 0xd8,
-  0x8a, 0x03, 0x00, 0x00, 0x2a, 0x79, 0x26, 0x81, 0x02, 0x36, 0xe2, 0xa0,
-  0x48, 0x6b, 0x6d, 0x13, 0x11, 0x6f, 0xaa, 0xe7, 0x00, 0x00, 0x00, 0x56,
-  0xe7, 0x6b, 0xef, 0xfd, 0xb4, 0x7a, 0x08, 0x58, 0x23, 0x21, 0x0e, 0x8a,
-  0xb4, 0xd6, 0x8e, 0x23, 0xe2, 0xaf, 0xe2, 0x31, 0x00, 0x00, 0x80, 0xf5,
-  0xf9, 0xbd, 0xf7, 0x7e, 0x5d, 0x3d, 0x04, 0xac, 0x91, 0xa3, 0xa9, 0x50,
-  0x64, 0xf8, 0xe0, 0xfb, 0x50, 0x3d, 0x07, 0x00, 0x00, 0xb0, 0x2a, 0x1f,
-  0x44, 0x38, 0xa8, 0x63, 0x23, 0x0e, 0x8a, 0xb5, 0xd6, 0x2e, 0x23, 0xe2,
-  0x75, 0xf5, 0x1c, 0x00, 0x00, 0xc0, 0xe2, 0x5d, 0xf5, 0xde, 0x4f, 0xaa,
-  0x87, 0x80, 0x35, 0xb3, 0x11, 0x07, 0xf5, 0xce, 0xab, 0x07, 0x00, 0x00,
-  0x00, 0x56, 0xe1, 0xbc, 0x7a, 0x00, 0x58, 0x3b, 0x21, 0x0e, 0x8a, 0xf5,
-  0xde, 0x2f, 0xc3, 0x11, 0x55, 0x00, 0x00, 0x60, 0x5c, 0x1f, 0x86, 0x67,
-  0x0f, 0xa0, 0x90, 0xa3, 0xa9, 0x30, 0x11, 0x8e, 0xa8, 0x02, 0x00, 0x00,
-  0x23, 0x71, 0x24, 0x15, 0x26, 0xc2, 0x46, 0x1c, 0x4c, 0xc7, 0x59, 0x44,
-  0xdc, 0x55, 0x0f, 0x01, 0x00, 0x00, 0x2c, 0xca, 0x5d, 0x6c, 0x9f, 0x35,
-  0x80, 0x09, 0x10, 0xe2, 0x60, 0x22, 0x86, 0x9b, 0x8b, 0xce, 0x8b, 0xc7,
-  0x00, 0x00, 0x00, 0x96, 0xe5, 0xdc, 0x2d, 0xa9, 0x30, 0x1d, 0x42, 0x1c,
-  0x4c, 0x48, 0xef, 0xfd, 0x73, 0x44, 0xfc, 0x59, 0x3d, 0x07, 0x00, 0x00,
-  0xb0, 0x08, 0x7f, 0x0e, 0xcf, 0x18, 0xc0, 0x44, 0x78, 0x47, 0x1c, 0x4c,
-  0x50, 0x6b, 0x6d, 0x13, 0x11, 0x6f, 0xaa, 0xe7, 0x00, 0x00, 0x00, 0x66,
-  0xeb, 0x6b, 0xef, 0xfd, 0xb4, 0x7a, 0x08, 0xe0, 0x21, 0x21, 0x0e, 0x26,
-  0xa8, 0xb5, 0x76, 0x14, 0x11, 0x97, 0x11, 0xf1, 0x5b, 0xf5, 0x2c, 0x00,
-  0x00, 0xc0, 0xec, 0xdc, 0x44, 0xc4, 0x49, 0xef, 0xfd, 0xb6, 0x7a, 0x10,
-  0xe0, 0x21, 0x47, 0x53, 0x61, 0x82, 0x86, 0x0f, 0x4c, 0x97, 0x37, 0x00,
-  0x00, 0x00, 0x4f, 0x75, 0x17, 0x11, 0x67, 0x22, 0x1c, 0x4c, 0x93, 0x10,
-  0x07, 0x13, 0xd5, 0x7b, 0xbf, 0x0c, 0xb7, 0x1b, 0x01, 0x00, 0x00, 0x4f,
-  0x73, 0x36, 0x3c, 0x4b, 0x00, 0x13, 0x24, 0xc4, 0xc1, 0x84, 0xf5, 0xde,
-  0x37, 0x11, 0xf1, 0xb6, 0x7a, 0x0e, 0x00, 0x00, 0x60, 0x16, 0xde, 0x0e,
-  0xcf, 0x10, 0xc0, 0x44, 0x09, 0x71, 0x30, 0x71, 0xbd, 0xf7, 0x8b, 0x88,
-  0xf8, 0x50, 0x3d, 0x07, 0x00, 0x00, 0x30, 0x69, 0x1f, 0x86, 0x67, 0x07,
-  0x60, 0xc2, 0x5c, 0xd6, 0x00, 0x33, 0xd1, 0x5a, 0xbb, 0x88, 0x88, 0x3f,
-  0xaa, 0xe7, 0x00, 0x00, 0x00, 0x26, 0xe7, 0x53, 0xef, 0xfd, 0xbc, 0x7a,
-  0x08, 0xe0, 0xd7, 0x6c, 0xc4, 0xc1, 0x4c, 0x0c, 0x1f, 0xac, 0x9f, 0xaa,
-  0xe7, 0x00, 0x00, 0x00, 0x26, 0x45, 0x84, 0x83, 0x19, 0x11, 0xe2, 0x60,
-  0x46, 0xc4, 0x38, 0x00, 0x00, 0x60, 0x8f, 0x08, 0x07, 0x33, 0x23, 0xc4,
-  0xc1, 0xcc, 0x88, 0x71, 0x00, 0x00, 0x40, 0x88, 0x70, 0x30, 0x4b, 0x42,
-  0x1c, 0xcc, 0x90, 0x18, 0x07, 0x00, 0x00, 0xab, 0x26, 0xc2, 0xc1, 0x4c,
-  0x09, 0x71, 0x30, 0x53, 0x62, 0x1c, 0x00, 0x00, 0xac, 0x92, 0x08, 0x07,
-  0x33, 0x26, 0xc4, 0xc1, 0x8c, 0x89, 0x71, 0x00, 0x00, 0xb0, 0x2a, 0x22,
-  0x1c, 0xcc, 0x9c, 0x10, 0x07, 0x33, 0x27, 0xc6, 0x01, 0x00, 0xc0, 0x2a,
-  0x88, 0x70, 0xb0, 0x00, 0x42, 0x1c, 0x2c, 0xc0, 0xf0, 0x81, 0xfc, 0xb6,
-  0x7a, 0x0e, 0x00, 0x00, 0x60, 0x14, 0x6f, 0x45, 0x38, 0x58, 0x06, 0x21,
-  0x0e, 0x16, 0xa2, 0xf7, 0x7e, 0x11, 0x62, 0x1c, 0x00, 0x00, 0x2c, 0xcd,
-  0xdb, 0xe1, 0xdf, 0xfa, 0xc0, 0x02, 0xb4, 0xde, 0x7b, 0xf5, 0x0c, 0xc0,
-  0x01, 0xb5, 0xd6, 0x4e, 0x22, 0x62, 0x13, 0x11, 0xaf, 0x8a, 0x47, 0x01,
-  0x00, 0x00, 0x9e, 0xef, 0x2e, 0x22, 0x4e, 0x7b, 0xef, 0x97, 0xd5, 0x83,
-  0x00, 0x87, 0x63, 0x23, 0x0e, 0x16, 0x66, 0xf8, 0xa0, 0x3e, 0x8d, 0x88,
-  0xab, 0xe2, 0x51, 0x00, 0x00, 0x80, 0xe7, 0xb9, 0x0a, 0x11, 0x0e, 0x16,
-  0xc9, 0x46, 0x1c, 0x2c, 0x54, 0x6b, 0xed, 0x28, 0x22, 0x3e, 0x47, 0xc4,
-  0x9b, 0xea, 0x59, 0x00, 0x00, 0x80, 0x47, 0xfb, 0x1a, 0x11, 0x67, 0xbd,
-  0xf7, 0xdb, 0xea, 0x41, 0x80, 0xc3, 0xb3, 0x11, 0x07, 0x0b, 0xd5, 0x7b,
-  0xbf, 0xed, 0xbd, 0x9f, 0x86, 0x1b, 0x55, 0x01, 0x00, 0x60, 0x2e, 0x3e,
-  0xf5, 0xde, 0x4f, 0x45, 0x38, 0x58, 0x2e, 0x21, 0x0e, 0x16, 0xce, 0x8d,
-  0xaa, 0x00, 0x00, 0x30, 0x0b, 0x6e, 0x46, 0x85, 0x15, 0x70, 0x34, 0x15,
-  0x56, 0x62, 0xb8, 0xc4, 0xe1, 0x73, 0x44, 0xfc, 0x56, 0x3d, 0x0b, 0x00,
-  0x00, 0xf0, 0xb7, 0x9b, 0xd8, 0x1e, 0x45, 0xf5, 0x3e, 0x38, 0x58, 0x01,
-  0x1b, 0x71, 0xb0, 0x12, 0xc3, 0x07, 0xfb, 0x49, 0x6c, 0xdf, 0x39, 0x01,
-  0x00, 0x00, 0xd4, 0xfb, 0x1a, 0x11, 0x27, 0x22, 0x1c, 0xac, 0x87, 0x10,
-  0x07, 0x2b, 0xb2, 0xf7, 0xde, 0xb8, 0x0f, 0xd5, 0xb3, 0x00, 0x00, 0xc0,
-  0xca, 0x7d, 0xf0, 0x3e, 0x38, 0x58, 0x1f, 0x47, 0x53, 0x61, 0xa5, 0x5a,
-  0x6b, 0xa7, 0xb1, 0x3d, 0xaa, 0xfa, 0xaa, 0x78, 0x14, 0x00, 0x00, 0x58,
-  0x93, 0xbb, 0xd8, 0x1e, 0x45, 0xdd, 0x54, 0x0f, 0x02, 0xe4, 0xb3, 0x11,
-  0x07, 0x2b, 0x35, 0x7c, 0xf0, 0x1f, 0x47, 0xc4, 0x97, 0xda, 0x49, 0x00,
-  0x00, 0x60, 0x35, 0xbe, 0x44, 0xc4, 0xb1, 0x08, 0x07, 0xeb, 0x25, 0xc4,
-  0xc1, 0x8a, 0x0d, 0x47, 0x55, 0xcf, 0x22, 0xe2, 0xbf, 0xb1, 0xfd, 0xc9,
-  0x1c, 0x00, 0x00, 0x70, 0x78, 0x77, 0x11, 0xf1, 0xdf, 0xde, 0xfb, 0x99,
-  0xa3, 0xa8, 0xb0, 0x6e, 0x8e, 0xa6, 0x02, 0x11, 0xf1, 0xf7, 0xad, 0xaa,
-  0x17, 0x11, 0xf1, 0xba, 0x78, 0x14, 0x00, 0x00, 0x58, 0x92, 0xab, 0x88,
-  0x38, 0x77, 0x21, 0x03, 0x10, 0x61, 0x23, 0x0e, 0x18, 0xf4, 0xde, 0x2f,
-  0x7b, 0xef, 0x27, 0xe1, 0x22, 0x07, 0x00, 0x00, 0x38, 0x94, 0x0f, 0xbd,
-  0x77, 0xb7, 0xa2, 0x02, 0x7f, 0xb3, 0x11, 0x07, 0xfc, 0x83, 0xed, 0x38,
-  0x00, 0x00, 0x78, 0x11, 0x5b, 0x70, 0xc0, 0x77, 0xd9, 0x88, 0x03, 0xfe,
-  0xc1, 0x76, 0x1c, 0x00, 0x00, 0x3c, 0x9b, 0x2d, 0x38, 0xe0, 0x87, 0x6c,
-  0xc4, 0x01, 0x3f, 0x65, 0x3b, 0x0e, 0x00, 0x00, 0x1e, 0xc5, 0x16, 0x1c,
-  0xf0, 0x4b, 0x36, 0xe2, 0x80, 0x9f, 0xfa, 0x66, 0x3b, 0xce, 0xcd, 0xaa,
-  0x00, 0x00, 0xf0, 0xd0, 0x5d, 0xd8, 0x82, 0x03, 0x1e, 0xc9, 0x46, 0x1c,
-  0xf0, 0x68, 0xad, 0xb5, 0xe3, 0xd8, 0x6e, 0xc7, 0xbd, 0x29, 0x1d, 0x04,
-  0x00, 0x00, 0xa6, 0xe1, 0x6b, 0x6c, 0xb7, 0xe0, 0xae, 0xab, 0x07, 0x01,
-  0xe6, 0x41, 0x88, 0x03, 0x9e, 0xac, 0xb5, 0x76, 0x16, 0xdb, 0x20, 0xf7,
-  0xaa, 0x78, 0x14, 0x00, 0x00, 0xa8, 0x70, 0x17, 0xdb, 0x00, 0xf7, 0xb9,
-  0x7a, 0x10, 0x60, 0x5e, 0x1c, 0x4d, 0x05, 0x9e, 0x6c, 0xf8, 0x07, 0xc7,
-  0x71, 0x44, 0xfc, 0x59, 0x3c, 0x0a, 0x00, 0x00, 0x64, 0xfb, 0x33, 0x22,
-  0x8e, 0x45, 0x38, 0xe0, 0x39, 0x6c, 0xc4, 0x01, 0x2f, 0x32, 0x5c, 0xe6,
-  0xf0, 0x31, 0x1c, 0x57, 0x05, 0x00, 0x60, 0xd9, 0xbe, 0x46, 0xc4, 0x3b,
-  0xef, 0x81, 0x03, 0x5e, 0x42, 0x88, 0x03, 0x0e, 0x62, 0x38, 0xae, 0xfa,
-  0x31, 0x22, 0x7e, 0xab, 0x9e, 0x05, 0x00, 0x00, 0x0e, 0xe8, 0x26, 0xb6,
-  0x01, 0xce, 0x06, 0x1c, 0xf0, 0x62, 0x42, 0x1c, 0x70, 0x30, 0xad, 0xb5,
-  0xa3, 0x88, 0x78, 0x37, 0x7c, 0x79, 0x7f, 0x1c, 0x00, 0x00, 0x73, 0x76,
-  0x17, 0xdb, 0x1f, 0x34, 0x7f, 0xec, 0xbd, 0xdf, 0x56, 0x0f, 0x03, 0x2c,
-  0x83, 0x10, 0x07, 0x1c, 0xdc, 0x70, 0xbb, 0xea, 0xfb, 0x88, 0xf8, 0xa3,
-  0x74, 0x10, 0x00, 0x00, 0x78, 0x9e, 0x4f, 0x11, 0xf1, 0xde, 0x6d, 0xa8,
-  0xc0, 0xa1, 0x09, 0x71, 0xc0, 0x68, 0xbc, 0x3f, 0x0e, 0x00, 0x80, 0x99,
-  0xf1, 0x1e, 0x38, 0x60, 0x54, 0x42, 0x1c, 0x30, 0xba, 0xd6, 0xda, 0x69,
-  0x6c, 0x83, 0xdc, 0xeb, 0xe2, 0x51, 0x00, 0x00, 0xe0, 0x7b, 0xae, 0x62,
-  0x1b, 0xe0, 0x36, 0xd5, 0x83, 0x00, 0xcb, 0xf6, 0xaf, 0xea, 0x01, 0x80,
-  0xe5, 0xeb, 0xbd, 0x6f, 0x7a, 0xef, 0x27, 0x11, 0xf1, 0x36, 0xb6, 0x2f,
-  0xbb, 0x05, 0x00, 0x80, 0x29, 0xb8, 0x89, 0x88, 0xb7, 0xbd, 0xf7, 0x13,
-  0x11, 0x0e, 0xc8, 0x60, 0x23, 0x0e, 0x48, 0xd7, 0x5a, 0x3b, 0x8f, 0xed,
-  0x3b, 0xe4, 0xdc, 0xb0, 0x0a, 0x00, 0x40, 0x85, 0x9b, 0xd8, 0xbe, 0x03,
-  0xee, 0xa2, 0x7a, 0x10, 0x60, 0x5d, 0x84, 0x38, 0xa0, 0x84, 0x1b, 0x56,
-  0x01, 0x00, 0x28, 0xe0, 0x26, 0x54, 0xa0, 0x94, 0x10, 0x07, 0x94, 0x12,
-  0xe4, 0x00, 0x00, 0x48, 0x20, 0xc0, 0x01, 0x93, 0x20, 0xc4, 0x01, 0x93,
-  0x20, 0xc8, 0x01, 0x00, 0x30, 0x02, 0x01, 0x0e, 0x98, 0x14, 0x21, 0x0e,
-  0x98, 0x14, 0x41, 0x0e, 0x00, 0x80, 0x03, 0x10, 0xe0, 0x80, 0x49, 0x12,
-  0xe2, 0x80, 0x49, 0x1a, 0x82, 0xdc, 0x59, 0xb8, 0xd4, 0x01, 0x00, 0x80,
-  0xc7, 0xbb, 0x89, 0xed, 0xbf, 0x1f, 0x3f, 0x0b, 0x70, 0xc0, 0x14, 0x09,
-  0x71, 0xc0, 0xe4, 0xb9, 0x65, 0x15, 0x00, 0x80, 0x5f, 0x70, 0x0b, 0x2a,
-  0x30, 0x0b, 0x42, 0x1c, 0x30, 0x1b, 0x43, 0x90, 0x3b, 0x8f, 0x88, 0x37,
-  0xb5, 0x93, 0x00, 0x00, 0x30, 0x11, 0x5f, 0x23, 0xe2, 0x42, 0x80, 0x03,
-  0xe6, 0x42, 0x88, 0x03, 0x66, 0xa7, 0xb5, 0x76, 0x1a, 0xdb, 0x77, 0xc8,
-  0xfd, 0xa7, 0x78, 0x14, 0x00, 0x00, 0x6a, 0x7c, 0x89, 0xed, 0xfb, 0xdf,
-  0x36, 0xd5, 0x83, 0x00, 0x3c, 0x85, 0x10, 0x07, 0xcc, 0x56, 0x6b, 0xed,
-  0x38, 0xb6, 0x47, 0x56, 0xff, 0x28, 0x1d, 0x04, 0x00, 0x80, 0x2c, 0x9f,
-  0x62, 0x7b, 0x04, 0xf5, 0xba, 0x7a, 0x10, 0x80, 0xe7, 0x10, 0xe2, 0x80,
-  0xd9, 0xdb, 0xbb, 0x69, 0xf5, 0x3c, 0xbc, 0x47, 0x0e, 0x00, 0x60, 0x69,
-  0x6e, 0x22, 0xe2, 0x22, 0xdc, 0x80, 0x0a, 0x2c, 0x80, 0x10, 0x07, 0x2c,
-  0xca, 0xf0, 0x1e, 0xb9, 0x77, 0x11, 0xf1, 0xba, 0x78, 0x14, 0x00, 0x00,
-  0x5e, 0xe6, 0x2a, 0xb6, 0xf1, 0xed, 0xa2, 0x7a, 0x10, 0x80, 0x43, 0x11,
-  0xe2, 0x80, 0x45, 0x1a, 0xde, 0x23, 0x77, 0x1e, 0x8e, 0xad, 0x02, 0x00,
-  0xcc, 0xcd, 0xa7, 0xd8, 0x5e, 0xc0, 0xb0, 0xa9, 0x1e, 0x04, 0xe0, 0xd0,
-  0x84, 0x38, 0x60, 0xd1, 0x1c, 0x5b, 0x05, 0x00, 0x98, 0x05, 0xc7, 0x4f,
-  0x81, 0x55, 0x10, 0xe2, 0x80, 0xd5, 0x68, 0xad, 0x9d, 0xc5, 0x36, 0xca,
-  0xbd, 0xa9, 0x9e, 0x05, 0x00, 0x80, 0x88, 0x88, 0xf8, 0x1a, 0xdb, 0xf8,
-  0xf6, 0xb9, 0x7a, 0x10, 0x80, 0x0c, 0x42, 0x1c, 0xb0, 0x3a, 0xc3, 0x6d,
-  0xab, 0xbb, 0x2d, 0xb9, 0x57, 0x95, 0xb3, 0x00, 0x00, 0xac, 0xd0, 0x5d,
-  0xdc, 0x6f, 0xbf, 0x5d, 0xd7, 0x8e, 0x02, 0x90, 0x4b, 0x88, 0x03, 0x56,
-  0x6d, 0xb8, 0xdc, 0xe1, 0x3c, 0x6c, 0xc9, 0x01, 0x00, 0x8c, 0xed, 0x6b,
-  0x6c, 0xdf, 0xfd, 0x76, 0x51, 0x3d, 0x08, 0x40, 0x15, 0x21, 0x0e, 0x20,
-  0xfe, 0xde, 0x92, 0x3b, 0x0f, 0xef, 0x92, 0x03, 0x00, 0x38, 0xa4, 0xdd,
-  0xbb, 0xdf, 0x2e, 0x6c, 0xbf, 0x01, 0x08, 0x71, 0x00, 0xff, 0x30, 0xbc,
-  0x4b, 0xee, 0x2c, 0xdc, 0xb8, 0x0a, 0x00, 0xf0, 0x5c, 0x9f, 0x22, 0xe2,
-  0xb3, 0x77, 0xbf, 0x01, 0x3c, 0x24, 0xc4, 0x01, 0xfc, 0xc0, 0x70, 0xe3,
-  0xea, 0xee, 0x82, 0x87, 0xd7, 0xc5, 0xe3, 0x00, 0x00, 0x4c, 0xdd, 0x55,
-  0x44, 0x7c, 0x8c, 0x6d, 0x80, 0x73, 0xf3, 0x29, 0xc0, 0x77, 0x08, 0x71,
-  0x00, 0x8f, 0xb0, 0x77, 0xc1, 0xc3, 0x59, 0x38, 0xba, 0x0a, 0x00, 0xb0,
-  0x73, 0x13, 0x11, 0x9f, 0xc3, 0xc5, 0x0b, 0x00, 0x8f, 0x22, 0xc4, 0x01,
-  0x3c, 0xd1, 0xde, 0xd1, 0xd5, 0xb3, 0x70, 0xeb, 0x2a, 0x00, 0xb0, 0x3e,
-  0x77, 0xb1, 0x8d, 0x6f, 0x8e, 0x9e, 0x02, 0x3c, 0x91, 0x10, 0x07, 0xf0,
-  0x02, 0xc3, 0xad, 0xab, 0x67, 0x11, 0xf1, 0x9f, 0xe2, 0x51, 0x00, 0x00,
-  0xc6, 0xf6, 0x25, 0xb6, 0xf1, 0xed, 0xa2, 0x7a, 0x10, 0x80, 0xb9, 0x12,
-  0xe2, 0x00, 0x0e, 0x60, 0xef, 0x7d, 0x72, 0xa2, 0x1c, 0x00, 0xb0, 0x24,
-  0x5f, 0xe2, 0x7e, 0xfb, 0xcd, 0x7b, 0xdf, 0x00, 0x5e, 0x48, 0x88, 0x03,
-  0x38, 0xb0, 0x21, 0xca, 0x9d, 0x0f, 0x5f, 0x2e, 0x79, 0x00, 0x00, 0xe6,
-  0xe6, 0x2a, 0x22, 0x2e, 0x22, 0xe2, 0x42, 0x7c, 0x03, 0x38, 0x2c, 0x21,
-  0x0e, 0x60, 0x44, 0xc3, 0x25, 0x0f, 0x67, 0x21, 0xca, 0x01, 0x00, 0xd3,
-  0xb6, 0x8b, 0x6f, 0x9f, 0x5d, 0xba, 0x00, 0x30, 0x1e, 0x21, 0x0e, 0x20,
-  0xc9, 0x5e, 0x94, 0x3b, 0x0d, 0xc7, 0x57, 0x01, 0x80, 0x7a, 0x5f, 0x22,
-  0x62, 0x13, 0xe2, 0x1b, 0x40, 0x1a, 0x21, 0x0e, 0xa0, 0x80, 0x77, 0xca,
-  0x01, 0x00, 0x45, 0xbc, 0xf3, 0x0d, 0xa0, 0x90, 0x10, 0x07, 0x50, 0x6c,
-  0x2f, 0xca, 0x9d, 0x0e, 0xdf, 0x5f, 0x95, 0x0e, 0x04, 0x00, 0x2c, 0xc9,
-  0x5d, 0x6c, 0xc3, 0xdb, 0x26, 0xc4, 0x37, 0x80, 0x72, 0x42, 0x1c, 0xc0,
-  0xc4, 0xb4, 0xd6, 0xf6, 0xa3, 0xdc, 0x6f, 0xb5, 0xd3, 0x00, 0x00, 0x33,
-  0x74, 0x13, 0x43, 0x7c, 0xeb, 0xbd, 0x7f, 0xae, 0x1e, 0x06, 0x80, 0x7b,
-  0x42, 0x1c, 0xc0, 0x84, 0xb5, 0xd6, 0x4e, 0xe2, 0xfe, 0x08, 0xab, 0xcb,
-  0x1e, 0x00, 0x80, 0x1f, 0xb9, 0x8a, 0xfb, 0x23, 0xa7, 0x97, 0xd5, 0xc3,
-  0x00, 0xf0, 0x7d, 0x42, 0x1c, 0xc0, 0x4c, 0x0c, 0x97, 0x3d, 0x9c, 0xc6,
-  0xfd, 0x31, 0x56, 0x47, 0x58, 0x01, 0x60, 0xbd, 0xee, 0x62, 0x38, 0x6e,
-  0x1a, 0xdb, 0xcd, 0xb7, 0xeb, 0xd2, 0x69, 0x00, 0x78, 0x14, 0x21, 0x0e,
-  0x60, 0xa6, 0x5a, 0x6b, 0xa7, 0x71, 0x1f, 0xe5, 0x6c, 0xcb, 0x01, 0xc0,
-  0xf2, 0x5d, 0xc5, 0xfd, 0xbb, 0xde, 0x36, 0xb5, 0xa3, 0x00, 0xf0, 0x1c,
-  0x42, 0x1c, 0xc0, 0x02, 0xd8, 0x96, 0x03, 0x80, 0x45, 0xb2, 0xf5, 0x06,
-  0xb0, 0x30, 0x42, 0x1c, 0xc0, 0x02, 0x0d, 0xdb, 0x72, 0xa7, 0xe1, 0xdd,
-  0x72, 0x00, 0x30, 0x37, 0xbb, 0x77, 0xbd, 0x6d, 0x6c, 0xbd, 0x01, 0x2c,
-  0x8f, 0x10, 0x07, 0xb0, 0x70, 0xad, 0xb5, 0xa3, 0x78, 0xb8, 0x2d, 0xe7,
-  0x26, 0x56, 0x00, 0x98, 0x8e, 0x9b, 0x78, 0xb8, 0xf5, 0x76, 0x5b, 0x3b,
-  0x0e, 0x00, 0x63, 0x12, 0xe2, 0x00, 0x56, 0xc6, 0x31, 0x56, 0x00, 0x28,
-  0xe5, 0xb8, 0x29, 0xc0, 0x8a, 0x09, 0x71, 0x00, 0x2b, 0xd7, 0x5a, 0x3b,
-  0x89, 0x6d, 0x90, 0xdb, 0x7d, 0x09, 0x73, 0x00, 0x70, 0x38, 0xbb, 0xf0,
-  0xb6, 0x89, 0x6d, 0x78, 0xbb, 0x2c, 0x9d, 0x06, 0x80, 0x52, 0x42, 0x1c,
-  0x00, 0x0f, 0x08, 0x73, 0x00, 0xf0, 0x22, 0xc2, 0x1b, 0x00, 0x3f, 0x24,
-  0xc4, 0x01, 0xf0, 0x53, 0xc2, 0x1c, 0x00, 0xfc, 0x94, 0xf0, 0x06, 0xc0,
-  0xa3, 0x09, 0x71, 0x00, 0x3c, 0xc9, 0x10, 0xe6, 0xf6, 0xe3, 0x9c, 0xcb,
-  0x1f, 0x00, 0x58, 0x93, 0xdd, 0xe5, 0x0a, 0x9b, 0x88, 0xb8, 0x14, 0xde,
-  0x00, 0x78, 0x0a, 0x21, 0x0e, 0x80, 0x17, 0x19, 0x2e, 0x7f, 0xd8, 0x0f,
-  0x73, 0xaf, 0xeb, 0xa6, 0x01, 0x80, 0x83, 0xbb, 0x8a, 0x87, 0xe1, 0xed,
-  0xba, 0x72, 0x18, 0x00, 0xe6, 0x4d, 0x88, 0x03, 0xe0, 0xe0, 0x5a, 0x6b,
-  0xa7, 0xb1, 0x8d, 0x72, 0xbb, 0x40, 0xe7, 0x38, 0x2b, 0x00, 0x73, 0xb0,
-  0x3b, 0x66, 0x7a, 0x19, 0xdb, 0x63, 0xa6, 0x9b, 0xd2, 0x69, 0x00, 0x58,
-  0x1c, 0x21, 0x0e, 0x80, 0xd1, 0x0d, 0x5b, 0x73, 0xa7, 0x71, 0x1f, 0xe6,
-  0x6c, 0xcd, 0x01, 0x30, 0x05, 0xbb, 0x6d, 0xb7, 0x5d, 0x78, 0xbb, 0x2e,
-  0x9d, 0x06, 0x80, 0xc5, 0x13, 0xe2, 0x00, 0x28, 0x31, 0x6c, 0xcd, 0xed,
-  0xc2, 0xdc, 0x49, 0x78, 0xd7, 0x1c, 0x00, 0xe3, 0xba, 0x89, 0x21, 0xb8,
-  0xc5, 0xf6, 0x88, 0xe9, 0xa6, 0x74, 0x1a, 0x00, 0x56, 0x49, 0x88, 0x03,
-  0x60, 0x12, 0x5a, 0x6b, 0x47, 0xf1, 0x30, 0xcc, 0x89, 0x73, 0x00, 0x3c,
-  0xd7, 0x2e, 0xba, 0xed, 0x87, 0xb7, 0xdb, 0xd2, 0x89, 0x00, 0x20, 0x84,
-  0x38, 0x00, 0x26, 0x4c, 0x9c, 0x03, 0xe0, 0x11, 0x44, 0x37, 0x00, 0x66,
-  0x43, 0x88, 0x03, 0x60, 0x56, 0xc4, 0x39, 0x80, 0x55, 0x13, 0xdd, 0x00,
-  0x98, 0x35, 0x21, 0x0e, 0x80, 0x45, 0xd8, 0x7b, 0xe7, 0xdc, 0xf1, 0xf0,
-  0xfd, 0x4d, 0xe5, 0x3c, 0x00, 0xbc, 0xd8, 0xd7, 0xd8, 0x06, 0xb7, 0xeb,
-  0xf0, 0x4e, 0x37, 0x00, 0x16, 0x42, 0x88, 0x03, 0x60, 0xb1, 0x5a, 0x6b,
-  0xfb, 0x61, 0xce, 0xf6, 0x1c, 0xc0, 0x34, 0xed, 0x6f, 0xb9, 0x5d, 0x46,
-  0xc4, 0x75, 0xef, 0xfd, 0xb2, 0x76, 0x24, 0x00, 0x18, 0x87, 0x10, 0x07,
-  0xc0, 0xea, 0x0c, 0xdb, 0x73, 0xc7, 0xc3, 0xd7, 0xee, 0xd7, 0x02, 0x1d,
-  0xc0, 0xb8, 0x6e, 0x62, 0xbb, 0xdd, 0xb6, 0x19, 0xbe, 0x5f, 0xdb, 0x72,
-  0x03, 0x60, 0x6d, 0x84, 0x38, 0x00, 0x18, 0x08, 0x74, 0x00, 0x07, 0x21,
-  0xb8, 0x01, 0xc0, 0x0f, 0x08, 0x71, 0x00, 0xf0, 0x0b, 0xdf, 0x04, 0xba,
-  0xdd, 0x71, 0xd7, 0xd7, 0x65, 0x03, 0x01, 0x4c, 0xc3, 0x55, 0x0c, 0xef,
-  0x6f, 0x0b, 0xc1, 0x0d, 0x00, 0x1e, 0x45, 0x88, 0x03, 0x80, 0x67, 0x6a,
-  0xad, 0x1d, 0xc7, 0xfd, 0xf6, 0xdc, 0xee, 0x36, 0xd7, 0xe3, 0xb0, 0x45,
-  0x07, 0x2c, 0xc7, 0x6e, 0xbb, 0xed, 0x32, 0x22, 0x6e, 0x63, 0xd8, 0x72,
-  0xeb, 0xbd, 0x5f, 0xd7, 0x8d, 0x04, 0x00, 0xf3, 0x25, 0xc4, 0x01, 0xc0,
-  0x08, 0x86, 0x8b, 0x22, 0x8e, 0x42, 0xa4, 0x03, 0xa6, 0xef, 0x7b, 0xb1,
-  0xed, 0xd6, 0x85, 0x09, 0x00, 0x70, 0x78, 0x42, 0x1c, 0x00, 0x24, 0xfb,
-  0x26, 0xd2, 0x45, 0xdc, 0xc7, 0x3a, 0xc7, 0x5d, 0x81, 0xb1, 0x5c, 0xc5,
-  0x7d, 0x64, 0x8b, 0x10, 0xdb, 0x00, 0xa0, 0x84, 0x10, 0x07, 0x00, 0x13,
-  0xd2, 0x5a, 0xdb, 0x6d, 0xcf, 0x7d, 0xef, 0xbb, 0x50, 0x07, 0xfc, 0xc8,
-  0x2e, 0xb4, 0x5d, 0x7e, 0xfb, 0xbd, 0xf7, 0x7e, 0x5b, 0x39, 0x18, 0x00,
-  0x70, 0x4f, 0x88, 0x03, 0x80, 0x19, 0xd9, 0x0b, 0x75, 0x11, 0x0f, 0x37,
-  0xea, 0x62, 0xf8, 0xf3, 0x57, 0xc9, 0x23, 0x01, 0xe3, 0xbb, 0x8b, 0x6d,
-  0x58, 0x8b, 0xb8, 0xdf, 0x68, 0x13, 0xda, 0x00, 0x60, 0x86, 0x84, 0x38,
-  0x00, 0x58, 0x98, 0xbd, 0x4b, 0x24, 0xbe, 0x17, 0xed, 0xc4, 0x3a, 0x98,
-  0x96, 0x9f, 0x45, 0x36, 0x97, 0x22, 0x00, 0xc0, 0xc2, 0x08, 0x71, 0x00,
-  0xb0, 0x42, 0xdf, 0x6c, 0xd6, 0xed, 0x8e, 0xbe, 0x7e, 0xfb, 0x67, 0x82,
-  0x1d, 0x3c, 0xdf, 0x7e, 0x60, 0xdb, 0x85, 0xb5, 0xdb, 0xfd, 0x3f, 0xb3,
-  0xc9, 0x06, 0x00, 0xeb, 0x23, 0xc4, 0x01, 0x00, 0x3f, 0xd5, 0x5a, 0x3b,
-  0x1d, 0x7e, 0xb9, 0x1f, 0xea, 0x8e, 0x87, 0xaf, 0xdd, 0xaf, 0xdd, 0x06,
-  0xcb, 0x1a, 0xec, 0x6e, 0x17, 0x8d, 0xe1, 0xfb, 0xee, 0xd7, 0xbb, 0xd0,
-  0x16, 0xbd, 0xf7, 0x4d, 0xf2, 0x4c, 0x00, 0xc0, 0x8c, 0x08, 0x71, 0x00,
-  0xc0, 0xc1, 0xec, 0x1d, 0x8b, 0x8d, 0x78, 0x18, 0xee, 0x22, 0xee, 0x8f,
-  0xc7, 0x46, 0x88, 0x77, 0xd4, 0xdb, 0x8f, 0x6a, 0x11, 0xf7, 0xc7, 0x42,
-  0x23, 0xf6, 0xc2, 0x5a, 0x38, 0x1e, 0x0a, 0x00, 0x1c, 0x90, 0x10, 0x07,
-  0x00, 0x94, 0xdb, 0xdb, 0xba, 0x8b, 0xf8, 0x67, 0xc0, 0xfb, 0xf6, 0xf7,
-  0x11, 0x11, 0x6f, 0xc6, 0x9e, 0x89, 0x59, 0xf8, 0xfa, 0xcd, 0xef, 0xf7,
-  0x03, 0xda, 0x3f, 0x7e, 0x6f, 0x5b, 0x0d, 0x00, 0xa8, 0x26, 0xc4, 0x01,
-  0x00, 0xb3, 0xf7, 0xcd, 0x26, 0xde, 0xce, 0xee, 0xdd, 0x77, 0xfb, 0xbe,
-  0x17, 0xf5, 0x76, 0x7f, 0xfe, 0xfa, 0xd0, 0x73, 0xf1, 0xc0, 0x55, 0x3c,
-  0x8c, 0x64, 0x3b, 0xdf, 0xc6, 0xb3, 0x88, 0x87, 0xef, 0x52, 0xdb, 0xb1,
-  0x99, 0x06, 0x00, 0xcc, 0x9e, 0x10, 0x07, 0x00, 0xf0, 0x13, 0xdf, 0x5c,
-  0x6c, 0xf1, 0x23, 0xc7, 0xf1, 0xcf, 0x10, 0xf8, 0x2b, 0x8f, 0xf9, 0xff,
-  0x8e, 0x65, 0xf3, 0x8c, 0xff, 0xe6, 0x3a, 0x1e, 0x1e, 0xe5, 0xfc, 0x1e,
-  0x17, 0x10, 0x00, 0x00, 0xfc, 0x84, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0xfe, 0x55, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x81, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40,
-  0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88,
-  0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03,
-  0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24,
-  0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00,
-  0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10,
-  0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00,
-  0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00,
-  0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40,
-  0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88,
-  0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03,
-  0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24,
-  0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00,
-  0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10,
-  0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00,
-  0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00,
-  0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40,
-  0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88,
-  0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20,
-  0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03,
-  0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24,
-  0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00,
-  0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10,
-  0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00,
-  0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x42, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x02, 0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x21, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x81, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00,
-  0x00, 0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81,
-  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x40, 0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40,
-  0x88, 0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x24, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x10, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x84, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x20, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x21, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x40, 0x88,
-  0x03, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0xf8, 0x3f, 0x40, 0x75, 0x5a, 0xba, 0x15, 0x2f, 0xad, 0xb6, 0x00,
-  0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int Hole_png_len = 13787;
-
-#endif // Hole_HPP
\ No newline at end of file
@@ -1,2488 +0,0 @@
-/*
- * Filename: Mole.hpp
- * Author: Malolan Venkataraghavan
- * 
- * Array containing the data for the mole sprite
- */
-
-#if !defined(Mole_HPP)
-#define Mole_HPP
-
-unsigned char Mole_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x04, 0xe3, 0x00, 0x00, 0x04, 0xe2,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0xf8, 0x44, 0x27, 0x78, 0x00, 0x00, 0x00,
-  0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e,
-  0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44,
-  0x41, 0x54, 0x78, 0x9c, 0xec, 0xdd, 0x4f, 0x6c, 0x5c, 0x67, 0x7a, 0x2f,
-  0xe8, 0xf7, 0x10, 0x45, 0x97, 0x4b, 0xb4, 0xaa, 0xd8, 0xa2, 0x4c, 0xd1,
-  0xb0, 0x28, 0x51, 0x86, 0xa8, 0x06, 0x22, 0xba, 0xc5, 0x81, 0xec, 0x85,
-  0xcd, 0x24, 0xd6, 0xd5, 0x04, 0x18, 0xc8, 0x09, 0x10, 0x7b, 0xe7, 0x46,
-  0x2f, 0xac, 0x41, 0x80, 0xb9, 0xbd, 0x9a, 0xf8, 0xae, 0x7a, 0x31, 0x8b,
-  0x38, 0x8b, 0x1b, 0x60, 0x30, 0x8b, 0x38, 0xc0, 0x0d, 0x90, 0x99, 0x4d,
-  0xbb, 0x37, 0x93, 0xde, 0xb5, 0xa7, 0x31, 0xd3, 0xde, 0xcc, 0x78, 0xe4,
-  0xcc, 0x55, 0x67, 0x61, 0x0b, 0x57, 0xbe, 0xa6, 0x2f, 0x10, 0xc9, 0xb0,
-  0x6c, 0x51, 0x0d, 0x4b, 0x6c, 0xcb, 0x57, 0x2c, 0x59, 0xa2, 0xcb, 0x64,
-  0x58, 0xb3, 0x20, 0x29, 0x17, 0x8b, 0xc5, 0xff, 0xac, 0x73, 0xaa, 0xea,
-  0x3c, 0x0f, 0x60, 0x58, 0xe7, 0xab, 0x92, 0xfc, 0x36, 0x9b, 0xaa, 0xaa,
-  0xf3, 0xe3, 0xfb, 0x7d, 0x6f, 0x52, 0xaf, 0xd7, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x68, 0xbf, 0xbe, 0xac, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x80, 0xbc,
-  0x10, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44,
-  0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a,
-  0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11,
-  0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4,
-  0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12,
-  0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29,
-  0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44,
-  0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a,
-  0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11,
-  0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4,
-  0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12,
-  0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29,
-  0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44,
-  0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a,
-  0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00,
-  0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11,
-  0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4,
-  0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12,
-  0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29,
-  0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44,
-  0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00,
-  0x00, 0x40, 0x4a, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x44, 0x18, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x29, 0x11, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x90, 0x12, 0x61, 0x1c, 0x00, 0x00, 0x00, 0x00,
-  0xa4, 0xa4, 0x90, 0x75, 0x01, 0x00, 0x00, 0x6c, 0x5f, 0x92, 0x24, 0x83,
-  0x11, 0x31, 0xb9, 0xc5, 0xd3, 0xb6, 0xf3, 0x9c, 0x55, 0x97, 0xb6, 0x78,
-  0xfc, 0x5e, 0xbd, 0x5e, 0xbf, 0xba, 0xcd, 0x3f, 0x0b, 0x00, 0x80, 0x2d,
-  0x24, 0xf5, 0x7a, 0x3d, 0xeb, 0x1a, 0x00, 0x00, 0x72, 0x25, 0x49, 0x92,
-  0x73, 0x0d, 0x97, 0x8d, 0xbf, 0x1e, 0x5b, 0xf9, 0x67, 0xd5, 0x60, 0x44,
-  0x9c, 0x69, 0x7b, 0x41, 0x3b, 0xf7, 0x45, 0x44, 0x7c, 0xde, 0x70, 0x7d,
-  0xa9, 0xc5, 0xaf, 0x3f, 0xaf, 0xd7, 0xeb, 0x8d, 0xcf, 0x01, 0x00, 0x20,
-  0x84, 0x71, 0x00, 0x00, 0xfb, 0xa6, 0x21, 0x64, 0x9b, 0x8c, 0xe5, 0x20,
-  0xad, 0xb1, 0x43, 0x6d, 0x32, 0x22, 0x2a, 0x19, 0x94, 0xd5, 0x09, 0xde,
-  0x5f, 0xf9, 0xf7, 0xd5, 0x88, 0xb8, 0xd7, 0xf8, 0xef, 0x7a, 0xbd, 0x7e,
-  0x2f, 0xb3, 0xaa, 0x00, 0x00, 0x32, 0x20, 0x8c, 0x03, 0x00, 0xd8, 0xa6,
-  0x86, 0xb0, 0xad, 0xf9, 0xdf, 0x2f, 0xa5, 0x5d, 0x4b, 0x8f, 0xf9, 0x28,
-  0x96, 0xc3, 0xb9, 0x4b, 0xf1, 0x7d, 0x58, 0xa7, 0xb3, 0x0e, 0x00, 0xe8,
-  0x49, 0xc2, 0x38, 0x00, 0x80, 0x06, 0x49, 0x92, 0xac, 0x76, 0xb5, 0x9d,
-  0x8b, 0xef, 0xb7, 0x8d, 0x76, 0x55, 0x57, 0x5b, 0xb1, 0xd0, 0x17, 0xc3,
-  0x95, 0xe2, 0x96, 0xcf, 0xab, 0x2d, 0x2c, 0xc5, 0x6c, 0xb5, 0x96, 0x42,
-  0x45, 0x7b, 0xf2, 0x7e, 0x2c, 0x6f, 0x89, 0xfd, 0x3c, 0xbe, 0x0f, 0xe9,
-  0x9c, 0x61, 0x07, 0x00, 0x74, 0x2d, 0x61, 0x1c, 0x00, 0x90, 0x4b, 0x49,
-  0x92, 0x8c, 0xc5, 0x72, 0xc8, 0xb6, 0xfa, 0xcf, 0x58, 0x64, 0x70, 0x3e,
-  0x5b, 0xb9, 0x54, 0x88, 0xca, 0x81, 0xfe, 0x47, 0xd7, 0xa3, 0x43, 0xa5,
-  0x47, 0xbf, 0x7e, 0xbc, 0xbf, 0x2f, 0x86, 0xcb, 0xeb, 0x43, 0xb5, 0xc6,
-  0xe7, 0xb4, 0xdb, 0x6c, 0xb5, 0x16, 0xb5, 0x85, 0xa5, 0x35, 0x6b, 0x37,
-  0xef, 0xce, 0x3f, 0xfa, 0x75, 0x63, 0xa0, 0x97, 0x72, 0xb8, 0xd7, 0x18,
-  0xd2, 0x5d, 0x0a, 0x5b, 0x5e, 0x01, 0x80, 0x2e, 0x21, 0x8c, 0x03, 0x00,
-  0x7a, 0xde, 0xca, 0xf6, 0xd2, 0xd5, 0xc0, 0x6d, 0x32, 0xda, 0xbc, 0xad,
-  0xb4, 0xb1, 0x33, 0x6d, 0x35, 0x38, 0x6b, 0x0c, 0xd6, 0x86, 0xcb, 0xc5,
-  0x28, 0xf6, 0xf7, 0xb5, 0xb3, 0x84, 0xcc, 0xad, 0x86, 0x78, 0xdf, 0xae,
-  0x04, 0x74, 0x8d, 0x41, 0xdd, 0x4c, 0x43, 0x98, 0xb7, 0xcf, 0x56, 0x07,
-  0x4b, 0x5c, 0x8a, 0xe5, 0x2e, 0xba, 0xab, 0xb6, 0xba, 0x02, 0x00, 0x9d,
-  0x46, 0x18, 0x07, 0x00, 0xf4, 0x94, 0x86, 0xe0, 0x6d, 0xf5, 0x9f, 0x7d,
-  0xef, 0x76, 0x5b, 0xed, 0x66, 0x5b, 0x0d, 0xd5, 0x2a, 0x2b, 0xd7, 0xcd,
-  0x5d, 0x6e, 0x6c, 0x6e, 0xe6, 0xee, 0xfc, 0xa3, 0xb0, 0xae, 0xfa, 0x70,
-  0x21, 0xe6, 0xe6, 0x17, 0x63, 0x76, 0xae, 0x16, 0xb5, 0xc5, 0xa5, 0xad,
-  0x7f, 0xf3, 0xf6, 0xcd, 0xc5, 0x72, 0x30, 0x77, 0x29, 0x74, 0xd0, 0x01,
-  0x00, 0x1d, 0x40, 0x18, 0x07, 0x00, 0x74, 0xad, 0x95, 0xad, 0xa6, 0xe7,
-  0xe2, 0xfb, 0xe0, 0x6d, 0xdf, 0x3a, 0xde, 0x1a, 0x03, 0xb7, 0xca, 0x81,
-  0x42, 0x0c, 0x97, 0x8b, 0xc2, 0xb6, 0x14, 0xcd, 0xdc, 0x9d, 0x8f, 0xb9,
-  0x95, 0x80, 0x6e, 0xe6, 0xee, 0xfc, 0x7e, 0x6f, 0x81, 0xfd, 0x22, 0xbe,
-  0xef, 0x9e, 0xbb, 0xe4, 0x0c, 0x3a, 0x00, 0x20, 0x4d, 0xc2, 0x38, 0x00,
-  0xa0, 0x6b, 0xac, 0x0c, 0x57, 0x38, 0x17, 0xdf, 0x07, 0x70, 0xc7, 0xf7,
-  0xfa, 0x67, 0xae, 0x06, 0x6c, 0xa3, 0x43, 0xa5, 0x47, 0x1d, 0x6e, 0x69,
-  0x9e, 0xc9, 0xc6, 0xce, 0x34, 0x87, 0x74, 0xfb, 0xd4, 0x49, 0xb7, 0xa6,
-  0x7b, 0xae, 0x5e, 0xaf, 0x5f, 0xda, 0xeb, 0x1f, 0x08, 0x00, 0xb0, 0x11,
-  0x61, 0x1c, 0x00, 0xd0, 0xb1, 0x9a, 0xc2, 0xb7, 0x73, 0xb1, 0xc7, 0x89,
-  0xa6, 0xa3, 0x43, 0xa5, 0x35, 0x9d, 0x6e, 0x42, 0xb7, 0xde, 0xb0, 0xda,
-  0x35, 0x77, 0xf3, 0xee, 0x7c, 0xcc, 0x56, 0x6b, 0x31, 0x3b, 0x57, 0x8b,
-  0xea, 0xfc, 0xe2, 0x5e, 0xff, 0xd8, 0xf7, 0x43, 0x38, 0x07, 0x00, 0xb4,
-  0x81, 0x30, 0x0e, 0x00, 0xe8, 0x18, 0xfb, 0x19, 0xbe, 0xad, 0x06, 0x6f,
-  0xc3, 0xe5, 0xc7, 0x62, 0xb8, 0x52, 0x6c, 0x39, 0x95, 0x94, 0xde, 0xd5,
-  0x86, 0x80, 0x4e, 0x38, 0x07, 0x00, 0xec, 0x0b, 0x61, 0x1c, 0x00, 0x90,
-  0x99, 0x24, 0x49, 0x06, 0x23, 0xe2, 0x95, 0xf8, 0x3e, 0x7c, 0xdb, 0xd5,
-  0xb6, 0xd3, 0xd5, 0xd0, 0x6d, 0x74, 0xa8, 0x24, 0x78, 0x63, 0x43, 0x73,
-  0x0f, 0x17, 0x62, 0xb6, 0xfa, 0xdd, 0xf2, 0xf6, 0xd6, 0x6a, 0x6d, 0x2f,
-  0x53, 0x5d, 0xe7, 0xe2, 0xfb, 0x81, 0x10, 0xef, 0x98, 0xd8, 0x0a, 0x00,
-  0xec, 0x84, 0x30, 0x0e, 0x00, 0x48, 0xd5, 0x4a, 0xf7, 0xdb, 0x2b, 0x2b,
-  0xff, 0xec, 0x6a, 0xd2, 0xe9, 0xe8, 0x50, 0x29, 0x46, 0x87, 0x4a, 0x71,
-  0x6c, 0xa5, 0xfb, 0xad, 0xd8, 0xdf, 0xb7, 0xaf, 0x35, 0x92, 0x1f, 0x33,
-  0x77, 0xe7, 0x1f, 0x75, 0xcf, 0xcd, 0x7c, 0x35, 0xbf, 0xdb, 0xf3, 0xe7,
-  0x56, 0x07, 0x42, 0xbc, 0x13, 0xcb, 0x9d, 0x73, 0xa6, 0xb5, 0x02, 0x00,
-  0x1b, 0x12, 0xc6, 0x01, 0x00, 0x6d, 0x97, 0x24, 0xc9, 0x6a, 0xf8, 0x76,
-  0x2e, 0x76, 0xd1, 0xfd, 0xd6, 0x18, 0xbe, 0x39, 0xe7, 0x8d, 0x76, 0x5a,
-  0xed, 0x98, 0xbb, 0x79, 0x77, 0x7e, 0x2f, 0xe1, 0xdc, 0xfb, 0xb1, 0x1c,
-  0xcc, 0xe9, 0x9a, 0x03, 0x00, 0xd6, 0x11, 0xc6, 0x01, 0x00, 0xfb, 0xae,
-  0x61, 0xfb, 0xe9, 0x6a, 0x00, 0xb7, 0xa3, 0xb3, 0xdf, 0x84, 0x6f, 0x74,
-  0x8a, 0x7d, 0x08, 0xe7, 0xbe, 0x88, 0xe5, 0x60, 0xee, 0xed, 0x7a, 0xbd,
-  0x7e, 0x75, 0xff, 0x2b, 0x04, 0x00, 0xba, 0x8d, 0x30, 0x0e, 0x00, 0xd8,
-  0x17, 0x4d, 0x01, 0xdc, 0x9f, 0xef, 0xe4, 0xf7, 0x96, 0x4b, 0x85, 0x18,
-  0x1f, 0x79, 0xe2, 0x51, 0x00, 0x67, 0xdb, 0x29, 0x9d, 0x6a, 0x35, 0x98,
-  0xfb, 0xf4, 0xf6, 0x83, 0x98, 0xad, 0xd6, 0x76, 0xfa, 0xdb, 0xe7, 0xe2,
-  0xfb, 0x8e, 0xb9, 0x77, 0xf6, 0xbf, 0x3a, 0x00, 0xa0, 0x1b, 0x08, 0xe3,
-  0x00, 0x80, 0x5d, 0xdb, 0x4b, 0x00, 0x77, 0x72, 0x64, 0x20, 0x8e, 0x0d,
-  0x95, 0xe2, 0xe4, 0x91, 0x81, 0xa8, 0x1c, 0xe8, 0x6f, 0x4b, 0x7d, 0xd0,
-  0x4e, 0xb5, 0x85, 0xa5, 0x95, 0x60, 0xee, 0x9b, 0xb8, 0x79, 0x77, 0x7e,
-  0xa7, 0xd3, 0x5a, 0x05, 0x73, 0x00, 0x90, 0x53, 0xc2, 0x38, 0x00, 0x60,
-  0xc7, 0x92, 0x24, 0xb9, 0x18, 0x3b, 0x0c, 0xe0, 0xca, 0xa5, 0xc2, 0x72,
-  0xf8, 0x36, 0xf2, 0x44, 0x8c, 0x8f, 0x0c, 0xb4, 0xad, 0x36, 0xc8, 0xca,
-  0xea, 0x96, 0xd6, 0xe9, 0x99, 0xfb, 0x3b, 0xed, 0x9a, 0x13, 0xcc, 0x01,
-  0x40, 0x8e, 0x08, 0xe3, 0x00, 0x80, 0x6d, 0x49, 0x92, 0xe4, 0x5c, 0x44,
-  0x5c, 0x8c, 0xe5, 0x10, 0x6e, 0x5b, 0x67, 0xc0, 0xad, 0x6e, 0x3f, 0x9d,
-  0x18, 0x3d, 0x18, 0xc3, 0xe5, 0x62, 0x1b, 0xab, 0x83, 0xce, 0x52, 0x5b,
-  0x58, 0x8a, 0xeb, 0xb7, 0xbf, 0x89, 0xeb, 0x77, 0x1e, 0xec, 0xf4, 0xac,
-  0x39, 0xc1, 0x1c, 0x00, 0xf4, 0x38, 0x61, 0x1c, 0x00, 0xb0, 0xa1, 0x24,
-  0x49, 0xc6, 0x62, 0x39, 0x80, 0xbb, 0x18, 0xdb, 0x9c, 0x82, 0x3a, 0x5c,
-  0x2e, 0xc6, 0xc9, 0x91, 0x81, 0x18, 0x1f, 0x19, 0x10, 0xc0, 0xc1, 0x8a,
-  0xeb, 0xb7, 0x1f, 0xc4, 0xa7, 0xb7, 0xbf, 0x89, 0xeb, 0xb7, 0x1f, 0xec,
-  0x34, 0x98, 0x7b, 0x3b, 0x0c, 0x7f, 0x00, 0x80, 0x9e, 0x22, 0x8c, 0x03,
-  0x00, 0xd6, 0x59, 0xd9, 0x86, 0x7a, 0x31, 0x22, 0x5e, 0xda, 0xce, 0xf3,
-  0x57, 0x3b, 0xe0, 0xce, 0x9e, 0xa8, 0x38, 0xff, 0x0d, 0xb6, 0xb0, 0x1a,
-  0xcc, 0xed, 0xf0, 0x9c, 0xb9, 0x2f, 0x22, 0xe2, 0xad, 0x58, 0xee, 0x98,
-  0xfb, 0xbc, 0x6d, 0xc5, 0x01, 0x00, 0x6d, 0x27, 0x8c, 0x03, 0x00, 0x22,
-  0xe2, 0x51, 0x17, 0xdc, 0x1b, 0xb1, 0x1c, 0xc2, 0x6d, 0xb9, 0x0d, 0xd5,
-  0x16, 0x54, 0xd8, 0xbb, 0xd9, 0x6a, 0x2d, 0xae, 0x7c, 0x76, 0x6f, 0xa7,
-  0x1d, 0x73, 0xef, 0xc7, 0x72, 0xb7, 0xdc, 0xdb, 0xed, 0xab, 0x0c, 0x00,
-  0x68, 0x17, 0x61, 0x1c, 0x00, 0xe4, 0xdc, 0x4e, 0xba, 0xe0, 0x8a, 0x85,
-  0xbe, 0x18, 0x1f, 0x19, 0x88, 0x89, 0xd1, 0x72, 0x8c, 0x0e, 0x95, 0xda,
-  0x5d, 0x1a, 0xe4, 0xca, 0x2e, 0xb6, 0xb2, 0xae, 0x9e, 0x2f, 0xf7, 0x96,
-  0x6d, 0xac, 0x00, 0xd0, 0x3d, 0x84, 0x71, 0x00, 0x90, 0x43, 0x3b, 0x3d,
-  0x0b, 0x6e, 0x74, 0xa8, 0x14, 0x13, 0x47, 0x0f, 0xc6, 0xf8, 0xc8, 0x13,
-  0x51, 0xec, 0xef, 0x6b, 0x6b, 0x6d, 0xc0, 0x72, 0x30, 0x37, 0x7d, 0xab,
-  0x1a, 0x9f, 0xde, 0x7e, 0xb0, 0xdd, 0xdf, 0xf2, 0x51, 0x7c, 0xbf, 0x8d,
-  0xf5, 0x5e, 0xfb, 0x2a, 0x03, 0x00, 0xf6, 0x4a, 0x18, 0x07, 0x00, 0x39,
-  0xd2, 0x30, 0x11, 0xf5, 0xf5, 0xad, 0x9e, 0x5b, 0x2e, 0x15, 0x62, 0x62,
-  0xb4, 0x1c, 0x13, 0x47, 0x0f, 0x3a, 0x07, 0x0e, 0x32, 0xb2, 0x3a, 0x95,
-  0xf5, 0xca, 0x8d, 0xb9, 0x98, 0xad, 0xd6, 0xb6, 0xf3, 0x5b, 0x74, 0xcb,
-  0x01, 0x40, 0x87, 0x13, 0xc6, 0x01, 0x40, 0x0e, 0xec, 0x64, 0x2b, 0xea,
-  0xc9, 0x91, 0x81, 0x98, 0x38, 0x5a, 0x8e, 0xf1, 0x91, 0x81, 0x76, 0x97,
-  0x05, 0xec, 0xc0, 0xdc, 0xc3, 0x85, 0xb8, 0x72, 0x63, 0x2e, 0xae, 0xdf,
-  0xfe, 0x66, 0xbb, 0x83, 0x1f, 0x3e, 0x8a, 0xe5, 0x50, 0xee, 0xed, 0xf6,
-  0x56, 0x06, 0x00, 0xec, 0x84, 0x30, 0x0e, 0x00, 0x7a, 0x54, 0x92, 0x24,
-  0x83, 0x11, 0xf1, 0x4a, 0x44, 0xbc, 0x19, 0x5b, 0x6c, 0x45, 0x2d, 0x16,
-  0xfa, 0xe2, 0xec, 0x33, 0x83, 0xba, 0xe0, 0xa0, 0x4b, 0xec, 0x70, 0x1b,
-  0xeb, 0x5c, 0x2c, 0x6f, 0x61, 0x7d, 0xdb, 0x24, 0x56, 0x00, 0xc8, 0x9e,
-  0x30, 0x0e, 0x00, 0x7a, 0xcc, 0x4a, 0x08, 0xf7, 0xc6, 0xca, 0x3f, 0x9b,
-  0x4e, 0x45, 0x5d, 0x3d, 0x0b, 0x6e, 0x62, 0xb4, 0x9c, 0x4a, 0x6d, 0xc0,
-  0xfe, 0xaa, 0x2d, 0x2c, 0xc5, 0xf4, 0xad, 0x6a, 0x7c, 0xf8, 0xd9, 0xbd,
-  0xed, 0x76, 0xcb, 0xfd, 0x22, 0x96, 0x43, 0xb9, 0x4b, 0xed, 0xad, 0x0c,
-  0x00, 0xd8, 0x88, 0x30, 0x0e, 0x00, 0x7a, 0xc4, 0x4e, 0x42, 0xb8, 0x89,
-  0xa3, 0x07, 0xe3, 0xec, 0x33, 0x83, 0x31, 0x5c, 0x2e, 0xa6, 0x52, 0x1b,
-  0xd0, 0x7e, 0x33, 0x77, 0xe7, 0x63, 0x7a, 0xa6, 0x1a, 0xd3, 0xb7, 0xee,
-  0x6f, 0xe7, 0xe9, 0xef, 0xc7, 0x72, 0x28, 0xf7, 0x76, 0x7b, 0xab, 0x02,
-  0x00, 0x9a, 0x09, 0xe3, 0x00, 0xa0, 0xcb, 0xad, 0x4c, 0x46, 0x7d, 0x33,
-  0xb6, 0x18, 0xca, 0x60, 0x2b, 0x2a, 0xe4, 0xc3, 0xdc, 0xc3, 0x85, 0x98,
-  0xbe, 0x75, 0x3f, 0xa6, 0x67, 0xaa, 0xdb, 0xe9, 0x96, 0xfb, 0x22, 0x96,
-  0x5f, 0x3f, 0x4c, 0x61, 0x05, 0x80, 0x94, 0x08, 0xe3, 0x00, 0xa0, 0x4b,
-  0x6d, 0x37, 0x84, 0x2b, 0x97, 0x0a, 0x31, 0x75, 0xea, 0x50, 0x8c, 0x8f,
-  0x3c, 0x11, 0xc5, 0xfe, 0xbe, 0x14, 0x2a, 0x03, 0x3a, 0xc5, 0x6a, 0xa7,
-  0xdc, 0xcc, 0xdd, 0xf9, 0xad, 0x9e, 0xba, 0x7a, 0xae, 0xdc, 0x5b, 0x42,
-  0x39, 0x00, 0x68, 0x2f, 0x61, 0x1c, 0x00, 0x74, 0x99, 0x95, 0xed, 0xa8,
-  0x6f, 0x46, 0xc4, 0x5f, 0x6e, 0xf6, 0xbc, 0xd5, 0x10, 0xce, 0x79, 0x70,
-  0xc0, 0x0e, 0xb6, 0xb0, 0x1a, 0xf6, 0x00, 0x00, 0x6d, 0x26, 0x8c, 0x03,
-  0x80, 0x2e, 0xb1, 0xdd, 0x33, 0xe1, 0x46, 0x87, 0x4a, 0x31, 0x75, 0xea,
-  0x50, 0x8c, 0x0e, 0x95, 0x52, 0xab, 0x0d, 0xe8, 0x0e, 0xab, 0x5b, 0x58,
-  0xaf, 0x7c, 0x76, 0x2f, 0x6a, 0x8b, 0x4b, 0x5b, 0x3d, 0xfd, 0x17, 0x11,
-  0xf1, 0xa6, 0x50, 0x0e, 0x00, 0xf6, 0x97, 0x30, 0x0e, 0x00, 0x3a, 0x9c,
-  0x10, 0x0e, 0xd8, 0x6f, 0x3b, 0x9c, 0xc2, 0x2a, 0x94, 0x03, 0x80, 0x7d,
-  0x24, 0x8c, 0x03, 0x80, 0x0e, 0x96, 0x24, 0xc9, 0xc5, 0x58, 0xde, 0x92,
-  0x7a, 0x7c, 0xa3, 0xe7, 0x08, 0xe1, 0x80, 0xbd, 0x98, 0x9e, 0xa9, 0xc6,
-  0xe5, 0x6b, 0x5f, 0x0b, 0xe5, 0x00, 0x20, 0x25, 0xc2, 0x38, 0x00, 0xe8,
-  0x40, 0x49, 0x92, 0x9c, 0x8b, 0xe5, 0x73, 0x9b, 0xce, 0x6c, 0xf4, 0x1c,
-  0x21, 0x1c, 0xb0, 0x9f, 0xae, 0xdf, 0x7e, 0x10, 0x57, 0x6e, 0xdc, 0xdb,
-  0xce, 0xb0, 0x07, 0xa1, 0x1c, 0x00, 0xec, 0x81, 0x30, 0x0e, 0x00, 0x3a,
-  0xc8, 0xca, 0x84, 0xd4, 0xb7, 0x23, 0xe2, 0xa5, 0x8d, 0x9e, 0x53, 0x2e,
-  0x15, 0xe2, 0xfc, 0xe9, 0x27, 0x63, 0x7c, 0x64, 0x20, 0xa5, 0xaa, 0x80,
-  0x3c, 0x99, 0xb9, 0x3b, 0x1f, 0x97, 0xaf, 0x7d, 0xbd, 0x55, 0x28, 0x67,
-  0xfa, 0x2a, 0x00, 0xec, 0x92, 0x30, 0x0e, 0x00, 0x3a, 0xc0, 0x76, 0x26,
-  0xa4, 0x9a, 0x8e, 0x0a, 0xa4, 0x49, 0x28, 0x07, 0x00, 0xed, 0x21, 0x8c,
-  0x03, 0x80, 0x8c, 0xad, 0x9c, 0x0b, 0xf7, 0x56, 0x6c, 0x30, 0x9c, 0xa1,
-  0x58, 0xe8, 0x8b, 0xb3, 0xcf, 0x0c, 0xc6, 0x73, 0x27, 0x06, 0xa3, 0xd8,
-  0xdf, 0x97, 0x6a, 0x6d, 0x00, 0xdb, 0x0c, 0xe5, 0xbe, 0x88, 0xe5, 0xad,
-  0xab, 0x6f, 0xa7, 0x53, 0x15, 0x00, 0x74, 0x2f, 0x61, 0x1c, 0x00, 0x64,
-  0x24, 0x49, 0x92, 0xc9, 0x58, 0x0e, 0xe1, 0x36, 0xdc, 0x92, 0x7a, 0xf6,
-  0xc4, 0x60, 0x4c, 0x9d, 0x3a, 0x24, 0x84, 0x03, 0x32, 0xb7, 0x83, 0x50,
-  0xee, 0x62, 0xbd, 0x5e, 0xbf, 0x94, 0x4e, 0x55, 0x00, 0xd0, 0x7d, 0x84,
-  0x71, 0x00, 0x90, 0xb2, 0xed, 0x6c, 0x49, 0x1d, 0x1d, 0x2a, 0xc5, 0x85,
-  0x33, 0xc3, 0x51, 0x39, 0xd0, 0x9f, 0x5a, 0x5d, 0x00, 0xdb, 0x71, 0xfd,
-  0xf6, 0x83, 0x78, 0xef, 0x93, 0xdf, 0x6f, 0x35, 0x7d, 0xf5, 0xfd, 0x88,
-  0x78, 0xa3, 0x5e, 0xaf, 0x5f, 0x4d, 0xa9, 0x2c, 0x00, 0xe8, 0x1a, 0xc2,
-  0x38, 0x00, 0x48, 0x51, 0x92, 0x24, 0xaf, 0xc4, 0xf2, 0x80, 0x86, 0x96,
-  0x5b, 0x52, 0xcb, 0xa5, 0x42, 0xbc, 0x3c, 0x79, 0xc4, 0x84, 0x54, 0xa0,
-  0xe3, 0x4d, 0xcf, 0x54, 0xe3, 0xf2, 0xb5, 0xaf, 0xb7, 0x0a, 0xe5, 0xfe,
-  0x2e, 0x96, 0xb7, 0xaf, 0x3a, 0x4f, 0x0e, 0x00, 0x56, 0x08, 0xe3, 0x00,
-  0x20, 0x05, 0x2b, 0x53, 0x52, 0xdf, 0x8a, 0x88, 0x3f, 0x6f, 0xf5, 0xf8,
-  0xea, 0xb9, 0x70, 0x53, 0xa7, 0x0e, 0xa5, 0x59, 0x16, 0xc0, 0x9e, 0x5d,
-  0xbe, 0xf6, 0x75, 0x5c, 0xf9, 0xec, 0x5e, 0xd4, 0x16, 0x97, 0x36, 0x7a,
-  0xca, 0x5c, 0x2c, 0x07, 0x72, 0x6f, 0xa5, 0x58, 0x16, 0x00, 0x74, 0x2c,
-  0x61, 0x1c, 0x00, 0xb4, 0x59, 0x92, 0x24, 0x6f, 0xc4, 0xf2, 0xb6, 0xd4,
-  0x96, 0xdd, 0x70, 0x27, 0x47, 0x06, 0xe2, 0xfc, 0x1f, 0x1c, 0xb6, 0x25,
-  0x15, 0xe8, 0x5a, 0xb5, 0x85, 0xa5, 0xe5, 0x50, 0xee, 0xc6, 0xa6, 0x0d,
-  0x70, 0x1f, 0xc5, 0xf2, 0xd6, 0xd5, 0x4b, 0xe9, 0x54, 0x05, 0x00, 0x9d,
-  0x49, 0x18, 0x07, 0x00, 0x6d, 0xb2, 0xd2, 0x0d, 0xf7, 0x76, 0x6c, 0x30,
-  0xa0, 0xc1, 0x96, 0x54, 0xa0, 0xd7, 0xcc, 0x3d, 0x5c, 0x88, 0x77, 0x3f,
-  0x9a, 0xdd, 0x6a, 0xc8, 0xc3, 0x2f, 0x62, 0x39, 0x94, 0xb3, 0x75, 0x15,
-  0x80, 0x5c, 0x12, 0xc6, 0x01, 0x40, 0x1b, 0x6c, 0xd5, 0x0d, 0xf7, 0xe2,
-  0xa9, 0x43, 0xf1, 0xdc, 0x89, 0x41, 0x53, 0x52, 0x81, 0x9e, 0x34, 0x73,
-  0x77, 0x3e, 0x7e, 0x73, 0xf5, 0xce, 0x66, 0xe7, 0xc9, 0xd9, 0xba, 0x0a,
-  0x40, 0x6e, 0x09, 0xe3, 0x00, 0x60, 0x1f, 0x6d, 0xd5, 0x0d, 0x37, 0x5c,
-  0x2e, 0xc6, 0x85, 0xc9, 0xe1, 0x18, 0x2e, 0x17, 0x53, 0xac, 0x0a, 0x20,
-  0x1b, 0x57, 0x6e, 0xdc, 0x8b, 0xcb, 0xff, 0xf2, 0xf5, 0x66, 0xe7, 0xc9,
-  0x7d, 0x14, 0x11, 0x17, 0x4d, 0x5d, 0x05, 0x20, 0x4f, 0x84, 0x71, 0x00,
-  0xb0, 0x4f, 0x36, 0xeb, 0x86, 0x2b, 0x16, 0xfa, 0x62, 0xea, 0x87, 0x87,
-  0xe2, 0xec, 0x89, 0xc1, 0xd4, 0xeb, 0x02, 0xc8, 0x52, 0x6d, 0x61, 0x29,
-  0xde, 0xfb, 0xe4, 0xf7, 0x31, 0x7d, 0xeb, 0xfe, 0x66, 0x4f, 0xfb, 0xeb,
-  0x88, 0x78, 0xcb, 0xd6, 0x55, 0x00, 0xf2, 0x40, 0x18, 0x07, 0x00, 0x7b,
-  0x94, 0x24, 0xc9, 0x60, 0x2c, 0x77, 0xc3, 0xb5, 0x9c, 0x94, 0x3a, 0x3a,
-  0x54, 0x8a, 0x0b, 0x67, 0x86, 0x0d, 0x68, 0x00, 0x72, 0x6d, 0xe6, 0xee,
-  0x7c, 0xbc, 0xf7, 0xc9, 0x57, 0x31, 0x5b, 0xad, 0x6d, 0xf4, 0x94, 0x2f,
-  0x62, 0xb9, 0x4b, 0xee, 0x52, 0x7a, 0x55, 0x01, 0x40, 0xfa, 0x84, 0x71,
-  0x00, 0xb0, 0x07, 0x49, 0x92, 0x9c, 0x8b, 0x88, 0x77, 0x42, 0x37, 0x1c,
-  0xc0, 0xb6, 0x6c, 0x63, 0xeb, 0xea, 0xdf, 0xc5, 0xf2, 0x79, 0x72, 0xba,
-  0xe4, 0x00, 0xe8, 0x49, 0xc2, 0x38, 0x00, 0xd8, 0xa5, 0x24, 0x49, 0xde,
-  0x8a, 0x88, 0xbf, 0x6c, 0xf5, 0x98, 0xb3, 0xe1, 0x00, 0x36, 0x36, 0xf7,
-  0x70, 0x21, 0xde, 0xfb, 0x2f, 0x5f, 0xc5, 0xa7, 0xb7, 0x1f, 0x6c, 0xf4,
-  0x14, 0x5d, 0x72, 0x00, 0xf4, 0x2c, 0x61, 0x1c, 0x00, 0xec, 0xd0, 0xca,
-  0x90, 0x86, 0x77, 0x22, 0xe2, 0x4c, 0xab, 0xc7, 0x5f, 0x3c, 0x75, 0x28,
-  0xa6, 0x4e, 0x1d, 0x4a, 0xb3, 0x24, 0x80, 0xae, 0x74, 0xfd, 0xf6, 0x83,
-  0x78, 0xf7, 0xea, 0x1d, 0x5d, 0x72, 0x00, 0xe4, 0x8a, 0x30, 0x0e, 0x00,
-  0x76, 0x20, 0x49, 0x92, 0x57, 0x62, 0xf9, 0x7c, 0xb8, 0x75, 0xdb, 0x52,
-  0xcb, 0xa5, 0x42, 0xbc, 0xfa, 0xfc, 0x53, 0xba, 0xe1, 0x00, 0x76, 0x60,
-  0x1b, 0x03, 0x1e, 0x74, 0xc9, 0x01, 0xd0, 0x53, 0x84, 0x71, 0x00, 0xb0,
-  0x4d, 0x9b, 0x6d, 0x4b, 0x9d, 0x38, 0x7a, 0x30, 0xce, 0x9f, 0x7e, 0x32,
-  0x8a, 0xfd, 0x7d, 0x29, 0x57, 0x05, 0xd0, 0x1b, 0x66, 0xee, 0xce, 0xc7,
-  0x6f, 0xae, 0xde, 0x89, 0xea, 0xfc, 0xe2, 0x46, 0x4f, 0xf9, 0xeb, 0x7a,
-  0xbd, 0xfe, 0x66, 0x8a, 0x25, 0x01, 0x40, 0x5b, 0x08, 0xe3, 0x00, 0x60,
-  0x0b, 0x9b, 0x6d, 0x4b, 0x2d, 0x16, 0xfa, 0xe2, 0xfc, 0xe9, 0xc3, 0x31,
-  0x31, 0x5a, 0x4e, 0xbb, 0x2c, 0x80, 0x9e, 0x53, 0x5b, 0x58, 0x8a, 0xcb,
-  0xd7, 0xbe, 0x8e, 0x2b, 0x37, 0x36, 0xdc, 0x95, 0xfa, 0x51, 0x2c, 0x77,
-  0xc9, 0x5d, 0x4d, 0xb1, 0x2c, 0x00, 0xd8, 0x57, 0xc2, 0x38, 0x00, 0xd8,
-  0xc4, 0x66, 0xd3, 0x52, 0x0d, 0x69, 0x00, 0x68, 0x8f, 0x2d, 0xce, 0x92,
-  0x9b, 0x8b, 0x88, 0x37, 0xea, 0xf5, 0xfa, 0xdb, 0xe9, 0x56, 0x05, 0x00,
-  0xfb, 0x43, 0x18, 0x07, 0x00, 0x1b, 0x48, 0x92, 0xe4, 0x8d, 0x88, 0xf8,
-  0xdb, 0x56, 0x8f, 0xd9, 0x96, 0x0a, 0xd0, 0x5e, 0xb5, 0x85, 0xa5, 0xf8,
-  0xcd, 0x47, 0x77, 0x36, 0x9b, 0xb8, 0xfa, 0x7f, 0xc4, 0x72, 0x97, 0x9c,
-  0xe1, 0x0e, 0x00, 0x74, 0x15, 0x61, 0x1c, 0x00, 0x34, 0x49, 0x92, 0x64,
-  0x30, 0x22, 0xde, 0x8a, 0x88, 0xd7, 0x9b, 0x1f, 0xb3, 0x2d, 0x15, 0x20,
-  0x5d, 0xd3, 0x33, 0xd5, 0x78, 0xef, 0x93, 0xaf, 0x36, 0xea, 0x92, 0xfb,
-  0x22, 0x22, 0x5e, 0xb1, 0x6d, 0x15, 0x80, 0x6e, 0x22, 0x8c, 0x03, 0x80,
-  0x06, 0x2b, 0x41, 0xdc, 0xa5, 0x68, 0x71, 0x3e, 0x9c, 0x6d, 0xa9, 0x00,
-  0xd9, 0x98, 0x7b, 0xb8, 0x10, 0xef, 0x7c, 0x78, 0x3b, 0x66, 0xab, 0xb5,
-  0x8d, 0x9e, 0xf2, 0xef, 0xea, 0xf5, 0xfa, 0x5b, 0x69, 0xd6, 0x04, 0x00,
-  0xbb, 0x25, 0x8c, 0x03, 0x80, 0x15, 0x49, 0x92, 0x4c, 0xc6, 0x72, 0x10,
-  0xb7, 0xee, 0x7c, 0xb8, 0x93, 0x23, 0x03, 0xf1, 0xf2, 0x99, 0x23, 0xb6,
-  0xa5, 0x02, 0x64, 0xe8, 0xf2, 0xb5, 0xaf, 0xe3, 0xb7, 0xd7, 0xbe, 0xde,
-  0xe8, 0x61, 0xdb, 0x56, 0x01, 0xe8, 0x0a, 0xc2, 0x38, 0x00, 0x88, 0x88,
-  0x24, 0x49, 0x2e, 0xc6, 0xf2, 0xd6, 0xd4, 0x75, 0x41, 0xdc, 0x8b, 0xa7,
-  0x0e, 0xc5, 0xd4, 0xa9, 0x43, 0xa9, 0xd7, 0x04, 0xc0, 0x7a, 0x33, 0x77,
-  0xe7, 0xe3, 0x57, 0x1f, 0x7c, 0x69, 0xdb, 0x2a, 0x00, 0x5d, 0x4b, 0x18,
-  0x07, 0x40, 0xee, 0x25, 0x49, 0xf2, 0x66, 0x44, 0xfc, 0x55, 0xf3, 0xba,
-  0xf3, 0xe1, 0x00, 0x3a, 0x53, 0x6d, 0x61, 0x29, 0x7e, 0xf5, 0xe1, 0x97,
-  0x31, 0x73, 0x77, 0xbe, 0xd5, 0xc3, 0xa6, 0xad, 0x02, 0xd0, 0xd1, 0x84,
-  0x71, 0x00, 0xe4, 0x5a, 0x92, 0x24, 0x6f, 0x47, 0x8b, 0x41, 0x0d, 0xe5,
-  0x52, 0x21, 0x5e, 0x7d, 0xfe, 0x29, 0xe7, 0xc3, 0x01, 0x74, 0xb0, 0x2d,
-  0xb6, 0xad, 0xfe, 0x5d, 0xbd, 0x5e, 0x7f, 0x23, 0xcd, 0x7a, 0x00, 0x60,
-  0x3b, 0x84, 0x71, 0x00, 0xe4, 0xd2, 0xca, 0xa0, 0x86, 0x77, 0x22, 0xe2,
-  0xa5, 0xe6, 0xc7, 0x86, 0xcb, 0xc5, 0x78, 0xed, 0x85, 0xa7, 0x9d, 0x0f,
-  0x07, 0xd0, 0x05, 0xb6, 0xd8, 0xb6, 0xfa, 0x7e, 0x2c, 0x6f, 0x5b, 0x75,
-  0x8e, 0x1c, 0x00, 0x1d, 0x43, 0x18, 0x07, 0x40, 0xee, 0x6c, 0x36, 0x31,
-  0x75, 0xe2, 0xe8, 0xc1, 0x38, 0x7f, 0xfa, 0x49, 0x41, 0x1c, 0x40, 0x17,
-  0xa9, 0x2d, 0x2c, 0xc5, 0x2f, 0xff, 0xf9, 0x77, 0x1b, 0x4d, 0x5b, 0x75,
-  0x8e, 0x1c, 0x00, 0x1d, 0x45, 0x18, 0x07, 0x40, 0xae, 0xac, 0x4c, 0x4c,
-  0x7d, 0x27, 0x22, 0x8e, 0x37, 0x3f, 0x76, 0xf6, 0xc4, 0x60, 0x9c, 0x3f,
-  0x7d, 0x38, 0xfd, 0xa2, 0x00, 0xd8, 0x17, 0xef, 0x5e, 0xbd, 0x13, 0xd3,
-  0xb7, 0xee, 0xb7, 0x7a, 0x68, 0x2e, 0x96, 0x27, 0xad, 0xbe, 0x93, 0x72,
-  0x49, 0x00, 0xb0, 0x8e, 0x30, 0x0e, 0x80, 0xdc, 0x58, 0x09, 0xe2, 0x2e,
-  0x45, 0x8b, 0x89, 0xa9, 0x17, 0xce, 0x0c, 0x1b, 0xd4, 0x00, 0xd0, 0x03,
-  0xa6, 0x67, 0xaa, 0xf1, 0xee, 0x47, 0xb3, 0x1b, 0x3d, 0xfc, 0xef, 0xea,
-  0xf5, 0xfa, 0x5b, 0x69, 0xd6, 0x03, 0x00, 0xcd, 0x84, 0x71, 0x00, 0xe4,
-  0xc2, 0x46, 0x41, 0x5c, 0xb1, 0xd0, 0x17, 0x17, 0x26, 0x8f, 0xc4, 0xf8,
-  0xc8, 0x40, 0x26, 0x75, 0x01, 0xb0, 0xff, 0x66, 0xab, 0xb5, 0xf8, 0xe5,
-  0x6f, 0x7f, 0xb7, 0xd1, 0x39, 0x72, 0xbf, 0xa8, 0xd7, 0xeb, 0x17, 0x53,
-  0x2e, 0x09, 0x00, 0x1e, 0x11, 0xc6, 0x01, 0xd0, 0xf3, 0x92, 0x24, 0xb9,
-  0x18, 0x11, 0x6f, 0x45, 0x8b, 0x20, 0xee, 0xb5, 0x17, 0x9f, 0x36, 0x31,
-  0x15, 0xa0, 0x07, 0x6d, 0x71, 0x8e, 0x9c, 0xc1, 0x0e, 0x00, 0x64, 0x46,
-  0x18, 0x07, 0x40, 0x4f, 0x5b, 0x09, 0xe2, 0x7e, 0xde, 0xbc, 0x2e, 0x88,
-  0x03, 0xe8, 0x7d, 0xb5, 0x85, 0xa5, 0x78, 0xef, 0x93, 0xdf, 0x6f, 0x74,
-  0x8e, 0xdc, 0x47, 0x11, 0x71, 0x4e, 0x20, 0x07, 0x40, 0xda, 0x84, 0x71,
-  0x00, 0xf4, 0xac, 0x8d, 0x82, 0xb8, 0xe1, 0x72, 0x31, 0x5e, 0x7b, 0xe1,
-  0x69, 0x13, 0x53, 0x01, 0x72, 0xe2, 0xbd, 0x4f, 0xbe, 0x8a, 0x2b, 0x37,
-  0x5a, 0x66, 0x6e, 0x26, 0xad, 0x02, 0x90, 0x3a, 0x61, 0x1c, 0x00, 0x3d,
-  0x49, 0x10, 0x07, 0x40, 0xa3, 0x4d, 0x06, 0x3b, 0xcc, 0xc5, 0x72, 0x87,
-  0x9c, 0x40, 0x0e, 0x80, 0x54, 0x08, 0xe3, 0x00, 0xe8, 0x39, 0x82, 0x38,
-  0x00, 0x5a, 0x99, 0xb9, 0x3b, 0x1f, 0xbf, 0xfa, 0xe0, 0xcb, 0x56, 0x83,
-  0x1d, 0xe6, 0x22, 0xe2, 0x62, 0xbd, 0x5e, 0x7f, 0x27, 0x83, 0xb2, 0x00,
-  0xc8, 0x19, 0x61, 0x1c, 0x00, 0x3d, 0x45, 0x10, 0x07, 0xc0, 0x66, 0xb6,
-  0x98, 0xb4, 0xfa, 0xdf, 0xd7, 0xeb, 0xf5, 0xb7, 0x53, 0x2e, 0x09, 0x80,
-  0x9c, 0x11, 0xc6, 0x01, 0xd0, 0x33, 0x04, 0x71, 0x00, 0x6c, 0xc7, 0xdc,
-  0xc3, 0x85, 0x78, 0xe7, 0xc3, 0xdb, 0x1b, 0x4d, 0x5a, 0x15, 0xc8, 0x01,
-  0xd0, 0x56, 0xc2, 0x38, 0x00, 0x7a, 0x82, 0x20, 0x0e, 0x80, 0x9d, 0xa8,
-  0x2d, 0x2c, 0xc5, 0x2f, 0xff, 0xf9, 0x77, 0x02, 0x39, 0x00, 0x52, 0xe7,
-  0xce, 0x04, 0x80, 0xae, 0x27, 0x88, 0x03, 0x60, 0xa7, 0x8a, 0xfd, 0x7d,
-  0xf1, 0xda, 0x0b, 0x4f, 0xc7, 0x70, 0xb9, 0xd8, 0xea, 0xe1, 0x9f, 0x27,
-  0x49, 0xf2, 0x46, 0xda, 0x35, 0x01, 0x90, 0x0f, 0x3a, 0xe3, 0x00, 0xe8,
-  0x6a, 0x49, 0x92, 0x9c, 0x8b, 0x88, 0xff, 0xb7, 0x79, 0x5d, 0x10, 0x07,
-  0xc0, 0x76, 0xbd, 0x7b, 0xf5, 0x4e, 0x4c, 0xdf, 0xba, 0xdf, 0xea, 0xa1,
-  0x5f, 0xd4, 0xeb, 0xf5, 0x8b, 0x29, 0x97, 0x03, 0x40, 0x8f, 0x73, 0x87,
-  0x02, 0x40, 0xd7, 0x4a, 0x92, 0x64, 0x32, 0x22, 0xd6, 0x4d, 0xbe, 0x13,
-  0xc4, 0x01, 0xb0, 0x13, 0x17, 0x26, 0x8f, 0xc4, 0xc4, 0xd1, 0x83, 0xad,
-  0x1e, 0x7a, 0x3d, 0x49, 0x92, 0xb7, 0x53, 0x2e, 0x07, 0x80, 0x1e, 0xe7,
-  0x2e, 0x05, 0x80, 0xae, 0xb4, 0x12, 0xc4, 0x5d, 0x8a, 0x88, 0x4a, 0xe3,
-  0xba, 0x20, 0x0e, 0x80, 0xdd, 0x10, 0xc8, 0x01, 0x90, 0x16, 0xdb, 0x54,
-  0x01, 0xe8, 0x3a, 0x49, 0x92, 0x8c, 0x45, 0xc4, 0xd5, 0x10, 0xc4, 0x01,
-  0xb0, 0xcf, 0x6c, 0x59, 0x05, 0xa0, 0xdd, 0xdc, 0xad, 0x00, 0xd0, 0x55,
-  0x92, 0x24, 0x19, 0x8c, 0xe5, 0xad, 0xa9, 0x82, 0x38, 0x00, 0xf6, 0xdd,
-  0x16, 0x1d, 0x72, 0x17, 0x53, 0x2e, 0x07, 0x80, 0x1e, 0xe4, 0x8e, 0x05,
-  0x80, 0xae, 0xb1, 0x12, 0xc4, 0x5d, 0x8a, 0x88, 0x33, 0x8d, 0xeb, 0xc5,
-  0x42, 0x5f, 0x5c, 0x98, 0x1c, 0x16, 0xc4, 0x01, 0xb0, 0x2f, 0x36, 0x09,
-  0xe4, 0x7e, 0x2e, 0x90, 0x03, 0x60, 0xaf, 0xdc, 0xb5, 0x00, 0xd0, 0x4d,
-  0xde, 0x8a, 0x16, 0x41, 0xdc, 0x6b, 0x2f, 0x3e, 0x1d, 0xc3, 0xe5, 0x62,
-  0x46, 0x25, 0x01, 0xd0, 0x8b, 0x04, 0x72, 0x00, 0xb4, 0x8b, 0x30, 0x0e,
-  0x80, 0xae, 0x90, 0x24, 0xc9, 0x5b, 0x11, 0xf1, 0x7a, 0xf3, 0xfa, 0xab,
-  0xcf, 0x3f, 0x25, 0x88, 0x03, 0xa0, 0x2d, 0x04, 0x72, 0x00, 0xb4, 0x83,
-  0x01, 0x0e, 0x00, 0x74, 0xbc, 0x95, 0x1b, 0x9e, 0x9f, 0x37, 0xaf, 0x5f,
-  0x38, 0x33, 0x1c, 0x13, 0xa3, 0xe5, 0xf4, 0x0b, 0x02, 0x20, 0x57, 0x36,
-  0x19, 0xea, 0xf0, 0x6f, 0xea, 0xf5, 0xfa, 0xa5, 0x94, 0xcb, 0x01, 0xa0,
-  0xcb, 0x09, 0xe3, 0x00, 0xe8, 0x68, 0x49, 0x92, 0x4c, 0x46, 0xc4, 0x7f,
-  0x6a, 0x5e, 0x3f, 0x7f, 0xfa, 0x70, 0x9c, 0x3d, 0x31, 0x98, 0x41, 0x45,
-  0x00, 0xe4, 0xd1, 0x06, 0x81, 0xdc, 0x5c, 0x44, 0x9c, 0xab, 0xd7, 0xeb,
-  0x57, 0x33, 0x28, 0x09, 0x80, 0x2e, 0x65, 0x9b, 0x2a, 0x00, 0x1d, 0x2b,
-  0x49, 0x92, 0xb1, 0x58, 0x1e, 0xd8, 0xb0, 0xc6, 0xc4, 0xd1, 0x83, 0x82,
-  0x38, 0x00, 0x52, 0x75, 0xfe, 0xf4, 0x93, 0xad, 0x8e, 0x45, 0xa8, 0x44,
-  0xc4, 0xa5, 0x95, 0x1f, 0x1c, 0x01, 0xc0, 0xb6, 0x08, 0xe3, 0x00, 0xe8,
-  0x48, 0x2b, 0x93, 0x53, 0xdf, 0x89, 0xe5, 0x1b, 0x9d, 0x47, 0x86, 0xcb,
-  0xc5, 0xb8, 0x30, 0x79, 0x24, 0x9b, 0xa2, 0x00, 0xc8, 0xad, 0x62, 0x7f,
-  0x5f, 0xbc, 0xf6, 0x42, 0xcb, 0x81, 0x41, 0x95, 0x88, 0x78, 0x7b, 0xe5,
-  0x7d, 0x0b, 0x00, 0xb6, 0x24, 0x8c, 0x03, 0xa0, 0x53, 0xad, 0x9b, 0x9c,
-  0x5a, 0x2e, 0x15, 0xe2, 0xb5, 0x17, 0x9e, 0xce, 0xa8, 0x1c, 0x00, 0xf2,
-  0x6e, 0x93, 0x40, 0xee, 0x4c, 0x2c, 0x77, 0xc8, 0x09, 0xe4, 0x00, 0xd8,
-  0x92, 0x30, 0x0e, 0x80, 0x8e, 0x93, 0x24, 0xc9, 0x1b, 0xd1, 0x34, 0x39,
-  0xb5, 0x58, 0xe8, 0x8b, 0x57, 0x9f, 0x7f, 0x2a, 0x8a, 0xfd, 0xde, 0xba,
-  0x00, 0xc8, 0x4e, 0xb1, 0xbf, 0x2f, 0x2e, 0x4c, 0x0e, 0x47, 0xb1, 0xb0,
-  0xee, 0xfd, 0xe8, 0x4c, 0x2c, 0xff, 0x20, 0x09, 0x00, 0x36, 0x65, 0x80,
-  0x03, 0x00, 0x1d, 0x65, 0xa3, 0x81, 0x0d, 0xaf, 0x3c, 0xf7, 0x54, 0x8c,
-  0x8f, 0x0c, 0x64, 0x50, 0x11, 0x00, 0xac, 0x37, 0x5b, 0xad, 0xc5, 0x2f,
-  0x7f, 0xfb, 0xbb, 0xa8, 0x2d, 0x2e, 0x35, 0x3f, 0xf4, 0x77, 0xf5, 0x7a,
-  0xfd, 0x8d, 0x2c, 0x6a, 0x02, 0xa0, 0x3b, 0x68, 0x2f, 0x00, 0xa0, 0x63,
-  0x34, 0x9c, 0x13, 0xb7, 0xc6, 0x8b, 0xa7, 0x0e, 0x09, 0xe2, 0x00, 0xe8,
-  0x28, 0x9b, 0x9c, 0x61, 0xfa, 0x97, 0x49, 0x92, 0x5c, 0x4c, 0xb9, 0x1c,
-  0x00, 0xba, 0x88, 0x30, 0x0e, 0x80, 0x4e, 0xf2, 0x76, 0x44, 0x1c, 0x6f,
-  0x5c, 0x18, 0x1d, 0x2a, 0xc5, 0xd4, 0xa9, 0x43, 0xd9, 0x54, 0x03, 0x00,
-  0x9b, 0x18, 0x1f, 0x19, 0x88, 0x0b, 0x67, 0x86, 0x5b, 0x3d, 0xf4, 0x73,
-  0x13, 0x56, 0x01, 0xd8, 0x88, 0x30, 0x0e, 0x80, 0x8e, 0xb0, 0x72, 0x4e,
-  0xdc, 0x9f, 0x37, 0xae, 0x95, 0x4b, 0x85, 0x78, 0xf5, 0xb9, 0xa7, 0x32,
-  0xaa, 0x08, 0x00, 0xb6, 0x36, 0x31, 0x5a, 0x8e, 0x89, 0xa3, 0x07, 0x5b,
-  0x3d, 0x74, 0x29, 0x49, 0x92, 0xb1, 0x74, 0xab, 0x01, 0xa0, 0x1b, 0x08,
-  0xe3, 0x00, 0xc8, 0xdc, 0x4a, 0xf7, 0xc0, 0xdf, 0x36, 0xaf, 0x1b, 0xd8,
-  0x00, 0x40, 0x37, 0xb8, 0x30, 0x79, 0x24, 0x46, 0x87, 0x4a, 0xcd, 0xcb,
-  0x95, 0x88, 0x78, 0xc7, 0x84, 0x55, 0x00, 0x9a, 0xb9, 0xc3, 0x01, 0x20,
-  0x53, 0x1b, 0x9d, 0x13, 0x77, 0xfe, 0xf4, 0xe1, 0x18, 0x2e, 0x17, 0x33,
-  0xa8, 0x08, 0x00, 0x76, 0xee, 0xd5, 0xe7, 0x9e, 0x6a, 0xf5, 0xbe, 0x65,
-  0xc2, 0x2a, 0x00, 0xeb, 0x08, 0xe3, 0x00, 0xc8, 0xda, 0x9b, 0xd1, 0xe2,
-  0x9c, 0xb8, 0xb3, 0x27, 0x34, 0x12, 0x00, 0xd0, 0x3d, 0x8a, 0xfd, 0x7d,
-  0x71, 0x61, 0x72, 0x38, 0x8a, 0x85, 0x75, 0xb7, 0x58, 0xaf, 0xaf, 0x1c,
-  0xc5, 0x00, 0x00, 0x11, 0x21, 0x8c, 0x03, 0x20, 0x43, 0x49, 0x92, 0xbc,
-  0x12, 0x11, 0x7f, 0xd9, 0xb8, 0x56, 0x2c, 0xf4, 0x39, 0x27, 0x0e, 0x80,
-  0xae, 0xb4, 0xc9, 0x84, 0xd5, 0xbf, 0x4d, 0x92, 0xe4, 0x5c, 0xca, 0xe5,
-  0x00, 0xd0, 0xa1, 0x84, 0x71, 0x00, 0x64, 0x62, 0x65, 0x7b, 0xea, 0xdb,
-  0xcd, 0xeb, 0x17, 0x26, 0x8f, 0x38, 0x27, 0x0e, 0x80, 0xae, 0x35, 0x3e,
-  0x32, 0x10, 0x2f, 0xb6, 0x9e, 0x02, 0xee, 0xfc, 0x38, 0x00, 0x22, 0x42,
-  0x18, 0x07, 0x40, 0x76, 0xde, 0x8e, 0xe5, 0xc3, 0xad, 0x1f, 0x39, 0x7b,
-  0x62, 0x30, 0xc6, 0x47, 0x06, 0xb2, 0xa9, 0x06, 0x00, 0xf6, 0xc9, 0xd4,
-  0xa9, 0x43, 0x71, 0x72, 0xfd, 0xfb, 0x59, 0x25, 0x5a, 0x9c, 0x91, 0x0a,
-  0x40, 0xfe, 0x08, 0xe3, 0x00, 0x48, 0xdd, 0xca, 0xf6, 0xd4, 0x3f, 0x6f,
-  0x5c, 0x2b, 0x97, 0x0a, 0x31, 0xd5, 0xba, 0x93, 0x00, 0x00, 0xba, 0xce,
-  0xcb, 0x67, 0x8e, 0xb4, 0x1a, 0xe8, 0xf0, 0x52, 0x92, 0x24, 0x6f, 0x66,
-  0x50, 0x0e, 0x00, 0x1d, 0x44, 0x18, 0x07, 0x40, 0xaa, 0x36, 0xda, 0x9e,
-  0xfa, 0xb2, 0xed, 0xa9, 0x00, 0xf4, 0x90, 0x4d, 0x06, 0x3a, 0xfc, 0x95,
-  0xf3, 0xe3, 0x00, 0xf2, 0xcd, 0x5d, 0x0f, 0x00, 0x69, 0x7b, 0x33, 0x5a,
-  0x6c, 0x4f, 0x1d, 0x1d, 0x2a, 0x65, 0x53, 0x0d, 0x00, 0xb4, 0xc9, 0x70,
-  0xb9, 0x18, 0xe7, 0x4f, 0x1f, 0x6e, 0xf5, 0x90, 0xf3, 0xe3, 0x00, 0x72,
-  0x4c, 0x18, 0x07, 0x40, 0x6a, 0x56, 0x3a, 0x01, 0xd6, 0x4c, 0x4f, 0xb5,
-  0x3d, 0x15, 0x80, 0x5e, 0x36, 0x31, 0x5a, 0x8e, 0x89, 0xa3, 0x07, 0x9b,
-  0x97, 0x9d, 0x1f, 0x07, 0x90, 0x63, 0xc2, 0x38, 0x00, 0xd2, 0xf4, 0x56,
-  0xf3, 0x82, 0xed, 0xa9, 0x00, 0xf4, 0xba, 0xf3, 0xa7, 0x9f, 0x8c, 0x72,
-  0xa9, 0xd0, 0xbc, 0xfc, 0x52, 0x92, 0x24, 0x6f, 0x64, 0x51, 0x0f, 0x00,
-  0xd9, 0x72, 0xf7, 0x03, 0x40, 0x2a, 0x56, 0x6e, 0x38, 0xce, 0x34, 0xae,
-  0x4d, 0x1c, 0x3d, 0x68, 0x7b, 0x2a, 0x00, 0x3d, 0xaf, 0xd8, 0xdf, 0x17,
-  0xaf, 0x3e, 0xff, 0x54, 0xab, 0x87, 0xfe, 0x36, 0x49, 0x92, 0xc9, 0xb4,
-  0xeb, 0x01, 0x20, 0x5b, 0xc2, 0x38, 0x00, 0xda, 0x6e, 0xe5, 0x5c, 0x9c,
-  0x37, 0x1b, 0xd7, 0x8a, 0x85, 0xbe, 0x38, 0x7f, 0xfa, 0xc9, 0x6c, 0x0a,
-  0x02, 0x80, 0x94, 0x6d, 0x72, 0x7e, 0xdc, 0xdb, 0x29, 0x97, 0x02, 0x40,
-  0xc6, 0x84, 0x71, 0x00, 0xa4, 0xe1, 0xad, 0x68, 0x1a, 0xda, 0x30, 0xf5,
-  0xc3, 0x43, 0xb6, 0xa7, 0x02, 0x90, 0x2b, 0x1b, 0x0c, 0x2c, 0x3a, 0x93,
-  0x24, 0xc9, 0x9b, 0x19, 0x94, 0x03, 0x40, 0x46, 0xdc, 0x05, 0x01, 0xd0,
-  0x56, 0x2b, 0x43, 0x1b, 0x5e, 0x6f, 0x5c, 0x1b, 0x1d, 0x2a, 0xc5, 0xd9,
-  0x13, 0x86, 0xc8, 0x01, 0x90, 0x3f, 0x17, 0xce, 0x0c, 0x47, 0xb1, 0xb0,
-  0xee, 0x36, 0xec, 0xaf, 0x6c, 0x57, 0x05, 0xc8, 0x0f, 0x61, 0x1c, 0x00,
-  0xed, 0xf6, 0x66, 0xf3, 0x82, 0xe9, 0xa9, 0x00, 0xe4, 0x55, 0xe5, 0x40,
-  0x7f, 0x5c, 0x98, 0x3c, 0xd2, 0xea, 0xa1, 0x77, 0x56, 0x8e, 0x75, 0x00,
-  0xa0, 0xc7, 0x09, 0xe3, 0x00, 0x68, 0x9b, 0x24, 0x49, 0x2e, 0x46, 0xc4,
-  0x4b, 0x8d, 0x6b, 0x86, 0x36, 0x00, 0x90, 0x77, 0xe3, 0x23, 0x03, 0x71,
-  0x72, 0x64, 0xa0, 0x79, 0xf9, 0x78, 0x44, 0x98, 0xae, 0x0a, 0x90, 0x03,
-  0xc2, 0x38, 0x00, 0xda, 0xe9, 0xcd, 0xc6, 0x8b, 0x62, 0xa1, 0x2f, 0x5e,
-  0xd4, 0x15, 0x07, 0x00, 0xf1, 0xf2, 0x99, 0x23, 0xb6, 0xab, 0x02, 0xe4,
-  0x94, 0x30, 0x0e, 0x80, 0xb6, 0x48, 0x92, 0xe4, 0x8d, 0x58, 0xfe, 0x29,
-  0xff, 0x23, 0x67, 0x9f, 0x19, 0x8c, 0xca, 0x81, 0xfe, 0x8c, 0x2a, 0x02,
-  0x80, 0xce, 0x51, 0xec, 0xef, 0xdb, 0x68, 0xbb, 0xea, 0xdb, 0x29, 0x97,
-  0x02, 0x40, 0xca, 0x84, 0x71, 0x00, 0xec, 0xbb, 0x95, 0x33, 0x6f, 0xde,
-  0x6c, 0x5c, 0x2b, 0x97, 0x0a, 0xf1, 0x9c, 0xa1, 0x0d, 0x00, 0xf0, 0xc8,
-  0x06, 0xdb, 0x55, 0x4d, 0x57, 0x05, 0xe8, 0x71, 0xc2, 0x38, 0x00, 0xda,
-  0xe1, 0x8d, 0x88, 0xa8, 0x34, 0x2e, 0x4c, 0x9d, 0x3a, 0x14, 0xc5, 0x7e,
-  0x6f, 0x3b, 0x00, 0xd0, 0x68, 0x83, 0xed, 0xaa, 0x6f, 0x24, 0x49, 0x32,
-  0x96, 0x7e, 0x35, 0x00, 0xa4, 0xc1, 0x5d, 0x11, 0x00, 0xfb, 0x6a, 0xa5,
-  0x2b, 0x6e, 0xcd, 0x01, 0xd4, 0xe5, 0x52, 0x21, 0x26, 0x46, 0xcb, 0x19,
-  0x55, 0x04, 0x00, 0x9d, 0xab, 0xd8, 0xdf, 0x17, 0x53, 0x3f, 0x5c, 0x77,
-  0x9e, 0x6a, 0x25, 0x6c, 0x57, 0x05, 0xe8, 0x59, 0xc2, 0x38, 0x00, 0xf6,
-  0x5b, 0xcb, 0xae, 0x38, 0x00, 0xa0, 0xb5, 0xb3, 0x27, 0x06, 0x5b, 0x4d,
-  0x1a, 0x7f, 0x29, 0x49, 0x92, 0x57, 0xb2, 0xa8, 0x07, 0x80, 0xf6, 0x12,
-  0xc6, 0x01, 0xb0, 0x6f, 0x74, 0xc5, 0x01, 0xc0, 0xee, 0x9c, 0x3f, 0x7d,
-  0xb8, 0xd5, 0xf2, 0x5b, 0x2b, 0xef, 0xad, 0x00, 0xf4, 0x10, 0x61, 0x1c,
-  0x00, 0xfb, 0x69, 0x5d, 0x57, 0xdc, 0xcb, 0xad, 0x27, 0xc5, 0x01, 0x00,
-  0x0d, 0x86, 0xcb, 0xc5, 0x78, 0x71, 0x7d, 0x27, 0xf9, 0xf1, 0x68, 0xfa,
-  0x21, 0x17, 0x00, 0xdd, 0x4f, 0x18, 0x07, 0xc0, 0xbe, 0x68, 0xd5, 0x15,
-  0x37, 0x5c, 0x2e, 0xb6, 0xda, 0x76, 0x03, 0x00, 0xb4, 0xf0, 0xdc, 0x89,
-  0xc1, 0x28, 0x97, 0x0a, 0xcd, 0xcb, 0x7f, 0x65, 0x98, 0x03, 0x40, 0x6f,
-  0x11, 0xc6, 0x01, 0xb0, 0x5f, 0xd6, 0x75, 0xc5, 0x9d, 0x3d, 0x51, 0xd9,
-  0xe0, 0xa9, 0x00, 0x40, 0xb3, 0x62, 0x7f, 0x5f, 0x9c, 0x3f, 0xfd, 0x64,
-  0xab, 0x87, 0xde, 0x4e, 0xb9, 0x14, 0x00, 0xda, 0x48, 0x18, 0x07, 0xc0,
-  0x7e, 0x71, 0x56, 0x1c, 0x00, 0xec, 0xd1, 0xf8, 0xc8, 0xc0, 0x46, 0xc3,
-  0x1c, 0xce, 0x65, 0x50, 0x0e, 0x00, 0x6d, 0x20, 0x8c, 0x03, 0x60, 0xcf,
-  0x92, 0x24, 0xb9, 0x18, 0x26, 0xa8, 0x02, 0xc0, 0xbe, 0xd8, 0x68, 0x98,
-  0x43, 0xda, 0x75, 0x00, 0xd0, 0x1e, 0xc2, 0x38, 0x00, 0xf6, 0xc3, 0x9b,
-  0x8d, 0x17, 0xba, 0xe2, 0x00, 0x60, 0xf7, 0x86, 0xcb, 0xc5, 0x98, 0x38,
-  0x7a, 0xb0, 0x79, 0xf9, 0xcc, 0xca, 0x0f, 0xbf, 0x00, 0xe8, 0x72, 0xc2,
-  0x38, 0x00, 0xf6, 0x24, 0x49, 0x92, 0x57, 0x62, 0x79, 0xda, 0xdb, 0x23,
-  0xcf, 0x3d, 0x33, 0x98, 0x51, 0x35, 0x00, 0xd0, 0x1b, 0xce, 0x9f, 0x7e,
-  0x32, 0x8a, 0x85, 0x75, 0xb7, 0x6b, 0x6f, 0xae, 0x0c, 0x4c, 0x02, 0xa0,
-  0x8b, 0x09, 0xe3, 0x00, 0xd8, 0xab, 0x35, 0x67, 0xc5, 0x15, 0x0b, 0x7d,
-  0x31, 0x71, 0x54, 0x57, 0x1c, 0x00, 0xec, 0x45, 0xb1, 0xbf, 0x2f, 0xce,
-  0xae, 0xff, 0xe1, 0xd6, 0xf1, 0x68, 0x7a, 0xdf, 0x05, 0xa0, 0xfb, 0x08,
-  0xe3, 0x00, 0xd8, 0xb5, 0x24, 0x49, 0xc6, 0x22, 0xe2, 0xa5, 0xc6, 0xb5,
-  0x89, 0xd1, 0x72, 0x14, 0xfb, 0xbd, 0xbd, 0x00, 0xc0, 0x5e, 0x3d, 0x77,
-  0x62, 0x30, 0xca, 0xa5, 0x42, 0xf3, 0xf2, 0x1b, 0xba, 0xe3, 0x00, 0xba,
-  0x9b, 0xbb, 0x25, 0x00, 0xf6, 0xe2, 0xcd, 0xe6, 0x85, 0xb3, 0x27, 0x2a,
-  0x2d, 0x9e, 0x06, 0x00, 0xec, 0x54, 0xb1, 0xbf, 0xaf, 0xd5, 0x40, 0xa4,
-  0x4a, 0xe8, 0x8e, 0x03, 0xe8, 0x6a, 0xc2, 0x38, 0x00, 0x76, 0x65, 0xe5,
-  0xa7, 0xf2, 0xaf, 0x34, 0xae, 0x4d, 0x1c, 0x3d, 0x18, 0x95, 0x03, 0xfd,
-  0x19, 0x55, 0x04, 0x00, 0xbd, 0x67, 0x62, 0xb4, 0xac, 0x3b, 0x0e, 0xa0,
-  0xc7, 0x08, 0xe3, 0x00, 0xd8, 0xad, 0x57, 0x62, 0xf9, 0xa7, 0xf3, 0x8f,
-  0x98, 0xa0, 0x0a, 0x00, 0xfb, 0x4f, 0x77, 0x1c, 0x40, 0x6f, 0x11, 0xc6,
-  0x01, 0xb0, 0x5b, 0x6b, 0x6e, 0x02, 0xca, 0xa5, 0x42, 0x8c, 0x0e, 0x95,
-  0xb2, 0xaa, 0x05, 0x00, 0x7a, 0xd6, 0xc4, 0x68, 0xb9, 0xd5, 0x7b, 0xac,
-  0xee, 0x38, 0x80, 0x2e, 0x25, 0x8c, 0x03, 0x60, 0xc7, 0x92, 0x24, 0x99,
-  0x8c, 0x88, 0x33, 0x8d, 0x6b, 0xcf, 0xad, 0x9f, 0xf8, 0x06, 0x00, 0xec,
-  0x13, 0xdd, 0x71, 0x00, 0xbd, 0x43, 0x18, 0x07, 0xc0, 0x6e, 0xac, 0xf9,
-  0xf0, 0x5f, 0x2c, 0xf4, 0xc5, 0xc4, 0x51, 0x5b, 0x54, 0x01, 0xa0, 0x5d,
-  0x46, 0x87, 0x4a, 0xba, 0xe3, 0x00, 0x7a, 0x84, 0x30, 0x0e, 0x80, 0x1d,
-  0x69, 0x35, 0xb8, 0x61, 0x7c, 0x64, 0x20, 0x8a, 0xfd, 0xde, 0x52, 0x00,
-  0xa0, 0x9d, 0xce, 0x9e, 0x58, 0x97, 0xbb, 0xe9, 0x8e, 0x03, 0xe8, 0x42,
-  0xee, 0x9c, 0x00, 0xd8, 0x29, 0x83, 0x1b, 0x00, 0x20, 0x03, 0xe3, 0x23,
-  0x03, 0x26, 0xab, 0x02, 0xf4, 0x00, 0x61, 0x1c, 0x00, 0x3b, 0x75, 0xb1,
-  0xf1, 0xc2, 0xe0, 0x06, 0x00, 0x48, 0xcf, 0x06, 0x67, 0xc7, 0x5d, 0x4c,
-  0xbf, 0x12, 0x00, 0x76, 0x4b, 0x18, 0x07, 0xc0, 0xb6, 0x25, 0x49, 0x32,
-  0x16, 0x11, 0x2f, 0x35, 0xae, 0x19, 0xdc, 0x00, 0x00, 0xe9, 0x99, 0x18,
-  0x2d, 0xb7, 0xec, 0x8e, 0xcb, 0xa2, 0x16, 0x00, 0x76, 0x47, 0x18, 0x07,
-  0xc0, 0x4e, 0x5c, 0x6c, 0x5e, 0x38, 0x79, 0x64, 0x20, 0x83, 0x32, 0x00,
-  0x20, 0xbf, 0x5a, 0x74, 0xc7, 0x1d, 0x4f, 0x92, 0xe4, 0x62, 0x06, 0xa5,
-  0x00, 0xb0, 0x0b, 0xc2, 0x38, 0x00, 0x76, 0xe2, 0x62, 0xe3, 0xc5, 0xc9,
-  0x91, 0x81, 0xa8, 0x1c, 0xe8, 0xcf, 0xa8, 0x14, 0x00, 0xc8, 0xa7, 0xf1,
-  0x91, 0x27, 0xa2, 0x58, 0x58, 0x77, 0x2b, 0x77, 0x31, 0x83, 0x52, 0x00,
-  0xd8, 0x05, 0x61, 0x1c, 0x00, 0xdb, 0x92, 0x24, 0xc9, 0x64, 0x44, 0x1c,
-  0x6f, 0x5c, 0x1b, 0xd7, 0x15, 0x07, 0x00, 0xa9, 0x2b, 0xf6, 0xf7, 0xc5,
-  0xd9, 0xf5, 0xc7, 0x44, 0xbc, 0xb4, 0xf2, 0x5e, 0x0d, 0x40, 0x87, 0x13,
-  0xc6, 0x01, 0xb0, 0x5d, 0x17, 0x9b, 0x17, 0xc6, 0x47, 0x9e, 0xc8, 0xa0,
-  0x0c, 0x00, 0x60, 0xe2, 0xe8, 0xc1, 0x56, 0xcb, 0xce, 0x8e, 0x03, 0xe8,
-  0x02, 0xc2, 0x38, 0x00, 0xb6, 0xeb, 0x95, 0xc6, 0x8b, 0x89, 0xa3, 0x07,
-  0xa3, 0xd8, 0xef, 0x6d, 0x04, 0x00, 0xb2, 0x50, 0x39, 0xd0, 0xdf, 0x2a,
-  0x90, 0x7b, 0x3d, 0x49, 0x12, 0x93, 0x95, 0x00, 0x3a, 0x9c, 0xbb, 0x28,
-  0x00, 0xb6, 0xd4, 0x6a, 0x8b, 0xea, 0x49, 0x5d, 0x71, 0x00, 0x90, 0xa9,
-  0x89, 0xd1, 0x72, 0xab, 0xe5, 0x8b, 0x29, 0x97, 0x01, 0xc0, 0x0e, 0x09,
-  0xe3, 0x00, 0xd8, 0x8e, 0x8b, 0x8d, 0x17, 0xc5, 0x42, 0x5f, 0x8c, 0x8f,
-  0x38, 0x2f, 0x0e, 0x00, 0xb2, 0x34, 0x3a, 0x54, 0x8a, 0xe1, 0x72, 0xb1,
-  0x79, 0xd9, 0x56, 0x55, 0x80, 0x0e, 0x27, 0x8c, 0x03, 0x60, 0x3b, 0xd6,
-  0x6c, 0x51, 0x15, 0xc4, 0x01, 0x40, 0x67, 0x38, 0x7b, 0xa2, 0xd2, 0xbc,
-  0x74, 0x3c, 0x49, 0x92, 0x73, 0x19, 0x94, 0x02, 0xc0, 0x36, 0x09, 0xe3,
-  0x00, 0xd8, 0x94, 0x2d, 0xaa, 0x00, 0xd0, 0xb9, 0xc6, 0x47, 0x9e, 0x88,
-  0x62, 0x61, 0xdd, 0x6d, 0xdd, 0xc5, 0x0c, 0x4a, 0x01, 0x60, 0x9b, 0x0a,
-  0x59, 0x17, 0x00, 0x40, 0xc7, 0xbb, 0xd8, 0x78, 0x61, 0x8b, 0x2a, 0x59,
-  0xa9, 0x2d, 0x2c, 0xc5, 0x6c, 0xb5, 0x16, 0x37, 0xef, 0xce, 0x3f, 0xfa,
-  0x75, 0x44, 0xc4, 0xdc, 0xc3, 0x85, 0xa8, 0xce, 0x2f, 0xae, 0x79, 0xee,
-  0x70, 0xb9, 0xf8, 0x68, 0xc0, 0xc8, 0xe8, 0x50, 0x29, 0x2a, 0xa5, 0x42,
-  0x54, 0x0e, 0xf4, 0xc7, 0xe8, 0x50, 0x29, 0xf5, 0xba, 0xe9, 0x7c, 0xb3,
-  0xd5, 0x5a, 0xcc, 0xce, 0xd5, 0x62, 0x6e, 0x7e, 0x31, 0x66, 0xab, 0xb5,
-  0xa8, 0x2d, 0x2c, 0x45, 0x44, 0xc4, 0xcc, 0xdd, 0xf9, 0x35, 0xcf, 0x2b,
-  0x16, 0xfa, 0x62, 0xb8, 0xb2, 0xbc, 0x25, 0xb0, 0x52, 0x2a, 0x44, 0xf9,
-  0x40, 0x7f, 0x0c, 0x97, 0x8b, 0x31, 0x5c, 0x7e, 0x2c, 0x2a, 0x07, 0xfa,
-  0x53, 0xaf, 0x1b, 0x22, 0x22, 0x8a, 0xfd, 0xcb, 0xef, 0xcb, 0xd3, 0xb7,
-  0xee, 0x37, 0x2e, 0xbf, 0x9e, 0x24, 0xc9, 0x1b, 0xf5, 0x7a, 0xfd, 0x5e,
-  0x56, 0x75, 0x01, 0xb0, 0x31, 0x61, 0x1c, 0x00, 0x5b, 0x59, 0xb3, 0x45,
-  0x75, 0xf4, 0xb0, 0x30, 0x83, 0x74, 0xd4, 0x16, 0x96, 0xe2, 0xe6, 0xdd,
-  0xf9, 0xf8, 0xf4, 0xf6, 0x37, 0x71, 0xf3, 0xee, 0xfc, 0xba, 0xc0, 0x6d,
-  0x33, 0xab, 0x41, 0x5d, 0xc4, 0xfa, 0x40, 0x65, 0x74, 0xa8, 0x14, 0xa3,
-  0x43, 0xa5, 0x18, 0x1f, 0x19, 0x68, 0x75, 0xd6, 0x12, 0x39, 0x30, 0xf7,
-  0x70, 0x21, 0x3e, 0xbd, 0xf3, 0x20, 0xae, 0xdf, 0x7e, 0xb0, 0xee, 0xfb,
-  0x63, 0x33, 0xb5, 0xc5, 0xa5, 0x47, 0xcf, 0x9f, 0x69, 0x7a, 0xac, 0x58,
-  0xe8, 0x8b, 0xd1, 0xc3, 0xa5, 0x18, 0x3f, 0x32, 0xb0, 0xdc, 0xa9, 0x64,
-  0xda, 0x34, 0x29, 0x3a, 0xfb, 0xcc, 0x60, 0x73, 0x18, 0x17, 0xb1, 0xfc,
-  0xfe, 0xfd, 0x76, 0xfa, 0xd5, 0x00, 0xb0, 0x95, 0xa4, 0x5e, 0xaf, 0x67,
-  0x5d, 0x03, 0x00, 0x1d, 0x2a, 0x49, 0x92, 0xb1, 0x88, 0xb8, 0xd1, 0xb8,
-  0x76, 0xe1, 0xcc, 0xf0, 0x46, 0xd3, 0xdb, 0x60, 0x5f, 0x5c, 0xbf, 0xfd,
-  0x20, 0xa6, 0x6f, 0x55, 0xe3, 0xd3, 0xdb, 0x0f, 0xda, 0xfe, 0xdf, 0x2a,
-  0x97, 0x0a, 0x31, 0x3e, 0xf2, 0x44, 0x9c, 0x3d, 0x51, 0xd1, 0xd9, 0xd4,
-  0xe3, 0x56, 0x03, 0xb8, 0xe9, 0x99, 0xfb, 0x6b, 0xc2, 0xda, 0x76, 0x39,
-  0x39, 0x32, 0x20, 0x98, 0x23, 0x55, 0xbf, 0xf8, 0xa7, 0x99, 0xe6, 0xef,
-  0xed, 0x8f, 0xea, 0xf5, 0xfa, 0x64, 0x56, 0xf5, 0x00, 0xb0, 0x31, 0x61,
-  0x1c, 0x00, 0x1b, 0x4a, 0x92, 0xe4, 0x8d, 0x88, 0xf8, 0xdb, 0xc6, 0xb5,
-  0xff, 0xf1, 0xbf, 0x7b, 0xc6, 0x8d, 0x25, 0xfb, 0xae, 0xb6, 0xb0, 0x14,
-  0x1f, 0xde, 0xb8, 0x17, 0xd3, 0x33, 0xd5, 0x1d, 0x75, 0xc0, 0xed, 0xa7,
-  0xd1, 0xa1, 0x52, 0x4c, 0x9d, 0x3a, 0x64, 0x2b, 0x6b, 0x8f, 0x99, 0xb9,
-  0x3b, 0x1f, 0xd3, 0x33, 0xd5, 0x56, 0x5d, 0x43, 0xa9, 0x28, 0x16, 0xfa,
-  0x62, 0x62, 0xb4, 0x2c, 0xf0, 0xa5, 0xed, 0xae, 0xdc, 0xb8, 0x17, 0xef,
-  0x7d, 0xf2, 0x55, 0xf3, 0xf2, 0x89, 0x7a, 0xbd, 0xfe, 0x79, 0x06, 0xe5,
-  0x00, 0xb0, 0x09, 0x61, 0x1c, 0x00, 0x1b, 0x4a, 0x92, 0xe4, 0x52, 0x44,
-  0xbc, 0xb4, 0x7a, 0x3d, 0x3a, 0x54, 0x8a, 0xd7, 0x5e, 0x78, 0x3a, 0xbb,
-  0x82, 0xe8, 0x39, 0xab, 0x21, 0xdc, 0x95, 0xcf, 0xee, 0x45, 0x6d, 0x71,
-  0x29, 0xeb, 0x72, 0x22, 0x62, 0xb9, 0x5b, 0xee, 0xe5, 0xc9, 0x23, 0x42,
-  0xb9, 0x2e, 0x37, 0x73, 0x77, 0x3e, 0x2e, 0x5f, 0xfb, 0x7a, 0x47, 0xdb,
-  0x50, 0xdb, 0x6d, 0xe2, 0xe8, 0xc1, 0x78, 0xf1, 0xd4, 0x21, 0xa1, 0x1c,
-  0x6d, 0x31, 0xf7, 0x70, 0x21, 0xfe, 0xb7, 0xf7, 0xbe, 0x68, 0x5e, 0xfe,
-  0xeb, 0x7a, 0xbd, 0xfe, 0x66, 0x06, 0xe5, 0x00, 0xb0, 0x09, 0x61, 0x1c,
-  0x00, 0x2d, 0x25, 0x49, 0x32, 0x18, 0x11, 0xff, 0xb5, 0x71, 0xed, 0xfc,
-  0xe9, 0xc3, 0x71, 0xf6, 0xc4, 0x60, 0x46, 0x15, 0xd1, 0x6b, 0xa6, 0x67,
-  0xaa, 0xf1, 0xde, 0x27, 0x5f, 0x75, 0x4c, 0x08, 0xd7, 0x6c, 0x74, 0xa8,
-  0x14, 0xe7, 0x4f, 0x1f, 0x76, 0xae, 0x5c, 0x97, 0xa9, 0x2d, 0x2c, 0xc5,
-  0x7b, 0x9f, 0xfc, 0x3e, 0xb3, 0x4e, 0xb8, 0xad, 0x14, 0x0b, 0x7d, 0x71,
-  0xf6, 0x99, 0xc1, 0x98, 0x3a, 0x75, 0x28, 0xeb, 0x52, 0xe8, 0x41, 0xbf,
-  0xfa, 0xf0, 0xcb, 0xe6, 0x2d, 0xfe, 0x5f, 0xd4, 0xeb, 0xf5, 0xb1, 0x8c,
-  0xca, 0x01, 0x60, 0x03, 0xc2, 0x38, 0x00, 0x5a, 0x4a, 0x92, 0xe4, 0x62,
-  0x44, 0xfc, 0xbc, 0x71, 0xed, 0x7f, 0x38, 0x7f, 0x5c, 0x47, 0x07, 0x7b,
-  0x36, 0xf7, 0x70, 0x21, 0xde, 0xfd, 0x68, 0xb6, 0xa3, 0x3a, 0x96, 0x36,
-  0xf3, 0xe2, 0xa9, 0x43, 0x82, 0x93, 0x2e, 0x71, 0xe5, 0xc6, 0xbd, 0xb8,
-  0xfc, 0x2f, 0x5f, 0x77, 0x6c, 0xc0, 0xdb, 0x48, 0x07, 0x26, 0xed, 0x30,
-  0x3d, 0x53, 0x8d, 0x77, 0x3f, 0x9a, 0x6d, 0x5e, 0xfe, 0x6f, 0xea, 0xf5,
-  0xfa, 0xd5, 0x2c, 0xea, 0x01, 0xa0, 0x35, 0x87, 0xfe, 0x00, 0xb0, 0x91,
-  0x73, 0x8d, 0x17, 0xe5, 0x52, 0x41, 0x10, 0xc7, 0x9e, 0x5d, 0xb9, 0x71,
-  0x2f, 0x7e, 0xf1, 0x4f, 0x33, 0x5d, 0x13, 0xc4, 0x45, 0x44, 0xfc, 0xf6,
-  0xda, 0xd7, 0xad, 0x0e, 0x46, 0xa7, 0x83, 0xd4, 0x16, 0x96, 0xe2, 0x97,
-  0xff, 0xfc, 0xbb, 0x8e, 0xee, 0xb4, 0x6c, 0x56, 0x9d, 0x5f, 0x7c, 0x54,
-  0x33, 0xec, 0x97, 0xf1, 0x91, 0x27, 0x5a, 0x2d, 0x5f, 0x4c, 0xb9, 0x0c,
-  0x00, 0xb6, 0xa0, 0x33, 0x0e, 0x80, 0x96, 0x92, 0x24, 0xb9, 0x17, 0x11,
-  0x95, 0xd5, 0xeb, 0xb3, 0x27, 0x06, 0xe3, 0xfc, 0xe9, 0xc3, 0x19, 0x56,
-  0x44, 0x37, 0xeb, 0xf4, 0xad, 0x83, 0xdb, 0x51, 0x2c, 0xf4, 0xc5, 0xf9,
-  0xd3, 0x87, 0x4d, 0x13, 0xee, 0x30, 0xb3, 0xd5, 0x5a, 0xfc, 0xf2, 0xb7,
-  0xbf, 0xeb, 0x9a, 0x10, 0xae, 0x95, 0xe1, 0x72, 0x31, 0x5e, 0x7b, 0xe1,
-  0x69, 0xc3, 0x71, 0xd8, 0x17, 0xb6, 0xaa, 0x02, 0x74, 0x3e, 0xef, 0xf8,
-  0x00, 0xac, 0x93, 0x24, 0xc9, 0x64, 0x34, 0x04, 0x71, 0x11, 0x61, 0x2b,
-  0x15, 0xbb, 0xb6, 0xda, 0xb5, 0xd4, 0xcd, 0x41, 0x5c, 0x44, 0x44, 0x6d,
-  0x71, 0x29, 0xde, 0xfd, 0x68, 0x56, 0x27, 0x53, 0x07, 0x99, 0x9e, 0xa9,
-  0xc6, 0x2f, 0xfe, 0x69, 0xa6, 0xab, 0x83, 0xb8, 0x88, 0xe5, 0x40, 0xf1,
-  0x7f, 0xfd, 0x7f, 0x3e, 0xd7, 0x7d, 0xc9, 0xbe, 0x18, 0x3f, 0x32, 0xd0,
-  0xbc, 0x74, 0x7c, 0xe5, 0x7d, 0x1d, 0x80, 0x0e, 0x21, 0x8c, 0x03, 0xa0,
-  0x95, 0x73, 0xcd, 0x0b, 0xe3, 0x23, 0xeb, 0x3e, 0xdc, 0xc3, 0x96, 0x7a,
-  0x31, 0x64, 0xb8, 0x72, 0xe3, 0x5e, 0xbc, 0x7b, 0xf5, 0x4e, 0xd6, 0x65,
-  0xe4, 0xde, 0x95, 0x1b, 0xf7, 0x5a, 0x9d, 0x8d, 0xd5, 0xb5, 0x6a, 0x8b,
-  0x4b, 0xf1, 0xcb, 0xdf, 0xfe, 0xae, 0xab, 0xb6, 0x70, 0xd3, 0x99, 0x36,
-  0xd8, 0xaa, 0xfa, 0x4a, 0xda, 0x75, 0x00, 0xb0, 0x31, 0x61, 0x1c, 0x00,
-  0xad, 0xac, 0xf9, 0xd0, 0x7e, 0x52, 0x10, 0xc7, 0x2e, 0xf4, 0xc2, 0xf6,
-  0xc1, 0x8d, 0x4c, 0xdf, 0xba, 0x2f, 0x90, 0xcb, 0xd0, 0xbb, 0x57, 0xef,
-  0xf4, 0x64, 0x87, 0x62, 0x6d, 0x71, 0xa5, 0x8b, 0x74, 0xa6, 0x9a, 0x75,
-  0x29, 0x74, 0xb1, 0x62, 0x7f, 0x5f, 0xab, 0xf7, 0x6d, 0x61, 0x1c, 0x40,
-  0x07, 0x11, 0xc6, 0x01, 0xd0, 0xca, 0x4b, 0x8d, 0x17, 0xc7, 0x6c, 0x51,
-  0x65, 0x87, 0x7a, 0x39, 0x88, 0x5b, 0x25, 0x90, 0xcb, 0xc6, 0xe5, 0x6b,
-  0x5f, 0x77, 0xfd, 0x96, 0xe7, 0xad, 0x74, 0xd3, 0xb4, 0x61, 0x3a, 0x53,
-  0x8b, 0xad, 0xaa, 0x67, 0x92, 0x24, 0x19, 0x4b, 0xbf, 0x12, 0x00, 0x5a,
-  0x11, 0xc6, 0x01, 0xb0, 0x46, 0x92, 0x24, 0xe7, 0x9a, 0xd7, 0x9c, 0x17,
-  0xc7, 0x4e, 0xd4, 0x16, 0x96, 0xe2, 0x57, 0x1f, 0x7c, 0xd9, 0xd3, 0x41,
-  0xdc, 0x2a, 0x81, 0x5c, 0xba, 0xa6, 0x67, 0xaa, 0xf1, 0xdb, 0x6b, 0x5f,
-  0x67, 0x5d, 0x46, 0x2a, 0x7e, 0xf5, 0xc1, 0x97, 0x3d, 0xb5, 0xbd, 0x9b,
-  0x74, 0x6d, 0xf0, 0xbe, 0x7d, 0x2e, 0xe5, 0x32, 0x00, 0xd8, 0x80, 0x30,
-  0x0e, 0x80, 0x66, 0x6b, 0xb6, 0xb2, 0x14, 0x0b, 0x7d, 0x31, 0x5c, 0x2e,
-  0x66, 0x55, 0x0b, 0x5d, 0x66, 0x75, 0x58, 0x43, 0x75, 0x7e, 0x31, 0xeb,
-  0x52, 0x52, 0x33, 0x7d, 0xeb, 0x7e, 0x5c, 0xb9, 0x71, 0x2f, 0xeb, 0x32,
-  0x7a, 0xde, 0xcc, 0xdd, 0xf9, 0x9e, 0x3a, 0x23, 0x6e, 0x2b, 0xab, 0x67,
-  0xc8, 0xd5, 0x16, 0x7a, 0x3f, 0xd4, 0x66, 0xff, 0x55, 0x0e, 0xf4, 0xb7,
-  0x7a, 0xef, 0xb6, 0x55, 0x15, 0xa0, 0x43, 0x08, 0xe3, 0x00, 0x68, 0x76,
-  0xae, 0xf1, 0xc2, 0xe0, 0x06, 0x76, 0xe2, 0xbd, 0x4f, 0x7e, 0x9f, 0xcb,
-  0x6e, 0x9e, 0xf7, 0x3e, 0xf9, 0xca, 0xb6, 0xc2, 0x36, 0x9a, 0x7b, 0xb8,
-  0x10, 0xbf, 0xfa, 0xe0, 0xcb, 0xac, 0xcb, 0x48, 0xdd, 0xea, 0x19, 0x72,
-  0xb0, 0x1b, 0x2d, 0xce, 0x8d, 0x3b, 0x97, 0x41, 0x19, 0x00, 0xb4, 0x20,
-  0x8c, 0x03, 0xe0, 0x91, 0x24, 0x49, 0x06, 0x23, 0xe2, 0x4c, 0xe3, 0x9a,
-  0x2d, 0xaa, 0x6c, 0xd7, 0xf4, 0x4c, 0xb5, 0xe7, 0xcf, 0xf2, 0xda, 0xcc,
-  0xaf, 0x3e, 0xf8, 0x52, 0x17, 0x53, 0x9b, 0xbc, 0xf3, 0xe1, 0xed, 0x5c,
-  0x6c, 0x7b, 0x6e, 0x65, 0xb6, 0x5a, 0xeb, 0xc9, 0x61, 0x15, 0xb4, 0x5f,
-  0x8b, 0x1f, 0xa6, 0x55, 0x5a, 0x1d, 0x45, 0x01, 0x40, 0xfa, 0x84, 0x71,
-  0x00, 0x34, 0x3a, 0xd7, 0xbc, 0x20, 0x8c, 0x63, 0x3b, 0xe6, 0x1e, 0x2e,
-  0xe4, 0x3e, 0x30, 0xa8, 0x2d, 0x2e, 0xc5, 0x6f, 0x3e, 0x72, 0x7e, 0xdc,
-  0x7e, 0xbb, 0x7c, 0xed, 0xeb, 0x5c, 0x76, 0x5b, 0x36, 0xba, 0x72, 0xe3,
-  0x9e, 0xce, 0x4b, 0x76, 0x6c, 0xb8, 0x5c, 0x8c, 0x62, 0x61, 0xdd, 0xed,
-  0x9e, 0xad, 0xaa, 0x00, 0x1d, 0x40, 0x18, 0x07, 0x40, 0xa3, 0x73, 0x8d,
-  0x17, 0xe5, 0x52, 0x21, 0x2a, 0x07, 0xfa, 0x33, 0x2a, 0x85, 0x6e, 0xf2,
-  0xee, 0x47, 0xb3, 0xb9, 0xed, 0x5c, 0x6a, 0xf4, 0xe9, 0xed, 0x07, 0x71,
-  0xfd, 0xf6, 0x83, 0xac, 0xcb, 0xe8, 0x19, 0xb3, 0xd5, 0x5a, 0xfb, 0x5d,
-  0xee, 0x5e, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x6e, 0x06,
-  0x36, 0x6c, 0xe5, 0x37, 0x57, 0xef, 0xe8, 0xbc, 0x64, 0xc7, 0x5a, 0x74,
-  0xc7, 0x9d, 0xcb, 0xa0, 0x0c, 0x00, 0x9a, 0x08, 0xe3, 0x00, 0x68, 0x74,
-  0xae, 0xf1, 0xe2, 0x98, 0xae, 0x38, 0xb6, 0xe1, 0xfa, 0xed, 0x07, 0xba,
-  0x76, 0x1a, 0xbc, 0xf7, 0xc9, 0xef, 0x85, 0x26, 0xfb, 0x24, 0xef, 0xdd,
-  0x96, 0x8d, 0xaa, 0xf3, 0x8b, 0xf1, 0xa1, 0x41, 0x21, 0xec, 0x50, 0x8b,
-  0xee, 0xf6, 0x33, 0x2b, 0x47, 0x52, 0x00, 0x90, 0x21, 0x61, 0x1c, 0x00,
-  0x8d, 0x9c, 0x17, 0xc7, 0x8e, 0xbd, 0xf7, 0xc9, 0xef, 0xb3, 0x2e, 0xa1,
-  0xa3, 0x08, 0x4d, 0xf6, 0x87, 0x90, 0x77, 0xbd, 0x2b, 0x9f, 0xdd, 0x8b,
-  0xb9, 0x87, 0x0b, 0x59, 0x97, 0x41, 0x17, 0xd9, 0xe0, 0x7d, 0xfc, 0x5c,
-  0xca, 0x65, 0x00, 0xd0, 0x44, 0x18, 0x07, 0x40, 0x44, 0x44, 0xb4, 0x3a,
-  0xd4, 0x59, 0x18, 0xc7, 0x56, 0xa6, 0x67, 0xaa, 0x51, 0x9d, 0x5f, 0xcc,
-  0xba, 0x8c, 0x8e, 0x73, 0xe5, 0xb3, 0x7b, 0xba, 0xe3, 0xf6, 0x48, 0xc8,
-  0xbb, 0x5e, 0x6d, 0x71, 0xc9, 0xb6, 0x5d, 0x76, 0xa4, 0x72, 0xa0, 0x3f,
-  0xca, 0xa5, 0x42, 0xf3, 0xf2, 0xb9, 0x0c, 0x4a, 0x01, 0xa0, 0x81, 0x30,
-  0x0e, 0x80, 0x55, 0xe7, 0x1a, 0x2f, 0x8a, 0x85, 0x3e, 0xe7, 0xc5, 0xb1,
-  0xa5, 0xcb, 0x82, 0x81, 0x96, 0x6a, 0x8b, 0x4b, 0xba, 0xe3, 0xf6, 0x40,
-  0xc8, 0xbb, 0xb1, 0xe9, 0x5b, 0xf7, 0x75, 0xc7, 0xb1, 0x23, 0x2d, 0x8e,
-  0x9c, 0x38, 0x97, 0x41, 0x19, 0x00, 0x34, 0x10, 0xc6, 0x01, 0xb0, 0xea,
-  0x5c, 0xe3, 0xc5, 0xe8, 0x61, 0x5d, 0x71, 0x6c, 0x4e, 0x60, 0xb2, 0x39,
-  0xdd, 0x71, 0xbb, 0x77, 0xe5, 0xc6, 0x5c, 0xd6, 0x25, 0x74, 0x34, 0x5f,
-  0x1f, 0x76, 0xc2, 0xb9, 0x71, 0x00, 0x9d, 0x47, 0x18, 0x07, 0xc0, 0xaa,
-  0x97, 0x1a, 0x2f, 0x0c, 0x6f, 0x60, 0x2b, 0x02, 0x81, 0xcd, 0xd5, 0x16,
-  0x97, 0x62, 0xfa, 0x56, 0x35, 0xeb, 0x32, 0xba, 0xce, 0xcc, 0xdd, 0xf9,
-  0x98, 0xad, 0xd6, 0xb2, 0x2e, 0xa3, 0xa3, 0x4d, 0xcf, 0x54, 0x05, 0xbd,
-  0x6c, 0xdb, 0x06, 0x47, 0x4e, 0x4c, 0xa6, 0x5d, 0x07, 0x00, 0xdf, 0x13,
-  0xc6, 0x01, 0x10, 0x49, 0x92, 0xac, 0xfb, 0x50, 0x3e, 0x5c, 0x2e, 0x66,
-  0x51, 0x0a, 0x5d, 0x62, 0xb6, 0x5a, 0x13, 0x98, 0x6c, 0xc3, 0xf4, 0xcc,
-  0xfd, 0xac, 0x4b, 0xe8, 0x3a, 0xd3, 0x33, 0x02, 0xcc, 0xad, 0xd4, 0x16,
-  0x97, 0xe2, 0xfa, 0xed, 0x6f, 0xb2, 0x2e, 0x83, 0x2e, 0xe1, 0xdc, 0x38,
-  0x80, 0xce, 0x23, 0x8c, 0x03, 0x20, 0xa2, 0xc5, 0x87, 0x72, 0xc3, 0x1b,
-  0xd8, 0x8c, 0x90, 0x69, 0x7b, 0x84, 0x96, 0x3b, 0x53, 0x5b, 0x58, 0x8a,
-  0xeb, 0xb7, 0x1f, 0x64, 0x5d, 0x46, 0x57, 0x98, 0xbe, 0xe5, 0xef, 0x20,
-  0xdb, 0x37, 0x5c, 0x59, 0xf7, 0x03, 0xb6, 0x73, 0x19, 0x94, 0x01, 0xc0,
-  0x0a, 0x61, 0x1c, 0x00, 0x11, 0x4d, 0xdb, 0x55, 0x04, 0x71, 0x6c, 0x45,
-  0x57, 0xce, 0xf6, 0x09, 0x2e, 0xb7, 0xef, 0xfa, 0xed, 0x6f, 0xa2, 0xb6,
-  0x68, 0xfb, 0xe5, 0x76, 0xcc, 0xdc, 0x9d, 0x37, 0xc8, 0x81, 0x6d, 0x6b,
-  0x71, 0xf4, 0x84, 0x6d, 0xaa, 0x00, 0x19, 0x12, 0xc6, 0x01, 0x10, 0xd1,
-  0xf4, 0x13, 0x72, 0x5b, 0x54, 0xd9, 0xcc, 0x6c, 0xb5, 0x66, 0x70, 0xc3,
-  0x0e, 0xcc, 0xdc, 0x9d, 0xcf, 0xba, 0x84, 0xae, 0xe1, 0x6b, 0xb5, 0x33,
-  0xbe, 0x5e, 0x6c, 0x57, 0x8b, 0xf7, 0xf5, 0x4a, 0xab, 0x23, 0x2a, 0x00,
-  0x48, 0x87, 0x30, 0x0e, 0x20, 0xe7, 0x56, 0x26, 0xaa, 0x1d, 0x6f, 0x5c,
-  0xd3, 0x19, 0xc7, 0x66, 0x6c, 0x23, 0xdc, 0x99, 0xd9, 0x6a, 0x4d, 0x07,
-  0xd3, 0x36, 0xf9, 0xde, 0xda, 0x99, 0xeb, 0x77, 0x7c, 0xbd, 0xd8, 0x1e,
-  0x43, 0x1c, 0x00, 0x3a, 0x8b, 0x30, 0x0e, 0x80, 0x16, 0xc3, 0x1b, 0x1e,
-  0xcb, 0xa2, 0x0e, 0xba, 0x84, 0x6e, 0x9c, 0x9d, 0xf3, 0x35, 0xdb, 0xda,
-  0x6c, 0xb5, 0x66, 0x8b, 0xea, 0x0e, 0xcd, 0x7c, 0xe5, 0xfb, 0x8a, 0xed,
-  0x6b, 0xd1, 0x1d, 0x27, 0x8c, 0x03, 0xc8, 0x88, 0x30, 0x0e, 0x80, 0x73,
-  0x8d, 0x17, 0xc5, 0x42, 0x5f, 0x54, 0x0e, 0xf4, 0x67, 0x54, 0x0a, 0xdd,
-  0x60, 0x76, 0xce, 0x40, 0x82, 0x9d, 0x9a, 0xad, 0x7e, 0x97, 0x75, 0x09,
-  0x1d, 0xcf, 0xf7, 0xd5, 0xce, 0xd5, 0x16, 0x97, 0x74, 0x5d, 0xb2, 0x6d,
-  0x2d, 0x7e, 0xd0, 0x26, 0x8c, 0x03, 0xc8, 0x88, 0x30, 0x0e, 0x80, 0xb5,
-  0xc3, 0x1b, 0x0e, 0xdb, 0xa2, 0xca, 0xc6, 0x74, 0x2f, 0xed, 0x8e, 0x89,
-  0xaa, 0x5b, 0x13, 0x58, 0xee, 0x8e, 0xaf, 0x1b, 0xdb, 0xd5, 0x62, 0xa2,
-  0xea, 0x4b, 0x59, 0xd4, 0x01, 0x80, 0x30, 0x0e, 0x00, 0xc3, 0x1b, 0xd8,
-  0x81, 0xda, 0x82, 0x20, 0x6e, 0x37, 0x74, 0x7d, 0x6d, 0x4d, 0x60, 0xb9,
-  0x3b, 0xbe, 0x6e, 0x6c, 0x57, 0xab, 0xf7, 0xf7, 0x24, 0x49, 0xc6, 0x52,
-  0x2f, 0x04, 0x00, 0x61, 0x1c, 0x40, 0x9e, 0xad, 0x7c, 0x08, 0xaf, 0x34,
-  0xae, 0x1d, 0x33, 0xbc, 0x81, 0x4d, 0xdc, 0x74, 0xf6, 0xd9, 0xae, 0xe8,
-  0x26, 0xdc, 0x9a, 0xed, 0x96, 0xbb, 0x53, 0xf5, 0x75, 0x63, 0x9b, 0x0c,
-  0x71, 0x00, 0xe8, 0x1c, 0xc2, 0x38, 0x80, 0x7c, 0x6b, 0x31, 0xbc, 0x41,
-  0x67, 0x1c, 0xb4, 0x83, 0x21, 0x0e, 0x9b, 0xab, 0xce, 0x2f, 0x66, 0x5d,
-  0x42, 0x57, 0x9a, 0xf3, 0x75, 0x63, 0x07, 0xca, 0xa5, 0x42, 0xf3, 0x92,
-  0x30, 0x0e, 0x20, 0x03, 0xc2, 0x38, 0x80, 0x7c, 0x5b, 0xf3, 0x21, 0xbc,
-  0x5c, 0x2a, 0x44, 0xb1, 0xdf, 0x5b, 0x03, 0x1b, 0x13, 0x28, 0x01, 0x74,
-  0xaf, 0x16, 0xe7, 0xc6, 0x09, 0xe3, 0x00, 0x32, 0xe0, 0x8e, 0x0b, 0x20,
-  0xdf, 0xd6, 0x7c, 0x08, 0x6f, 0xf1, 0x21, 0x1d, 0xa0, 0xed, 0x84, 0xbc,
-  0xbb, 0xe7, 0x6b, 0xc7, 0x4e, 0xb4, 0xe8, 0x7e, 0x1f, 0xcb, 0xa0, 0x0c,
-  0x80, 0xdc, 0x13, 0xc6, 0x01, 0xe4, 0xdb, 0xda, 0x30, 0xce, 0x16, 0x55,
-  0x68, 0x9b, 0x6f, 0x0d, 0xbf, 0x00, 0x32, 0xd6, 0xe2, 0x7d, 0xfe, 0x4c,
-  0x16, 0x75, 0x00, 0xe4, 0x9d, 0x30, 0x0e, 0x20, 0xa7, 0x92, 0x24, 0x19,
-  0x8c, 0x88, 0xe3, 0x8d, 0x6b, 0x86, 0x37, 0x40, 0xfb, 0x98, 0x7a, 0x09,
-  0x64, 0xed, 0xf1, 0x16, 0x47, 0x51, 0x98, 0xa8, 0x0a, 0x90, 0x3e, 0x61,
-  0x1c, 0x40, 0x7e, 0xad, 0x3b, 0x27, 0xa6, 0xc5, 0xc1, 0xce, 0xc0, 0x3e,
-  0x69, 0x75, 0x13, 0x0c, 0x90, 0xa6, 0x0d, 0x26, 0xaa, 0x8e, 0xa5, 0x5c,
-  0x06, 0x40, 0xee, 0xf9, 0x54, 0x08, 0x90, 0x5f, 0xe7, 0x1a, 0x2f, 0x8a,
-  0x85, 0xbe, 0xa8, 0x1c, 0xe8, 0xcf, 0xa8, 0x14, 0xe8, 0x7d, 0xb6, 0x81,
-  0x03, 0x9d, 0xa0, 0xc5, 0x0f, 0xde, 0xce, 0x65, 0x50, 0x06, 0x40, 0xae,
-  0x09, 0xe3, 0x00, 0xf2, 0x6b, 0xac, 0xf1, 0xc2, 0xf0, 0x06, 0x20, 0x2b,
-  0x82, 0xca, 0xdd, 0xf3, 0xb5, 0x63, 0xa7, 0x5a, 0xfc, 0xe0, 0x6d, 0x30,
-  0x8b, 0x3a, 0x00, 0xf2, 0x4c, 0x18, 0x07, 0x90, 0x5f, 0x6b, 0xb6, 0xa9,
-  0x6e, 0xb0, 0x75, 0x05, 0xd6, 0x70, 0xe3, 0x4f, 0x3b, 0x14, 0x6d, 0xe1,
-  0xdd, 0x35, 0x5f, 0x3b, 0x76, 0xaa, 0xc5, 0xeb, 0xf8, 0xba, 0x63, 0x2b,
-  0x00, 0x68, 0x2f, 0xef, 0xde, 0x00, 0xf9, 0xb5, 0x66, 0x82, 0x5a, 0xc5,
-  0x79, 0x71, 0x6c, 0x83, 0x1b, 0xff, 0xdd, 0x13, 0x64, 0x6e, 0xae, 0x58,
-  0xf0, 0xbd, 0x05, 0x69, 0x68, 0xf1, 0x3a, 0xae, 0x33, 0x0e, 0x20, 0x65,
-  0x3e, 0xf5, 0x00, 0xe4, 0x50, 0x92, 0x24, 0xeb, 0x7e, 0x0a, 0x6e, 0x9b,
-  0x2a, 0xdb, 0x21, 0x50, 0xda, 0x3d, 0x41, 0xe6, 0xe6, 0xbc, 0x06, 0xed,
-  0x8e, 0xae, 0x66, 0x76, 0xaa, 0xc5, 0xeb, 0xf8, 0x99, 0x56, 0xcf, 0x03,
-  0xa0, 0x7d, 0x7c, 0x2a, 0x04, 0xc8, 0xa7, 0xf5, 0x61, 0x9c, 0x90, 0x85,
-  0x6d, 0x30, 0x11, 0x74, 0x77, 0xfc, 0xfd, 0xda, 0x9a, 0xee, 0xdc, 0xdd,
-  0xf1, 0x75, 0x63, 0xa7, 0x5a, 0xbd, 0x8e, 0x27, 0x49, 0xa2, 0x3b, 0x0e,
-  0x20, 0x45, 0x3e, 0x51, 0x03, 0xe4, 0xd3, 0x58, 0xe3, 0x85, 0xa0, 0x80,
-  0xed, 0xd2, 0x85, 0xb3, 0x3b, 0xc3, 0xe5, 0xc7, 0xb2, 0x2e, 0xa1, 0xe3,
-  0xe9, 0x8c, 0xdb, 0x1d, 0x5f, 0x37, 0x76, 0x6a, 0x83, 0xf7, 0x7c, 0xe7,
-  0xc6, 0x01, 0xa4, 0x48, 0x18, 0x07, 0x90, 0x4f, 0xe7, 0x1a, 0x2f, 0xca,
-  0x07, 0x74, 0x56, 0xb0, 0x7d, 0xc2, 0xdb, 0x9d, 0x13, 0x98, 0x6c, 0xcd,
-  0xf7, 0xd5, 0xee, 0xf8, 0xba, 0xb1, 0x53, 0x1b, 0x6c, 0x99, 0xd7, 0x19,
-  0x07, 0x90, 0x22, 0x61, 0x1c, 0x40, 0x3e, 0x8d, 0x35, 0x5e, 0xb8, 0x99,
-  0x63, 0x27, 0x74, 0xc7, 0xed, 0x9c, 0xaf, 0xd9, 0xd6, 0x7c, 0x8d, 0x76,
-  0xce, 0xd7, 0x8c, 0xdd, 0x32, 0x51, 0x15, 0x20, 0x5b, 0xc2, 0x38, 0x80,
-  0x7c, 0x3a, 0xde, 0x78, 0x71, 0xcc, 0x0d, 0x1d, 0x3b, 0x20, 0x00, 0xd8,
-  0x99, 0x72, 0xa9, 0x20, 0xf0, 0xde, 0xa6, 0x93, 0x23, 0x03, 0x59, 0x97,
-  0xd0, 0x55, 0xc6, 0x7d, 0xbd, 0xd8, 0x25, 0x03, 0x65, 0x00, 0xb2, 0xe5,
-  0x55, 0x18, 0x20, 0x67, 0x92, 0x24, 0x39, 0xd7, 0xbc, 0x56, 0x76, 0x00,
-  0x38, 0x3b, 0x20, 0x00, 0xd8, 0x19, 0x61, 0xf7, 0xf6, 0xf9, 0x5a, 0xed,
-  0x8c, 0x60, 0x9c, 0xdd, 0x6a, 0x31, 0xf8, 0xe3, 0x5c, 0x06, 0x65, 0x00,
-  0xe4, 0x96, 0x30, 0x0e, 0x20, 0x7f, 0xc6, 0x9a, 0x17, 0x2a, 0x07, 0xfa,
-  0x33, 0x28, 0x83, 0x6e, 0xa6, 0x83, 0x69, 0xfb, 0x4e, 0x8e, 0x3c, 0x91,
-  0x75, 0x09, 0x5d, 0xe3, 0xe4, 0x11, 0xdf, 0x57, 0xdb, 0xa5, 0xe3, 0x92,
-  0xbd, 0x28, 0x7b, 0xdf, 0x07, 0xc8, 0x94, 0x30, 0x0e, 0x20, 0x7f, 0xc6,
-  0x1a, 0x2f, 0x74, 0x56, 0xb0, 0x1b, 0x13, 0x47, 0xcb, 0x59, 0x97, 0xd0,
-  0x15, 0x8a, 0x85, 0x3e, 0x9d, 0x84, 0x3b, 0x50, 0x39, 0xd0, 0xef, 0x35,
-  0x69, 0x9b, 0x26, 0x46, 0xfd, 0x1d, 0x64, 0x5f, 0x8d, 0x65, 0x5d, 0x00,
-  0x40, 0x9e, 0x08, 0xe3, 0x00, 0xf2, 0xe7, 0x5c, 0xe3, 0x85, 0x73, 0x63,
-  0xd8, 0x8d, 0xf1, 0x91, 0x01, 0xdb, 0x9b, 0xb7, 0x41, 0x60, 0xb2, 0x73,
-  0x13, 0x47, 0x0f, 0x66, 0x5d, 0x42, 0x57, 0xf0, 0x75, 0x62, 0x2f, 0x5a,
-  0x6c, 0x09, 0x3f, 0xde, 0xea, 0x79, 0x00, 0xb4, 0x87, 0x3b, 0x30, 0x80,
-  0xfc, 0x19, 0x6b, 0xbc, 0xb0, 0xcd, 0x89, 0xdd, 0x12, 0x34, 0x6d, 0xed,
-  0xec, 0x89, 0x4a, 0xd6, 0x25, 0x74, 0x9d, 0x89, 0xd1, 0x72, 0x14, 0x0b,
-  0x3e, 0xa2, 0x6e, 0xe6, 0xe4, 0xc8, 0x80, 0xe3, 0x05, 0x00, 0xa0, 0x8b,
-  0xf9, 0xa4, 0x03, 0x90, 0x3f, 0x6b, 0x7e, 0xfa, 0x2d, 0x8c, 0x63, 0xb7,
-  0x9e, 0x3b, 0x31, 0x98, 0x75, 0x09, 0x1d, 0x6d, 0xe2, 0xe8, 0x41, 0x81,
-  0xc9, 0x2e, 0x9d, 0x7d, 0xc6, 0xf7, 0xd6, 0x66, 0xfc, 0xdd, 0x63, 0xaf,
-  0x5a, 0x75, 0xc5, 0x27, 0x49, 0x32, 0x96, 0x7a, 0x21, 0x00, 0x39, 0x25,
-  0x8c, 0x03, 0xc8, 0x91, 0x24, 0x49, 0x26, 0x9b, 0xd7, 0x2a, 0x07, 0x6c,
-  0x35, 0x64, 0x77, 0x8a, 0xfd, 0x7d, 0xb6, 0xca, 0x6d, 0xe2, 0xc5, 0x53,
-  0x87, 0xb2, 0x2e, 0xa1, 0x6b, 0x3d, 0x77, 0x62, 0x50, 0x77, 0xdc, 0x06,
-  0x46, 0x87, 0x4a, 0xce, 0xd5, 0x63, 0xcf, 0x36, 0xf8, 0x41, 0xdc, 0x58,
-  0xca, 0x65, 0x00, 0xe4, 0x96, 0x4f, 0x39, 0x00, 0xf9, 0x32, 0xd6, 0xbc,
-  0xa0, 0x33, 0x8e, 0xbd, 0x38, 0x7f, 0xfa, 0x49, 0xa1, 0x49, 0x0b, 0xba,
-  0xe2, 0xf6, 0xa6, 0xd8, 0xdf, 0xa7, 0x3b, 0x6e, 0x03, 0x53, 0x42, 0x5e,
-  0x00, 0xe8, 0x7a, 0x3e, 0x3d, 0x03, 0xe4, 0xcb, 0x9a, 0xce, 0x38, 0x41,
-  0x1c, 0x7b, 0x25, 0x34, 0x69, 0x4d, 0x57, 0xdc, 0xde, 0x3d, 0x77, 0x62,
-  0xd0, 0x90, 0x90, 0x26, 0x27, 0x47, 0x06, 0x74, 0xc5, 0xd1, 0x4e, 0x63,
-  0x59, 0x17, 0x00, 0x90, 0x17, 0xc2, 0x38, 0x80, 0x7c, 0x19, 0x6b, 0xbc,
-  0x30, 0x49, 0x95, 0xfd, 0x30, 0x75, 0xea, 0x90, 0xd0, 0xa4, 0xc1, 0x8b,
-  0xa7, 0x0e, 0xe9, 0x8a, 0xdb, 0x07, 0xc5, 0xfe, 0xbe, 0x38, 0x7f, 0xfa,
-  0xc9, 0xac, 0xcb, 0xe8, 0x18, 0xc5, 0x42, 0x5f, 0x9c, 0xff, 0x83, 0xc3,
-  0x59, 0x97, 0x41, 0x0f, 0x69, 0x11, 0xec, 0x8e, 0x65, 0x50, 0x06, 0x40,
-  0x2e, 0xb9, 0x0b, 0x03, 0xc8, 0x97, 0xb1, 0xc6, 0x0b, 0x1d, 0x16, 0xec,
-  0x97, 0x97, 0x27, 0x8f, 0x64, 0x5d, 0x42, 0x47, 0x18, 0x2e, 0x17, 0x6d,
-  0x23, 0xdc, 0x47, 0xe3, 0x23, 0x03, 0x71, 0x72, 0x64, 0x20, 0xeb, 0x32,
-  0x3a, 0xc2, 0xd4, 0x0f, 0x85, 0xbc, 0x00, 0xd0, 0x2b, 0x84, 0x71, 0x00,
-  0xf9, 0xf2, 0x52, 0xe3, 0xc5, 0xe3, 0x3a, 0xe3, 0xd8, 0x27, 0xa3, 0x43,
-  0xa5, 0x38, 0x6b, 0xc2, 0x63, 0x5c, 0x98, 0x1c, 0xce, 0xba, 0x84, 0x9e,
-  0xf3, 0xf2, 0x99, 0x23, 0xb9, 0x3f, 0x97, 0xd0, 0xdf, 0x2f, 0x00, 0xe8,
-  0x2d, 0xf9, 0xfe, 0x64, 0x03, 0x90, 0x23, 0x49, 0x92, 0xac, 0xbb, 0x93,
-  0x73, 0x66, 0x1c, 0xfb, 0xe9, 0xfc, 0xe9, 0xc3, 0xb9, 0xfe, 0x9e, 0xca,
-  0xfb, 0xff, 0xfe, 0x76, 0x29, 0xf6, 0xf7, 0xc5, 0xab, 0xcf, 0x3f, 0x95,
-  0x75, 0x19, 0x99, 0x29, 0x16, 0xfa, 0xe2, 0xd5, 0xe7, 0xf2, 0xfb, 0xbf,
-  0x9f, 0x54, 0x8d, 0x65, 0x5d, 0x00, 0x40, 0x5e, 0x08, 0xe3, 0x00, 0xf2,
-  0x63, 0xb2, 0x79, 0x41, 0x70, 0xc0, 0x7e, 0x7b, 0xe5, 0xb9, 0x91, 0x5c,
-  0x76, 0x31, 0x4d, 0x1c, 0x3d, 0xa8, 0x73, 0xa9, 0x8d, 0x46, 0x87, 0x4a,
-  0xb9, 0x1d, 0x8a, 0xf1, 0xea, 0xf3, 0x4f, 0x39, 0xdf, 0x93, 0xb6, 0x70,
-  0x66, 0x1c, 0x40, 0x76, 0xbc, 0xb3, 0x03, 0xe4, 0xc7, 0x58, 0xf3, 0x82,
-  0x1b, 0x3c, 0xf6, 0x5b, 0xe5, 0x40, 0x7f, 0xbc, 0xf6, 0xe2, 0xd3, 0x59,
-  0x97, 0x91, 0xaa, 0xe1, 0x72, 0xd1, 0xa0, 0x81, 0x14, 0x4c, 0x9d, 0x3a,
-  0x14, 0x13, 0x47, 0x0f, 0x66, 0x5d, 0x46, 0xaa, 0x2e, 0x9c, 0x19, 0x76,
-  0xb6, 0x27, 0x00, 0xf4, 0x20, 0x77, 0x61, 0x00, 0xf9, 0x31, 0xd6, 0x78,
-  0xe1, 0x06, 0x8f, 0x76, 0x19, 0x2e, 0x17, 0xe3, 0xc2, 0x99, 0x7c, 0x9c,
-  0x9d, 0x36, 0x5c, 0x2e, 0xc6, 0x6b, 0x2f, 0x3c, 0x2d, 0xd8, 0x4e, 0xc9,
-  0x85, 0xc9, 0x23, 0xb9, 0xe9, 0xe8, 0x3d, 0x7b, 0x62, 0x30, 0x26, 0x46,
-  0xcb, 0x59, 0x97, 0x01, 0x00, 0xb4, 0x81, 0x4f, 0x8e, 0x00, 0xf9, 0xb1,
-  0x66, 0x9b, 0xaa, 0xf0, 0x80, 0x76, 0x9a, 0x18, 0x2d, 0xf7, 0x7c, 0x20,
-  0x27, 0x88, 0xcb, 0xc6, 0x6b, 0x2f, 0x3c, 0xdd, 0xf3, 0x81, 0xdc, 0xc4,
-  0xd1, 0x83, 0x71, 0xfe, 0xf4, 0xe1, 0xac, 0xcb, 0x00, 0x00, 0xda, 0xc4,
-  0xa7, 0x47, 0x80, 0xfc, 0x58, 0x73, 0xa0, 0x55, 0xaf, 0xdf, 0xcc, 0x92,
-  0xbd, 0x5e, 0x0e, 0xe4, 0x04, 0x71, 0xd9, 0x29, 0xf6, 0xf7, 0xf5, 0x74,
-  0x20, 0x37, 0x71, 0xf4, 0x60, 0x5c, 0x98, 0x3c, 0x92, 0x75, 0x19, 0xe4,
-  0x40, 0x8b, 0x89, 0xea, 0x63, 0x19, 0x94, 0x01, 0x90, 0x4b, 0x3e, 0x41,
-  0x02, 0xe4, 0xc7, 0x4b, 0x8d, 0x17, 0x95, 0x52, 0x21, 0xab, 0x3a, 0xc8,
-  0x91, 0x89, 0xd1, 0x72, 0xbc, 0xf2, 0xdc, 0x53, 0x3d, 0x35, 0xd4, 0x41,
-  0x10, 0x97, 0xbd, 0x62, 0x7f, 0x5f, 0xbc, 0xfe, 0xc7, 0xa3, 0x3d, 0x77,
-  0x86, 0xdc, 0x85, 0x33, 0xc3, 0x82, 0x38, 0x52, 0xd3, 0x22, 0xd0, 0x3e,
-  0x9e, 0x45, 0x1d, 0x00, 0x79, 0xe4, 0x53, 0x24, 0x40, 0x0e, 0x24, 0x49,
-  0xb2, 0x6e, 0xcc, 0x63, 0xe5, 0x40, 0x7f, 0x16, 0xa5, 0x90, 0x43, 0xe3,
-  0x23, 0x03, 0xf1, 0xda, 0x8b, 0x4f, 0x47, 0xb9, 0x07, 0x02, 0xe0, 0x89,
-  0xa3, 0x07, 0x05, 0x71, 0x1d, 0xe4, 0xc2, 0xe4, 0x91, 0x9e, 0x98, 0xb2,
-  0x5a, 0x2c, 0xf4, 0xc5, 0x2b, 0xcf, 0x3d, 0xe5, 0x8c, 0x38, 0x00, 0xc8,
-  0x09, 0x9f, 0x24, 0x01, 0xf2, 0x61, 0xb2, 0x79, 0xa1, 0x17, 0x82, 0x11,
-  0xba, 0xc7, 0x70, 0xb9, 0x18, 0x17, 0xff, 0xf8, 0x58, 0x9c, 0x1c, 0x19,
-  0xc8, 0xba, 0x94, 0x5d, 0x29, 0x16, 0xfa, 0x1e, 0x75, 0x2d, 0x09, 0xe2,
-  0x3a, 0xcb, 0xd4, 0xa9, 0x43, 0xcb, 0x01, 0x69, 0x97, 0x76, 0x5f, 0x0e,
-  0x97, 0x8b, 0xf1, 0xfa, 0x1f, 0x8f, 0xc6, 0x78, 0x97, 0xfe, 0xdd, 0x00,
-  0x00, 0x76, 0xae, 0x3b, 0x3f, 0xb5, 0x00, 0xb0, 0x53, 0x3a, 0xe3, 0xc8,
-  0x5c, 0xb1, 0xbf, 0x2f, 0x5e, 0x7d, 0xee, 0xa9, 0x38, 0x7f, 0xfa, 0x70,
-  0x57, 0x05, 0x27, 0xc3, 0xe5, 0x62, 0xbc, 0xf6, 0xe2, 0xd3, 0xba, 0x96,
-  0x3a, 0xd8, 0xe8, 0x50, 0x29, 0xfe, 0xed, 0x7f, 0x3b, 0xd6, 0x75, 0x61,
-  0xef, 0x8b, 0xa7, 0x0e, 0xc5, 0xeb, 0x7f, 0x3c, 0xea, 0xf5, 0x18, 0x00,
-  0x72, 0x46, 0x5b, 0x04, 0x40, 0x3e, 0xac, 0xe9, 0x8c, 0xeb, 0xd5, 0x83,
-  0xcf, 0xe9, 0x0e, 0x67, 0x4f, 0x0c, 0xc6, 0xc9, 0x23, 0x03, 0xf1, 0xde,
-  0x7f, 0xf9, 0x2a, 0x3e, 0xbd, 0xfd, 0x20, 0xeb, 0x72, 0x36, 0x54, 0x2c,
-  0xf4, 0xc5, 0xd4, 0x0f, 0x0f, 0xc5, 0xd9, 0x13, 0xeb, 0xb2, 0x6c, 0x3a,
-  0xd0, 0x6a, 0xd8, 0x7b, 0xfd, 0xf6, 0x83, 0x78, 0xef, 0x93, 0xdf, 0x47,
-  0x75, 0x7e, 0x31, 0xeb, 0x92, 0x36, 0x34, 0x3a, 0x54, 0x8a, 0xf3, 0xa7,
-  0x0f, 0x7b, 0x2d, 0x06, 0x80, 0x9c, 0x12, 0xc6, 0x01, 0xe4, 0xc3, 0x58,
-  0xe3, 0x85, 0x6d, 0x76, 0x64, 0xad, 0x72, 0xa0, 0x3f, 0x5e, 0x7d, 0xee,
-  0xa9, 0x98, 0xb9, 0x3b, 0x1f, 0x97, 0xaf, 0x7d, 0x1d, 0x33, 0x77, 0xe7,
-  0xb3, 0x2e, 0x69, 0x8d, 0x89, 0xa3, 0x07, 0xe3, 0xfc, 0xe9, 0x27, 0xfd,
-  0x5d, 0xe9, 0x42, 0xe3, 0x23, 0x03, 0x71, 0x6c, 0xa8, 0x14, 0x1f, 0xde,
-  0xb8, 0x17, 0x57, 0x3e, 0xbb, 0x17, 0xb5, 0xc5, 0xa5, 0xac, 0x4b, 0x7a,
-  0xa4, 0x5c, 0x2a, 0xc4, 0xd4, 0xa9, 0x43, 0xba, 0x2c, 0x01, 0x20, 0xe7,
-  0x84, 0x71, 0x00, 0xf9, 0x30, 0xd6, 0x78, 0x31, 0x3a, 0x54, 0xca, 0xa8,
-  0x0c, 0x58, 0x6b, 0x74, 0xa8, 0x14, 0xaf, 0xbd, 0xf0, 0x74, 0x47, 0x84,
-  0x72, 0xc5, 0x42, 0x5f, 0x8c, 0x8f, 0x0c, 0xc4, 0x8b, 0xa7, 0x0e, 0xd9,
-  0x36, 0xd8, 0xe5, 0x8a, 0xfd, 0x7d, 0x31, 0x75, 0xea, 0x50, 0x3c, 0x77,
-  0x62, 0xb0, 0x23, 0x42, 0x39, 0x21, 0x1c, 0x00, 0xd0, 0x48, 0x18, 0x07,
-  0x90, 0x0f, 0x63, 0x59, 0x17, 0x00, 0x9b, 0x59, 0x0d, 0xe5, 0x66, 0xab,
-  0xb5, 0xb8, 0xf2, 0xd9, 0xbd, 0xb8, 0x7e, 0xfb, 0x41, 0x6a, 0xe1, 0xc9,
-  0x70, 0xb9, 0x18, 0x13, 0xa3, 0x07, 0x63, 0xe2, 0x68, 0x59, 0x27, 0x5c,
-  0x8f, 0x59, 0x0d, 0xe5, 0xa6, 0x4e, 0x1d, 0x8a, 0xe9, 0x99, 0x6a, 0x4c,
-  0xdf, 0xba, 0x9f, 0x6a, 0xe0, 0x3b, 0x71, 0xf4, 0x60, 0x4c, 0x8c, 0x96,
-  0xfd, 0x00, 0x84, 0x8e, 0xd4, 0xea, 0xf5, 0x2e, 0x49, 0x92, 0xb1, 0x7a,
-  0xbd, 0xfe, 0x79, 0xfa, 0xd5, 0x00, 0xe4, 0x4b, 0x52, 0xaf, 0xd7, 0xb3,
-  0xae, 0x01, 0x80, 0x36, 0x4b, 0x92, 0x64, 0xcd, 0x8b, 0xfd, 0x6b, 0x2f,
-  0x3c, 0xed, 0xe6, 0x90, 0x8e, 0x77, 0xfd, 0xf6, 0x83, 0xf8, 0xf4, 0xf6,
-  0x37, 0x71, 0xf3, 0xee, 0xfc, 0xbe, 0x9f, 0xff, 0x35, 0x5c, 0x2e, 0xc6,
-  0xc9, 0x91, 0x81, 0x18, 0x1f, 0x19, 0x70, 0x6e, 0x57, 0xce, 0xcc, 0x3d,
-  0x5c, 0x88, 0x4f, 0xef, 0x3c, 0x88, 0xeb, 0xb7, 0x1f, 0xec, 0x7b, 0x30,
-  0x57, 0x2c, 0xf4, 0xc5, 0xe8, 0xe1, 0x52, 0x8c, 0x1f, 0x19, 0x88, 0xf1,
-  0x91, 0x27, 0x84, 0xbb, 0x74, 0xbc, 0xff, 0xe5, 0xff, 0xfc, 0xb4, 0x79,
-  0xe9, 0xdf, 0xd4, 0xeb, 0xf5, 0x4b, 0x19, 0x94, 0x02, 0x90, 0x2b, 0x3a,
-  0xe3, 0x00, 0x7a, 0x5c, 0x92, 0x24, 0x93, 0x5b, 0x3f, 0x0b, 0x3a, 0xcf,
-  0xf8, 0x4a, 0x58, 0x16, 0xb1, 0x1c, 0xa0, 0xcc, 0xdc, 0x9d, 0x8f, 0xd9,
-  0xea, 0x77, 0x31, 0x5b, 0xad, 0xc5, 0xdc, 0xc3, 0x85, 0x6d, 0x07, 0x74,
-  0xc3, 0xe5, 0x62, 0x94, 0x0f, 0x14, 0x62, 0xb8, 0x5c, 0x8c, 0x63, 0x43,
-  0xa5, 0x18, 0x2e, 0x17, 0x85, 0x24, 0x39, 0x56, 0x39, 0xd0, 0x1f, 0x67,
-  0x4f, 0x0c, 0x3e, 0x1a, 0xcc, 0x31, 0x73, 0x77, 0x7e, 0x39, 0xf0, 0x7d,
-  0xb8, 0x10, 0x73, 0xf3, 0x8b, 0xdb, 0x0e, 0xe8, 0x8a, 0x85, 0xbe, 0x18,
-  0xae, 0x14, 0x63, 0xb8, 0x5c, 0x8c, 0xca, 0x81, 0x42, 0x8c, 0xae, 0x7c,
-  0x6f, 0x01, 0x00, 0x6c, 0x45, 0x18, 0x07, 0xd0, 0xfb, 0xd6, 0x8d, 0x82,
-  0xd4, 0x15, 0x47, 0xb7, 0xa9, 0x1c, 0xe8, 0xdf, 0xf0, 0x1c, 0xb7, 0x56,
-  0xe1, 0x49, 0xb1, 0xbf, 0x4f, 0x30, 0xc2, 0xb6, 0x8c, 0x0e, 0x95, 0x5a,
-  0xbe, 0x26, 0x6e, 0x14, 0xf8, 0x0a, 0x73, 0x01, 0x80, 0xbd, 0x12, 0xc6,
-  0x01, 0xf4, 0x3e, 0x9d, 0x71, 0xf4, 0x34, 0xe1, 0x32, 0xed, 0xb0, 0x59,
-  0x00, 0x0c, 0x00, 0xb0, 0x17, 0x7e, 0xac, 0x07, 0xd0, 0xfb, 0xd6, 0x74,
-  0xc6, 0x09, 0x2e, 0x00, 0x00, 0x00, 0xb2, 0x23, 0x8c, 0x03, 0xe8, 0x7d,
-  0x3a, 0xe3, 0x00, 0x00, 0x00, 0x3a, 0x84, 0x30, 0x0e, 0xa0, 0xf7, 0xe9,
-  0x8c, 0x03, 0x00, 0x00, 0xe8, 0x10, 0xc2, 0x38, 0x80, 0xde, 0x37, 0x96,
-  0x75, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x13, 0xc6, 0x01, 0xf4, 0xbe, 0xe3,
-  0x8d, 0x17, 0xc7, 0x74, 0xc6, 0x01, 0x00, 0x00, 0x64, 0x46, 0x18, 0x07,
-  0xd0, 0xc3, 0x92, 0x24, 0x19, 0xcb, 0xba, 0x06, 0x00, 0x00, 0x00, 0xbe,
-  0x27, 0x8c, 0x03, 0xe8, 0x6d, 0x63, 0xcd, 0x0b, 0xce, 0x8c, 0x03, 0x00,
-  0x00, 0xc8, 0x8e, 0x30, 0x0e, 0xa0, 0xb7, 0x8d, 0x65, 0x5d, 0x00, 0x00,
-  0x00, 0x00, 0xdf, 0x13, 0xc6, 0x01, 0xf4, 0xb6, 0xb1, 0xc6, 0x8b, 0xe1,
-  0x72, 0x31, 0xa3, 0x32, 0x00, 0x00, 0x00, 0x88, 0x10, 0xc6, 0x01, 0xf4,
-  0xba, 0xc1, 0xc6, 0x8b, 0x62, 0xbf, 0x97, 0x7d, 0x00, 0x00, 0x80, 0x2c,
-  0xb9, 0x2b, 0x03, 0xe8, 0x6d, 0x93, 0x8d, 0x17, 0x3a, 0xe3, 0x00, 0x00,
-  0x00, 0xb2, 0x25, 0x8c, 0x03, 0xc8, 0x11, 0x9d, 0x71, 0x00, 0x40, 0x44,
-  0xc4, 0xdc, 0xc3, 0x85, 0x56, 0xcb, 0x9f, 0xa7, 0x5c, 0x06, 0x40, 0x2e,
-  0xb9, 0x2b, 0x03, 0xe8, 0x6d, 0x2f, 0x35, 0x5e, 0x54, 0x4a, 0x85, 0xac,
-  0xea, 0x00, 0x00, 0x3a, 0x48, 0x75, 0x7e, 0x71, 0xdd, 0x5a, 0xbd, 0x5e,
-  0xff, 0x3c, 0xfd, 0x4a, 0x00, 0xf2, 0x47, 0x18, 0x07, 0x90, 0x23, 0x95,
-  0x03, 0xfd, 0x59, 0x97, 0x00, 0x00, 0x00, 0x90, 0x6b, 0xc2, 0x38, 0x80,
-  0x1e, 0x95, 0x24, 0xc9, 0x64, 0xf3, 0x9a, 0x6d, 0xaa, 0x00, 0x00, 0x00,
-  0xd9, 0x72, 0x57, 0x06, 0xd0, 0xbb, 0x06, 0x9b, 0x17, 0x0c, 0x70, 0x00,
-  0x00, 0x00, 0xc8, 0x96, 0x30, 0x0e, 0xa0, 0x77, 0x8d, 0x65, 0x5d, 0x00,
-  0x00, 0x00, 0x00, 0x6b, 0x09, 0xe3, 0x00, 0x7a, 0xd7, 0x58, 0xe3, 0xc5,
-  0xe8, 0x50, 0x29, 0xa3, 0x32, 0x00, 0x00, 0x00, 0x58, 0x25, 0x8c, 0x03,
-  0xe8, 0x5d, 0xeb, 0xb6, 0xa9, 0x02, 0x00, 0x00, 0x90, 0x2d, 0x61, 0x1c,
-  0x40, 0xef, 0x5a, 0x33, 0xc0, 0xc1, 0x79, 0x71, 0x00, 0x00, 0x00, 0xd9,
-  0x13, 0xc6, 0x01, 0xe4, 0x84, 0x49, 0xaa, 0x00, 0xc0, 0xaa, 0x6f, 0x17,
-  0x96, 0xb2, 0x2e, 0x01, 0x20, 0xb7, 0xdc, 0x99, 0x01, 0xf4, 0xae, 0x97,
-  0x1a, 0x2f, 0x1e, 0x17, 0xc6, 0x01, 0x00, 0x2b, 0x66, 0xab, 0xb5, 0xe6,
-  0xa5, 0xf7, 0xb3, 0xa8, 0x03, 0x20, 0x8f, 0xdc, 0x99, 0x01, 0xe4, 0x84,
-  0x6d, 0xaa, 0x00, 0x00, 0x00, 0xd9, 0x13, 0xc6, 0x01, 0xf4, 0xa0, 0x24,
-  0x49, 0xc6, 0xb2, 0xae, 0x01, 0x00, 0x00, 0x80, 0xf5, 0x84, 0x71, 0x00,
-  0xbd, 0x69, 0xac, 0x79, 0x61, 0x74, 0xa8, 0x94, 0x41, 0x19, 0x00, 0x00,
-  0x00, 0x34, 0x12, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x4a, 0x84, 0x71,
-  0x00, 0xbd, 0xe9, 0x5c, 0xe3, 0x45, 0xb9, 0x54, 0xc8, 0xa8, 0x0c, 0x00,
-  0x00, 0x00, 0x1a, 0x09, 0xe3, 0x00, 0x72, 0xa0, 0x72, 0xa0, 0x3f, 0xeb,
-  0x12, 0x00, 0x80, 0x0e, 0x32, 0x73, 0x77, 0xbe, 0x79, 0xe9, 0x6a, 0x16,
-  0x75, 0x00, 0xe4, 0x91, 0x30, 0x0e, 0xa0, 0x37, 0x8d, 0x65, 0x5d, 0x00,
-  0x00, 0xd0, 0x55, 0xee, 0x65, 0x5d, 0x00, 0x40, 0x5e, 0x08, 0xe3, 0x00,
-  0x7a, 0xd3, 0x58, 0xe3, 0x85, 0xe1, 0x0d, 0x00, 0x00, 0x00, 0x9d, 0x41,
-  0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0xc6, 0x01, 0xf4, 0xa6,
-  0x97, 0x1a, 0x2f, 0x2a, 0x06, 0x38, 0x00, 0x00, 0x00, 0x74, 0x04, 0x61,
-  0x1c, 0x40, 0x0e, 0x18, 0xe0, 0x00, 0x00, 0x34, 0x6a, 0x31, 0xc0, 0xe1,
-  0xf3, 0x0c, 0xca, 0x00, 0xc8, 0x25, 0x61, 0x1c, 0x40, 0x8f, 0x49, 0x92,
-  0x64, 0x2c, 0xeb, 0x1a, 0x00, 0x80, 0xae, 0xf3, 0x79, 0xd6, 0x05, 0x00,
-  0xe4, 0x85, 0x30, 0x0e, 0xa0, 0xf7, 0x8c, 0x35, 0x2f, 0x18, 0xe0, 0x00,
-  0x00, 0x00, 0xd0, 0x19, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x90, 0x12,
-  0x61, 0x1c, 0x40, 0xef, 0x99, 0x6c, 0xbc, 0x28, 0x16, 0xbc, 0xd4, 0x03,
-  0x00, 0xdf, 0x9b, 0x7b, 0xb8, 0x90, 0x75, 0x09, 0x00, 0xb9, 0xe6, 0x0e,
-  0x0d, 0xa0, 0xf7, 0x0c, 0x36, 0x5e, 0x0c, 0x57, 0x8a, 0x59, 0xd5, 0x01,
-  0x00, 0x74, 0xa0, 0xea, 0xfc, 0xe2, 0xba, 0xb5, 0x7a, 0xbd, 0x7e, 0x29,
-  0xfd, 0x4a, 0x00, 0xf2, 0x49, 0x18, 0x07, 0xd0, 0x7b, 0x06, 0xb7, 0x7e,
-  0x0a, 0x00, 0x00, 0x00, 0x59, 0x10, 0xc6, 0x01, 0xf4, 0x9e, 0x35, 0xdb,
-  0x54, 0x87, 0xcb, 0x3a, 0xe3, 0x00, 0x00, 0x00, 0x3a, 0x85, 0x30, 0x0e,
-  0xa0, 0xc7, 0x15, 0xfb, 0xbd, 0xd4, 0x03, 0x00, 0xdf, 0xfb, 0x76, 0x61,
-  0x29, 0xeb, 0x12, 0x00, 0x72, 0xcd, 0x1d, 0x1a, 0x40, 0xef, 0x19, 0xcb,
-  0xba, 0x00, 0x00, 0xa0, 0x73, 0xcd, 0x56, 0x6b, 0xcd, 0x4b, 0xef, 0x67,
-  0x51, 0x07, 0x40, 0x5e, 0x09, 0xe3, 0x00, 0x7a, 0xcf, 0xf1, 0xc6, 0x8b,
-  0x63, 0x43, 0xa5, 0xac, 0xea, 0x00, 0x00, 0x00, 0xa0, 0x89, 0x30, 0x0e,
-  0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x8c, 0x03, 0xe8, 0x21, 0x49, 0x92,
-  0x4c, 0x36, 0xaf, 0x39, 0x33, 0x0e, 0x00, 0x68, 0x54, 0x7d, 0xb8, 0x90,
-  0x75, 0x09, 0x00, 0xb9, 0xe6, 0x0e, 0x0d, 0xa0, 0xb7, 0x0c, 0x36, 0x2f,
-  0x98, 0xa6, 0x0a, 0x00, 0x34, 0x9a, 0x9b, 0x5f, 0x6c, 0x5e, 0xba, 0x94,
-  0x41, 0x19, 0x00, 0xb9, 0x25, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x94,
-  0x08, 0xe3, 0x00, 0x7a, 0xcb, 0xb9, 0xc6, 0x8b, 0x72, 0xa9, 0x90, 0x51,
-  0x19, 0x00, 0x00, 0x00, 0xb4, 0x22, 0x8c, 0x03, 0xe8, 0x61, 0x95, 0x03,
-  0xfd, 0x59, 0x97, 0x00, 0x00, 0x74, 0x98, 0xd9, 0xb9, 0x5a, 0xf3, 0xd2,
-  0xbd, 0x2c, 0xea, 0x00, 0xc8, 0x2b, 0x61, 0x1c, 0x00, 0x00, 0x40, 0x8e,
-  0xd4, 0x16, 0x97, 0x9a, 0x97, 0xae, 0x66, 0x51, 0x07, 0x40, 0x5e, 0x09,
-  0xe3, 0x00, 0x7a, 0xcb, 0xb9, 0xc6, 0x8b, 0x8a, 0x6d, 0xaa, 0x00, 0x00,
-  0x00, 0x1d, 0x45, 0x18, 0x07, 0xd0, 0xc3, 0xca, 0xb6, 0xa9, 0x02, 0x00,
-  0x0d, 0x6a, 0x0b, 0xeb, 0xba, 0xe2, 0x00, 0x48, 0x99, 0x30, 0x0e, 0xa0,
-  0xb7, 0x0c, 0x66, 0x5d, 0x00, 0x00, 0xd0, 0xb9, 0x66, 0xab, 0xeb, 0xce,
-  0x8b, 0x8b, 0xb0, 0x4d, 0x15, 0x20, 0x55, 0xc2, 0x38, 0x80, 0xde, 0x72,
-  0xa6, 0xf1, 0x62, 0xb8, 0x5c, 0xcc, 0xaa, 0x0e, 0x00, 0xa0, 0x4b, 0xd4,
-  0xeb, 0x75, 0x03, 0x1c, 0x00, 0x52, 0x24, 0x8c, 0x03, 0xe8, 0x61, 0x8f,
-  0xf7, 0x7b, 0x99, 0x07, 0x00, 0x00, 0xe8, 0x24, 0xee, 0xd2, 0x00, 0x7a,
-  0x44, 0x92, 0x24, 0xb6, 0xa8, 0x02, 0x00, 0x9b, 0x6a, 0xb1, 0x4d, 0xf5,
-  0x8b, 0x2c, 0xea, 0x00, 0xc8, 0x33, 0x61, 0x1c, 0x40, 0xef, 0x98, 0x6c,
-  0x5e, 0xb0, 0x4d, 0x15, 0x00, 0x68, 0xf4, 0xed, 0xfa, 0x01, 0x0e, 0x9f,
-  0x67, 0x50, 0x06, 0x40, 0xae, 0x09, 0xe3, 0x00, 0x7a, 0x58, 0xd1, 0x36,
-  0x55, 0x00, 0x00, 0x80, 0x8e, 0x52, 0xc8, 0xba, 0x00, 0x00, 0xf6, 0x8d,
-  0x6d, 0xaa, 0x90, 0x23, 0xb5, 0x85, 0xa5, 0x35, 0xdb, 0xcd, 0xbe, 0x6d,
-  0xba, 0x5e, 0x35, 0x5b, 0xad, 0x45, 0x6d, 0x7d, 0x27, 0xcc, 0xae, 0x0c,
-  0x97, 0x8b, 0xeb, 0x42, 0xfe, 0xc7, 0xfb, 0xfb, 0xd6, 0x74, 0xe1, 0x96,
-  0x4b, 0x85, 0xa8, 0x1c, 0xe8, 0xdf, 0x97, 0xff, 0x1e, 0xb0, 0xff, 0xaa,
-  0x0f, 0x17, 0x9a, 0x97, 0x0c, 0x6f, 0x00, 0x48, 0x99, 0x30, 0x0e, 0xa0,
-  0x77, 0xac, 0xd9, 0xa6, 0x6a, 0x8b, 0x2a, 0x74, 0xa7, 0xd5, 0xf0, 0x6c,
-  0xee, 0xe1, 0x42, 0xcc, 0xcd, 0x2f, 0x46, 0x44, 0xc4, 0xcc, 0xdd, 0xf9,
-  0x88, 0x58, 0x1f, 0xc0, 0xa5, 0x6d, 0xb5, 0x8e, 0xed, 0x2a, 0x16, 0xfa,
-  0x62, 0xb8, 0xb2, 0xfc, 0x5a, 0x54, 0x29, 0x15, 0xa2, 0xbc, 0x12, 0xd2,
-  0x1d, 0x1b, 0x2a, 0x45, 0x44, 0xeb, 0x70, 0x0f, 0x68, 0xaf, 0xd5, 0xd7,
-  0x95, 0x06, 0x57, 0xb3, 0xa8, 0x03, 0x20, 0xcf, 0x84, 0x71, 0x00, 0x3d,
-  0xca, 0x0d, 0x2e, 0x74, 0xa6, 0xd5, 0x40, 0x6d, 0x35, 0x6c, 0x5b, 0x0d,
-  0xdf, 0x76, 0x1a, 0x74, 0x75, 0x83, 0xda, 0xe2, 0xf7, 0xff, 0xbb, 0x66,
-  0x1a, 0xd6, 0x7f, 0xdb, 0xf4, 0xbc, 0xd5, 0x50, 0x6e, 0xf5, 0xdf, 0xc7,
-  0x86, 0x4a, 0x8f, 0xae, 0x01, 0x00, 0x7a, 0x8d, 0x30, 0x0e, 0xa0, 0x77,
-  0xd8, 0xa6, 0x0a, 0x1d, 0x64, 0x35, 0x74, 0xbb, 0x79, 0x77, 0x3e, 0xaa,
-  0x2b, 0xc1, 0x5b, 0x2f, 0x06, 0x6e, 0xfb, 0x61, 0xb5, 0xdb, 0x6f, 0xf5,
-  0xeb, 0xd3, 0x18, 0xd6, 0x0d, 0x97, 0x8b, 0x51, 0x3e, 0x50, 0x88, 0xe1,
-  0x72, 0x31, 0x86, 0xcb, 0xc5, 0xa8, 0xac, 0xfc, 0x1a, 0xd8, 0x9d, 0xb9,
-  0xf5, 0xdb, 0x54, 0x01, 0x48, 0x99, 0x30, 0x0e, 0xa0, 0x77, 0xd8, 0xa6,
-  0x0a, 0x19, 0x99, 0x7b, 0xb8, 0x10, 0xb3, 0xd5, 0xef, 0x62, 0xb6, 0x5a,
-  0x8b, 0x99, 0xbb, 0xf3, 0x31, 0x3b, 0x57, 0x8b, 0xda, 0xe2, 0xfe, 0x9c,
-  0xd3, 0xb6, 0x13, 0x53, 0xc5, 0x63, 0xeb, 0xd6, 0x46, 0x0b, 0x95, 0x38,
-  0x56, 0xa8, 0xec, 0xcb, 0x9f, 0x7f, 0xf9, 0xdb, 0x9b, 0xeb, 0xd6, 0x3e,
-  0x5e, 0xb8, 0x13, 0xd5, 0xa5, 0xf6, 0x6d, 0x9d, 0x9d, 0xad, 0xd6, 0x62,
-  0xb6, 0x5a, 0x8b, 0x4f, 0x6f, 0x3f, 0x58, 0xb3, 0x3e, 0x3a, 0x54, 0x5a,
-  0x09, 0xe8, 0x1e, 0x8b, 0xe1, 0x4a, 0xd1, 0x6b, 0x1e, 0x6c, 0x53, 0x75,
-  0xfd, 0x36, 0xd5, 0x4b, 0x19, 0x94, 0x01, 0x90, 0x6b, 0xc2, 0x38, 0x80,
-  0x1e, 0x65, 0x9b, 0x2a, 0xb4, 0xcf, 0x6a, 0xe8, 0x76, 0x73, 0x25, 0x78,
-  0x6b, 0x71, 0x73, 0xbb, 0x2f, 0x56, 0xc3, 0xb5, 0x89, 0xc7, 0x8e, 0x44,
-  0xa5, 0x6f, 0x39, 0x6c, 0xfa, 0xc3, 0xe2, 0xf1, 0x47, 0x8f, 0x4f, 0x3c,
-  0x36, 0x1c, 0x95, 0xbe, 0xc7, 0xdb, 0xf2, 0xdf, 0x6e, 0x69, 0x1b, 0x99,
-  0xde, 0xc7, 0xdf, 0x7d, 0x1f, 0xce, 0xdd, 0xfc, 0xd7, 0x7b, 0x71, 0x73,
-  0x71, 0x2e, 0x22, 0xbe, 0x0f, 0xf2, 0x6e, 0xfe, 0xeb, 0x5c, 0xcc, 0xac,
-  0xac, 0xed, 0xc5, 0xcc, 0xdd, 0xf9, 0x75, 0x9d, 0x86, 0xa3, 0x43, 0xa5,
-  0x47, 0x21, 0xdd, 0xea, 0x56, 0x57, 0x00, 0x80, 0x4e, 0x23, 0x8c, 0x03,
-  0x00, 0xd8, 0xc2, 0x6a, 0xf8, 0x76, 0xfd, 0xf6, 0x83, 0x7d, 0xdd, 0x6a,
-  0x3a, 0x55, 0x3c, 0x16, 0xe5, 0xbe, 0x62, 0x3c, 0xfb, 0xd8, 0x91, 0xa8,
-  0xf4, 0x3d, 0x1e, 0xcf, 0xf6, 0x1f, 0x79, 0x74, 0xdd, 0xad, 0x1a, 0x6b,
-  0x9f, 0x8a, 0x86, 0x4e, 0xbd, 0xa6, 0x20, 0x6f, 0x6e, 0xe9, 0xdb, 0x98,
-  0xfe, 0x6e, 0x36, 0xe6, 0xea, 0xdf, 0xc6, 0xc7, 0xdf, 0xdd, 0x89, 0xb9,
-  0xa5, 0x5a, 0x4c, 0x7f, 0x77, 0x67, 0x4f, 0x61, 0x5d, 0x73, 0x40, 0x37,
-  0x5c, 0x2e, 0x3e, 0x0a, 0xe8, 0x84, 0x73, 0x10, 0xfb, 0x36, 0x59, 0x19,
-  0x80, 0xbd, 0x49, 0xea, 0xf5, 0x7a, 0xd6, 0x35, 0x00, 0xb0, 0x0f, 0x92,
-  0x24, 0x59, 0xf3, 0x82, 0x7e, 0xe1, 0xcc, 0x70, 0x4c, 0x8c, 0x96, 0xb3,
-  0x2a, 0x07, 0xba, 0xda, 0xdc, 0xc3, 0x85, 0xe5, 0xf0, 0xed, 0xce, 0x83,
-  0x98, 0xf9, 0x6a, 0x7e, 0x4f, 0x5b, 0x4e, 0xcb, 0x7d, 0xc5, 0x78, 0xb6,
-  0xff, 0x48, 0x4c, 0x3c, 0x76, 0x24, 0x8e, 0x15, 0x2a, 0x2b, 0xbf, 0x4e,
-  0xb9, 0xa3, 0xad, 0x0b, 0x7d, 0xfc, 0xdd, 0x9d, 0x98, 0xf9, 0xd7, 0xb9,
-  0xf8, 0xf8, 0xbb, 0x3b, 0x8f, 0x7e, 0x3d, 0xfd, 0xdd, 0xec, 0x9e, 0xfe,
-  0xcc, 0xe1, 0x72, 0x31, 0x4e, 0x8e, 0x0c, 0xc4, 0xf8, 0xc8, 0x80, 0x6d,
-  0xad, 0xe4, 0xd2, 0xcc, 0xdd, 0xf9, 0xf8, 0xe5, 0x3f, 0xff, 0xae, 0x79,
-  0xf9, 0x07, 0xf5, 0x7a, 0xfd, 0x5e, 0x16, 0xf5, 0x00, 0xe4, 0x95, 0x30,
-  0x0e, 0xa0, 0x47, 0x34, 0x87, 0x71, 0xaf, 0xbd, 0xf0, 0x74, 0x8c, 0x0e,
-  0x95, 0xb2, 0x2a, 0x07, 0xba, 0xce, 0x6a, 0xf7, 0xdb, 0xf4, 0xcc, 0xfd,
-  0x47, 0x03, 0x05, 0x76, 0x6a, 0xb4, 0x50, 0x89, 0x89, 0xfe, 0xe1, 0x78,
-  0xf6, 0xb1, 0x23, 0xf1, 0x87, 0xc5, 0xe3, 0x42, 0xb7, 0x36, 0xb8, 0xfc,
-  0xed, 0xcd, 0xb8, 0xf9, 0xaf, 0xf7, 0xe2, 0xe3, 0xef, 0x66, 0x63, 0xfa,
-  0xbb, 0x3b, 0x71, 0xb9, 0xb6, 0xfe, 0x1c, 0xbb, 0xed, 0x28, 0x16, 0xfa,
-  0x62, 0x7c, 0x64, 0x20, 0x4e, 0x8e, 0x3c, 0x11, 0xe3, 0x23, 0x03, 0xfb,
-  0x5c, 0x25, 0x74, 0xa6, 0x56, 0x61, 0x5c, 0xbd, 0x5e, 0x4f, 0x32, 0x2a,
-  0x07, 0x20, 0xb7, 0x84, 0x71, 0x00, 0x3d, 0x42, 0x18, 0x07, 0x3b, 0x37,
-  0x5b, 0xad, 0xc5, 0xf4, 0xcc, 0xfd, 0xb8, 0x7e, 0xfb, 0x9b, 0x5d, 0x9d,
-  0xfb, 0x36, 0x55, 0x3c, 0x16, 0x53, 0x8f, 0x1f, 0x13, 0xbc, 0x65, 0xec,
-  0xe3, 0x95, 0x50, 0x6e, 0xf5, 0xdf, 0x3b, 0xdd, 0xe6, 0x2a, 0x98, 0x23,
-  0x2f, 0xae, 0xdf, 0x7e, 0x10, 0xef, 0x7c, 0xf8, 0xe5, 0x9a, 0x35, 0x61,
-  0x1c, 0x40, 0xfa, 0x9c, 0x19, 0x07, 0xd0, 0x03, 0x92, 0x24, 0x39, 0xd7,
-  0xbc, 0x56, 0x2e, 0x79, 0x89, 0x87, 0x56, 0x6a, 0x0b, 0x4b, 0x31, 0x7d,
-  0xab, 0xba, 0xab, 0x0e, 0xb8, 0x0b, 0xa5, 0xf1, 0xf8, 0xc3, 0xc7, 0x8f,
-  0xc7, 0x54, 0xf1, 0x58, 0x57, 0x9f, 0xeb, 0xd6, 0x6b, 0x9e, 0x7d, 0xec,
-  0xc8, 0x9a, 0xff, 0x3f, 0x6e, 0x2e, 0xce, 0xc5, 0xe5, 0xda, 0x17, 0xf1,
-  0x1f, 0xbf, 0xbd, 0xb9, 0xad, 0x70, 0xae, 0xb6, 0xb8, 0x14, 0xd3, 0xb7,
-  0xee, 0xc7, 0xf4, 0xad, 0xfb, 0x8f, 0x82, 0xb9, 0xb3, 0xcf, 0x0c, 0xda,
-  0xca, 0x4a, 0xcf, 0x69, 0xf1, 0x9a, 0xf7, 0x51, 0x16, 0x75, 0x00, 0xe4,
-  0x9d, 0x3b, 0x35, 0x80, 0x1e, 0x55, 0x39, 0xd0, 0x9f, 0x75, 0x09, 0xd0,
-  0x51, 0x66, 0xee, 0xce, 0xc7, 0x87, 0x37, 0xee, 0xc5, 0xa7, 0xb7, 0x1f,
-  0x6c, 0xfb, 0xf7, 0x4c, 0x3c, 0x36, 0x1c, 0x53, 0xc5, 0xe3, 0xf1, 0xa7,
-  0xa5, 0x53, 0x31, 0xf5, 0xf8, 0xb1, 0xad, 0x7f, 0x03, 0x1d, 0xe1, 0x58,
-  0xa1, 0x12, 0xc7, 0x0a, 0x3f, 0x8a, 0x1f, 0x0f, 0xfc, 0x28, 0x22, 0xbe,
-  0x0f, 0xe7, 0xfe, 0xaf, 0x87, 0xd7, 0xe2, 0x72, 0xed, 0xe6, 0xa3, 0x69,
-  0xaf, 0xad, 0x34, 0x06, 0x73, 0xe5, 0x52, 0x21, 0x9e, 0x7b, 0x66, 0x30,
-  0x26, 0x8e, 0x96, 0x0d, 0x7f, 0xa0, 0x57, 0x39, 0x2b, 0x0e, 0x20, 0x03,
-  0xc2, 0x38, 0x00, 0xa0, 0x67, 0xad, 0x76, 0xc1, 0x7d, 0xf8, 0xd9, 0xbd,
-  0x6d, 0x6f, 0x43, 0xbd, 0x50, 0x1a, 0x8f, 0x3f, 0x3d, 0x70, 0x2a, 0xa6,
-  0x8a, 0xc7, 0xe3, 0x58, 0xa1, 0xb2, 0xf5, 0x6f, 0xa0, 0xe3, 0x35, 0x87,
-  0x73, 0xbf, 0x99, 0xbf, 0x16, 0xff, 0xf1, 0xdb, 0x9b, 0xf1, 0x9b, 0xf9,
-  0x6b, 0x9b, 0x76, 0xcd, 0x55, 0xe7, 0x17, 0xe3, 0xbd, 0x4f, 0xbe, 0x8a,
-  0xf7, 0x3e, 0xf9, 0x2a, 0x26, 0x8e, 0x1e, 0xd4, 0x2d, 0x47, 0xd7, 0x33,
-  0x4d, 0x15, 0xa0, 0x33, 0x08, 0xe3, 0x00, 0x7a, 0xc3, 0x64, 0xe3, 0x45,
-  0xb1, 0xa0, 0x83, 0x83, 0x7c, 0x9b, 0x7b, 0xb8, 0x10, 0xd3, 0xb7, 0xee,
-  0xc7, 0x95, 0xcf, 0xee, 0x6d, 0x6b, 0x12, 0xea, 0x6a, 0x00, 0xf7, 0x72,
-  0xe9, 0x94, 0x73, 0xdf, 0x72, 0xe0, 0xe5, 0xd2, 0xf2, 0xff, 0xd7, 0x7f,
-  0xf3, 0x83, 0x3f, 0x89, 0x8f, 0xbf, 0xbb, 0x13, 0xff, 0xf8, 0xe0, 0xe3,
-  0x2d, 0x83, 0xb9, 0xd5, 0x6e, 0xb9, 0xd1, 0xa1, 0x52, 0x4c, 0x9d, 0x3a,
-  0xe4, 0x4c, 0x4e, 0xba, 0x52, 0x8b, 0x6d, 0xaa, 0x57, 0xb3, 0xa8, 0x03,
-  0x20, 0xef, 0x84, 0x71, 0x00, 0xbd, 0x61, 0xb0, 0xf1, 0x62, 0xb8, 0xa2,
-  0x73, 0x83, 0x7c, 0x9a, 0x7b, 0xb8, 0x10, 0xbf, 0xbd, 0xf6, 0x75, 0x4c,
-  0xdf, 0xba, 0xbf, 0xe5, 0x73, 0x27, 0x1e, 0x1b, 0x8e, 0x9f, 0x1e, 0x7c,
-  0x5e, 0x00, 0x97, 0x73, 0xab, 0xe7, 0xcd, 0xfd, 0xcd, 0x0f, 0xfe, 0x24,
-  0x2e, 0x7f, 0x7b, 0x33, 0xfe, 0xf7, 0x07, 0xff, 0x39, 0x7e, 0x33, 0x7f,
-  0x6d, 0xc3, 0xad, 0xac, 0xab, 0xd3, 0x28, 0x85, 0x72, 0xf4, 0x08, 0xdb,
-  0x54, 0x01, 0x32, 0x20, 0x8c, 0x03, 0x00, 0xba, 0x5e, 0x6d, 0x61, 0x29,
-  0x3e, 0xbc, 0x71, 0x2f, 0x7e, 0x7b, 0xed, 0xeb, 0x4d, 0x9f, 0x57, 0xee,
-  0x2b, 0xc6, 0x8f, 0x07, 0x7e, 0x14, 0x3f, 0x3d, 0xf8, 0xbc, 0x2d, 0xa8,
-  0xac, 0x33, 0xf5, 0xf8, 0xf2, 0x74, 0xdc, 0xb9, 0xa5, 0x6f, 0xe3, 0x37,
-  0xf3, 0xd7, 0xe2, 0x1f, 0xee, 0x7f, 0x10, 0xd3, 0xdf, 0xcd, 0xb6, 0x7c,
-  0xae, 0x50, 0x8e, 0x6e, 0x64, 0x9b, 0x2a, 0x40, 0x67, 0x10, 0xc6, 0x01,
-  0xf4, 0x86, 0xb1, 0xac, 0x0b, 0x80, 0xac, 0x5c, 0xb9, 0x71, 0x2f, 0x2e,
-  0xff, 0xcb, 0xd7, 0x9b, 0x6e, 0x47, 0x1d, 0x2d, 0x54, 0xe2, 0x67, 0x95,
-  0x3f, 0x7c, 0x74, 0x66, 0x18, 0x6c, 0xa6, 0xd2, 0xf7, 0x78, 0xfc, 0x78,
-  0x60, 0xf9, 0x8c, 0xb9, 0x8f, 0xbf, 0xbb, 0x13, 0xff, 0x70, 0xff, 0x83,
-  0xf8, 0xe5, 0x83, 0x8f, 0x5b, 0x3e, 0x77, 0x35, 0x94, 0x3b, 0x39, 0x32,
-  0x10, 0xe7, 0xff, 0xe0, 0xb0, 0xe1, 0x39, 0x74, 0x34, 0xdb, 0x54, 0x01,
-  0x3a, 0x83, 0x30, 0x0e, 0xa0, 0x37, 0x8c, 0x35, 0x5e, 0xe8, 0xd0, 0x20,
-  0x0f, 0x66, 0xab, 0xb5, 0x78, 0xf7, 0xea, 0x6c, 0xab, 0x9b, 0xcb, 0x47,
-  0xa6, 0x8a, 0xc7, 0xe2, 0x67, 0x95, 0x3f, 0x32, 0x09, 0x95, 0x5d, 0x7b,
-  0xf6, 0xb1, 0x23, 0xf1, 0xf7, 0x43, 0x7f, 0x16, 0x3f, 0xab, 0xfc, 0x51,
-  0xfc, 0xe3, 0x83, 0xff, 0x1c, 0xff, 0x70, 0xff, 0x83, 0x96, 0x5b, 0x58,
-  0x3f, 0xbd, 0xfd, 0x20, 0x66, 0xbe, 0x9a, 0x8f, 0xb3, 0xcf, 0x0c, 0xc6,
-  0xd4, 0xa9, 0x43, 0x19, 0x54, 0x0a, 0xbb, 0x62, 0x9b, 0x2a, 0x40, 0x06,
-  0x84, 0x71, 0x00, 0x40, 0xd7, 0xb9, 0x7c, 0xed, 0xeb, 0x4d, 0xb7, 0xa4,
-  0x0a, 0xe1, 0xd8, 0x6f, 0xc7, 0x0a, 0x95, 0xf8, 0x59, 0xe5, 0x8f, 0xe2,
-  0xa7, 0x07, 0x9f, 0x8f, 0x7f, 0xb8, 0xff, 0x41, 0xcb, 0x50, 0xae, 0xb6,
-  0xb8, 0x14, 0xbf, 0xbd, 0xf6, 0x75, 0x7c, 0x7a, 0xfb, 0x41, 0x5c, 0x98,
-  0x1c, 0x36, 0x79, 0x95, 0x8e, 0x62, 0x8b, 0x2a, 0x40, 0xe7, 0x48, 0xea,
-  0xf5, 0x7a, 0xd6, 0x35, 0x00, 0xb0, 0x47, 0x49, 0x92, 0x5c, 0x8a, 0x88,
-  0x97, 0x56, 0xaf, 0x5f, 0x3c, 0x75, 0x48, 0x67, 0x06, 0x3d, 0x69, 0xee,
-  0xe1, 0x42, 0xbc, 0xf3, 0xe1, 0xed, 0x0d, 0xbb, 0xe1, 0x46, 0x0b, 0x95,
-  0xf8, 0xfb, 0x43, 0x7f, 0x26, 0x84, 0xa3, 0xed, 0x6e, 0x2e, 0xce, 0xc5,
-  0xff, 0x3c, 0xf7, 0xff, 0x6d, 0xb8, 0x7d, 0xb5, 0x58, 0xe8, 0x8b, 0xa9,
-  0x1f, 0x1e, 0x8a, 0xb3, 0x27, 0x06, 0x5b, 0x3e, 0x0e, 0x69, 0x5b, 0xdd,
-  0x52, 0xdd, 0xa8, 0x5e, 0xaf, 0x27, 0x19, 0x95, 0x03, 0x90, 0x6b, 0xc2,
-  0x38, 0x80, 0x1e, 0x90, 0x24, 0xc9, 0x9a, 0x17, 0xf3, 0x0b, 0x67, 0x86,
-  0x63, 0x62, 0xb4, 0x9c, 0x55, 0x39, 0xd0, 0x16, 0xd7, 0x6f, 0x3f, 0x88,
-  0x77, 0xaf, 0xde, 0x69, 0x79, 0x36, 0x5c, 0xb9, 0xaf, 0xf8, 0xa8, 0x6b,
-  0x09, 0xd2, 0xf4, 0xf1, 0x77, 0x77, 0xe2, 0x7f, 0xfa, 0xaf, 0xff, 0x77,
-  0x5c, 0xae, 0xdd, 0x6c, 0xf9, 0xf8, 0xc4, 0xd1, 0x83, 0x71, 0xfe, 0xf4,
-  0x93, 0x51, 0xec, 0xef, 0x4b, 0xb9, 0x32, 0x58, 0x4b, 0x18, 0x07, 0xd0,
-  0x39, 0x7c, 0x2a, 0x00, 0xe8, 0x41, 0x0e, 0x10, 0xa7, 0xd7, 0x4c, 0xcf,
-  0x54, 0xe3, 0x9d, 0x0f, 0xbf, 0x6c, 0x19, 0xc4, 0x4d, 0x15, 0x8f, 0xc5,
-  0xfb, 0x23, 0x7f, 0x21, 0x88, 0x23, 0x13, 0xcf, 0x3e, 0x76, 0x24, 0x7e,
-  0x7d, 0xe4, 0x27, 0xf1, 0xef, 0x7f, 0xf0, 0x27, 0x51, 0xee, 0x5b, 0xbf,
-  0x2d, 0x75, 0xfa, 0xd6, 0xfd, 0xf8, 0xe5, 0x3f, 0xff, 0xce, 0x16, 0x41,
-  0x32, 0x37, 0xf7, 0x70, 0x21, 0xeb, 0x12, 0x00, 0x58, 0x21, 0x8c, 0x03,
-  0x00, 0x3a, 0xda, 0x7b, 0x9f, 0x7c, 0x15, 0xef, 0x7e, 0x34, 0xbb, 0x6e,
-  0xbd, 0xdc, 0x57, 0x8c, 0x7f, 0xff, 0x83, 0x3f, 0x89, 0x5f, 0x1f, 0xf9,
-  0x49, 0x1c, 0x2b, 0x54, 0x32, 0xa8, 0x0c, 0xbe, 0xf7, 0xd3, 0x83, 0xcf,
-  0xc7, 0xfb, 0x23, 0x7f, 0x11, 0x13, 0x8f, 0x0d, 0xaf, 0x7b, 0x6c, 0xb6,
-  0x5a, 0x13, 0xc8, 0x91, 0xb9, 0xb9, 0xf9, 0xc5, 0xe6, 0xa5, 0xf7, 0xb3,
-  0xa8, 0x03, 0x00, 0x61, 0x1c, 0x40, 0xd7, 0x4b, 0x92, 0x64, 0xb2, 0x79,
-  0xcd, 0x76, 0x28, 0x7a, 0xc5, 0xe5, 0x6b, 0x5f, 0xc7, 0x95, 0x1b, 0xeb,
-  0x87, 0xfd, 0x4d, 0x3c, 0x36, 0x1c, 0xbf, 0x1e, 0xfe, 0x89, 0x6e, 0x38,
-  0x3a, 0xca, 0xb1, 0x42, 0x25, 0xde, 0x1f, 0xf9, 0x8b, 0xf8, 0xb7, 0x2d,
-  0xbe, 0x2f, 0x05, 0x72, 0x00, 0xc0, 0x2a, 0x77, 0x6b, 0x00, 0xdd, 0x6f,
-  0xdd, 0xe9, 0xe0, 0x26, 0xf8, 0xd1, 0x0b, 0xa6, 0x67, 0xaa, 0x2d, 0x27,
-  0xa6, 0x4e, 0x15, 0x8f, 0xc5, 0xaf, 0x87, 0x7f, 0x12, 0xcf, 0x3e, 0x76,
-  0x24, 0x83, 0xaa, 0x60, 0x6b, 0x7f, 0xf3, 0x83, 0x3f, 0x89, 0xff, 0x30,
-  0xf4, 0xa7, 0xeb, 0xd6, 0x05, 0x72, 0x64, 0xa9, 0xba, 0x7e, 0x9b, 0xea,
-  0xfa, 0x9f, 0x74, 0x00, 0x90, 0x0a, 0x61, 0x1c, 0x00, 0xd0, 0x71, 0x66,
-  0xab, 0xb5, 0x96, 0x5b, 0x53, 0x5f, 0x1b, 0x78, 0x36, 0x7e, 0x7d, 0xe4,
-  0x27, 0x51, 0xe9, 0x7b, 0x3c, 0x83, 0xaa, 0x60, 0xfb, 0x7e, 0x3c, 0xf0,
-  0xa3, 0xf8, 0x0f, 0x43, 0x7f, 0xba, 0xee, 0x1c, 0xb9, 0xd9, 0x6a, 0x2d,
-  0xde, 0xfb, 0xe4, 0xf7, 0x19, 0x55, 0x45, 0x9e, 0xb5, 0xd8, 0xa6, 0x7a,
-  0x35, 0x8b, 0x3a, 0x00, 0x10, 0xc6, 0x01, 0xf4, 0x82, 0x75, 0x9d, 0x71,
-  0xd0, 0xcd, 0x6a, 0x0b, 0x4b, 0xf1, 0xab, 0x0f, 0xbe, 0x5c, 0xb7, 0xfe,
-  0xda, 0xc0, 0xb3, 0xf1, 0xf7, 0x43, 0x7f, 0x96, 0x41, 0x45, 0xb0, 0x3b,
-  0x3f, 0x1e, 0xf8, 0x51, 0xcb, 0xef, 0xd9, 0xe9, 0x5b, 0xf7, 0xe3, 0xfa,
-  0xed, 0x07, 0x19, 0x54, 0x04, 0x00, 0x74, 0x02, 0x61, 0x1c, 0x40, 0xf7,
-  0x5b, 0x73, 0x66, 0x9c, 0x2d, 0xaa, 0x74, 0xbb, 0x0f, 0x6f, 0xdc, 0x8b,
-  0x6a, 0x53, 0x07, 0xc7, 0xc4, 0x63, 0xc3, 0x82, 0x38, 0xba, 0xd2, 0xcb,
-  0xa5, 0x53, 0x2d, 0xb7, 0xac, 0xbe, 0x7b, 0xf5, 0x8e, 0xed, 0xaa, 0xa4,
-  0x6a, 0x76, 0xae, 0xd6, 0xbc, 0x64, 0x9b, 0x2a, 0x40, 0x46, 0x84, 0x71,
-  0x00, 0x3d, 0xc6, 0xf0, 0x06, 0xba, 0xd9, 0xdc, 0xc3, 0x85, 0x75, 0xe7,
-  0xc4, 0x95, 0xfb, 0x8a, 0xf1, 0xeb, 0xe1, 0x9f, 0x64, 0x54, 0x11, 0xec,
-  0xdd, 0x8f, 0x07, 0x7e, 0xb4, 0x6e, 0xa8, 0x43, 0x6d, 0x71, 0x29, 0x3e,
-  0x6c, 0x31, 0x9c, 0x04, 0xda, 0xa5, 0xb6, 0xb8, 0x2e, 0xfc, 0xb5, 0x4d,
-  0x15, 0x20, 0x23, 0xee, 0xd8, 0x00, 0x80, 0x8e, 0x71, 0xe5, 0xc6, 0xdc,
-  0xba, 0xb5, 0xbf, 0x1f, 0xfa, 0x33, 0x67, 0xc4, 0xd1, 0xf5, 0x7e, 0x56,
-  0xf9, 0xc3, 0x18, 0x2d, 0x54, 0xd6, 0xac, 0x5d, 0xf9, 0xec, 0x9e, 0xee,
-  0x38, 0x00, 0xc8, 0x21, 0x61, 0x1c, 0x40, 0xf7, 0x5b, 0xb3, 0x4d, 0x55,
-  0x67, 0x1c, 0xdd, 0x6c, 0x7a, 0xa6, 0xba, 0xe6, 0x7a, 0xaa, 0x78, 0x2c,
-  0x5e, 0x2e, 0x9d, 0xca, 0xa8, 0x1a, 0xd8, 0x3f, 0x95, 0xbe, 0xc7, 0xe3,
-  0xef, 0x0f, 0xad, 0xdd, 0x6a, 0x5d, 0x5b, 0x5c, 0x8a, 0xeb, 0xb7, 0xbf,
-  0xc9, 0xa8, 0x22, 0xf2, 0x64, 0xe6, 0xee, 0x7c, 0xab, 0xe5, 0xcf, 0x53,
-  0x2e, 0x03, 0x80, 0x15, 0xee, 0xd8, 0x00, 0xba, 0xdf, 0x9a, 0x01, 0x0e,
-  0xce, 0x8c, 0xa3, 0x5b, 0xcd, 0xdc, 0x9d, 0x5f, 0xb7, 0x8d, 0xea, 0x67,
-  0x95, 0x3f, 0xca, 0xa8, 0x1a, 0xd8, 0x7f, 0x53, 0x8f, 0x1f, 0x5b, 0xd7,
-  0x1d, 0x77, 0xfd, 0x8e, 0x41, 0x0e, 0x64, 0xa3, 0x5e, 0xaf, 0x7f, 0x9e,
-  0x75, 0x0d, 0x00, 0x79, 0x25, 0x8c, 0x03, 0x00, 0x3a, 0xc2, 0xcd, 0xa6,
-  0xce, 0x8d, 0xd1, 0x42, 0x25, 0xa6, 0x1e, 0x3f, 0x96, 0x51, 0x35, 0xd0,
-  0x1e, 0x3f, 0x6d, 0x3a, 0x3b, 0x6e, 0xe6, 0xab, 0x96, 0x1d, 0x4b, 0x00,
-  0x40, 0x0f, 0x13, 0xc6, 0x01, 0x74, 0xbf, 0xc1, 0xad, 0x9f, 0x02, 0x9d,
-  0xaf, 0x79, 0x1b, 0xd5, 0x54, 0x51, 0x10, 0x47, 0xef, 0x69, 0xfe, 0xbe,
-  0xae, 0x2d, 0x2e, 0xc5, 0xdc, 0xc3, 0x85, 0x8c, 0xaa, 0x21, 0x2f, 0x9a,
-  0x7f, 0xd8, 0x11, 0x11, 0x1f, 0x65, 0x51, 0x07, 0x00, 0xcb, 0x84, 0x71,
-  0x00, 0xdd, 0xef, 0x4c, 0xe3, 0x85, 0x6d, 0xaa, 0xf4, 0x8a, 0x63, 0x4d,
-  0xdb, 0xf9, 0xa0, 0x17, 0x3c, 0xfb, 0xd8, 0x91, 0x75, 0x6b, 0xd5, 0xf9,
-  0xc5, 0x0c, 0x2a, 0x21, 0xe7, 0x8c, 0xf2, 0x05, 0xc8, 0x90, 0x30, 0x0e,
-  0xa0, 0xc7, 0x3c, 0x6e, 0x80, 0x03, 0x00, 0xd0, 0xc0, 0xd4, 0x5e, 0x80,
-  0xce, 0xe2, 0x8e, 0x0d, 0x00, 0x00, 0xa0, 0x87, 0xcd, 0x56, 0x6b, 0xcd,
-  0x4b, 0x57, 0xb3, 0xa8, 0x03, 0x80, 0x65, 0xc2, 0x38, 0x80, 0x2e, 0x96,
-  0x24, 0xc9, 0x64, 0xf3, 0x5a, 0x51, 0x67, 0x1c, 0x3d, 0x62, 0x6e, 0x69,
-  0xdd, 0xcd, 0x23, 0x74, 0xbd, 0x8f, 0xbf, 0xbb, 0xb3, 0x6e, 0xad, 0x5c,
-  0x2a, 0x64, 0x50, 0x09, 0x39, 0x67, 0x9b, 0x2a, 0x40, 0x86, 0xdc, 0xb1,
-  0x01, 0x74, 0xb7, 0x75, 0xc3, 0x1b, 0x9c, 0x19, 0x47, 0xb7, 0x1a, 0x1d,
-  0x2a, 0xad, 0xb9, 0xbe, 0x5c, 0xfb, 0x22, 0xa3, 0x4a, 0xa0, 0x7d, 0xa6,
-  0x17, 0xd6, 0x87, 0x71, 0x95, 0x03, 0xfd, 0x19, 0x54, 0x42, 0x9e, 0x18,
-  0x12, 0x02, 0xd0, 0x59, 0x84, 0x71, 0x00, 0x40, 0x47, 0x68, 0x0e, 0x92,
-  0xa7, 0xbf, 0x9b, 0x6d, 0xd9, 0x45, 0x04, 0xdd, 0xec, 0x1f, 0xbf, 0xf9,
-  0x78, 0xcd, 0xf5, 0xc9, 0x91, 0x81, 0x8c, 0x2a, 0x21, 0x4f, 0x5a, 0x0c,
-  0x09, 0xb9, 0x94, 0x41, 0x19, 0x00, 0xac, 0x10, 0xc6, 0x01, 0x00, 0x1d,
-  0x61, 0x7c, 0x64, 0x20, 0x8a, 0x85, 0xb5, 0x1f, 0x4d, 0xfe, 0xe1, 0xfe,
-  0x07, 0x19, 0x55, 0x03, 0xfb, 0xef, 0xf2, 0xb7, 0x37, 0xe3, 0x72, 0xed,
-  0xe6, 0x9a, 0xb5, 0xf1, 0x23, 0xc2, 0x38, 0x00, 0xc8, 0x1b, 0x61, 0x1c,
-  0x40, 0x77, 0x3b, 0xd7, 0x78, 0xe1, 0xdc, 0x21, 0xfe, 0x7f, 0xf6, 0xee,
-  0x27, 0x46, 0xce, 0xf3, 0xbe, 0x13, 0xfc, 0xef, 0x21, 0xba, 0x5d, 0x6c,
-  0x2a, 0xee, 0xa6, 0x4d, 0x6f, 0x4b, 0x03, 0x0f, 0xc9, 0xd6, 0x40, 0xd2,
-  0x62, 0x61, 0x19, 0x6c, 0xc3, 0xc9, 0x21, 0x56, 0x66, 0xd9, 0x36, 0xe6,
-  0xe2, 0x64, 0x11, 0xd1, 0x7b, 0x58, 0x78, 0x07, 0x19, 0x88, 0xc2, 0x5e,
-  0x06, 0x08, 0xb0, 0x66, 0x16, 0x58, 0x0c, 0x30, 0x39, 0x98, 0x39, 0xcc,
-  0x61, 0xe6, 0x62, 0xe9, 0x12, 0x64, 0xb0, 0xbb, 0x23, 0xea, 0x90, 0xb5,
-  0x0e, 0x99, 0x35, 0xb5, 0x08, 0xec, 0x05, 0xd6, 0x18, 0x37, 0x31, 0x56,
-  0x32, 0xb3, 0x4e, 0x20, 0x32, 0xd2, 0xcc, 0x41, 0xca, 0x8c, 0x9a, 0xec,
-  0x75, 0x22, 0xb7, 0x87, 0x36, 0xab, 0x1d, 0xb1, 0xbb, 0xd4, 0x3d, 0xfd,
-  0xce, 0xa1, 0xaa, 0xc8, 0x97, 0xd5, 0x45, 0xb2, 0xff, 0xd5, 0xfb, 0xbc,
-  0x6f, 0xd5, 0xe7, 0x03, 0x34, 0xc8, 0x7a, 0xbb, 0x59, 0xfd, 0x35, 0x2c,
-  0x54, 0xf7, 0xfb, 0xad, 0xe7, 0x79, 0x7e, 0x4d, 0xf7, 0xec, 0xc0, 0x2a,
-  0xa1, 0x37, 0x3e, 0x7a, 0x27, 0xde, 0xda, 0xbc, 0xf5, 0x90, 0xaf, 0x86,
-  0x66, 0xf9, 0xc7, 0x77, 0xfe, 0xdf, 0x07, 0x1e, 0xb7, 0xa6, 0x8e, 0xc5,
-  0xb3, 0x4f, 0xfd, 0x52, 0xa6, 0x34, 0x4c, 0x8a, 0x21, 0xc3, 0x1b, 0x22,
-  0x9c, 0x19, 0x07, 0x90, 0x95, 0x32, 0x0e, 0x60, 0x8c, 0x38, 0x77, 0x88,
-  0xa6, 0xfb, 0xd2, 0x73, 0x9f, 0xde, 0x75, 0xed, 0xb7, 0x7f, 0xf6, 0xc7,
-  0xd1, 0xde, 0xd9, 0xcc, 0x90, 0x06, 0x8e, 0xce, 0x3f, 0x6d, 0xff, 0xeb,
-  0x78, 0xf7, 0xe3, 0xb5, 0x07, 0xae, 0x7d, 0xf1, 0xef, 0x9c, 0x34, 0x74,
-  0x87, 0x91, 0xeb, 0x6c, 0xed, 0xec, 0xba, 0x56, 0x14, 0x85, 0x69, 0xaa,
-  0x00, 0x19, 0xf9, 0xe9, 0x0f, 0x00, 0xd4, 0xc6, 0xdc, 0x89, 0xe9, 0x78,
-  0xfe, 0x6f, 0x7f, 0xf2, 0x81, 0x6b, 0xab, 0xdb, 0xed, 0xf8, 0xed, 0xdb,
-  0x7f, 0x9c, 0x29, 0x11, 0x1c, 0xde, 0x5b, 0x9b, 0xb7, 0xe2, 0x9f, 0xb5,
-  0x7f, 0xf8, 0xc0, 0xb5, 0xd6, 0xd4, 0xb1, 0xf8, 0xe5, 0xa7, 0x77, 0xcd,
-  0xe0, 0x01, 0x00, 0x26, 0x80, 0x32, 0x0e, 0xa0, 0xd9, 0xdc, 0xc9, 0x31,
-  0x76, 0xbe, 0xf2, 0xb9, 0xff, 0x6a, 0xd7, 0xd9, 0x71, 0xdf, 0xdb, 0x78,
-  0x5f, 0x21, 0x47, 0x23, 0xbd, 0xf3, 0xf1, 0x4f, 0xe2, 0xb7, 0xfe, 0xd3,
-  0x1f, 0xed, 0xba, 0xfe, 0xc2, 0x7f, 0xfd, 0x69, 0xab, 0xe2, 0xa8, 0xc4,
-  0xad, 0xdb, 0x1b, 0x83, 0x97, 0x8c, 0xaa, 0x06, 0xc8, 0xcc, 0x6f, 0x00,
-  0x00, 0xcd, 0xb6, 0x58, 0x7e, 0x70, 0xfa, 0xd4, 0x4c, 0xae, 0x1c, 0x70,
-  0x64, 0x5a, 0xd3, 0xc7, 0xe2, 0x6b, 0xbf, 0xf2, 0xb7, 0x76, 0x5d, 0x7f,
-  0xe3, 0xa3, 0x77, 0x14, 0x72, 0x34, 0xca, 0x3b, 0x1f, 0xff, 0x24, 0x7e,
-  0x73, 0xed, 0x0f, 0x63, 0x7d, 0xe7, 0xc1, 0x33, 0xbb, 0x9e, 0x79, 0xea,
-  0x89, 0xf8, 0xa2, 0x55, 0x71, 0xe4, 0xb3, 0x92, 0x3b, 0x00, 0xc0, 0xa4,
-  0x53, 0xc6, 0x01, 0x00, 0xb5, 0x73, 0xfa, 0xd4, 0xcc, 0xd0, 0xf3, 0xe3,
-  0x14, 0x72, 0x34, 0xc5, 0x77, 0x37, 0xde, 0x1b, 0x5a, 0xc4, 0xcd, 0xcf,
-  0xb6, 0xe2, 0xd7, 0xcf, 0x3d, 0x99, 0x29, 0x15, 0x00, 0x50, 0x07, 0xca,
-  0x38, 0x00, 0xa0, 0x96, 0x5e, 0x78, 0xee, 0xd3, 0xbb, 0xce, 0x8f, 0x8b,
-  0xe8, 0x16, 0x72, 0xe7, 0x3f, 0xfc, 0x3f, 0x0c, 0x75, 0xa0, 0xb6, 0xfe,
-  0xe0, 0x17, 0x3f, 0x8a, 0x7f, 0xf0, 0xd3, 0x7f, 0xb9, 0xab, 0x88, 0x6b,
-  0x4d, 0x1d, 0x8b, 0x0b, 0xbf, 0xfc, 0x94, 0xed, 0xa9, 0x54, 0x6a, 0x75,
-  0xf7, 0x36, 0x55, 0xc3, 0x1b, 0x00, 0x32, 0xf3, 0x9b, 0x00, 0x40, 0xb3,
-  0x3d, 0xb0, 0x4d, 0xf5, 0xb8, 0x1b, 0x3c, 0xc6, 0xcc, 0x57, 0x17, 0x9f,
-  0x1c, 0x5a, 0xc8, 0xbd, 0xfb, 0xf1, 0x5a, 0x2c, 0xfe, 0xd5, 0xef, 0xc7,
-  0x5b, 0x9b, 0xb7, 0x32, 0xa4, 0x82, 0xe1, 0xda, 0x3b, 0x9b, 0xf1, 0x5b,
-  0x3f, 0xfd, 0xa3, 0xf8, 0xdd, 0x9f, 0x7f, 0x7f, 0xd7, 0xe7, 0x5a, 0x53,
-  0xc7, 0xe2, 0xeb, 0x5f, 0xfa, 0xac, 0xa9, 0xd7, 0xd4, 0xc1, 0x9d, 0xdc,
-  0x01, 0x00, 0x26, 0x9d, 0xbb, 0x36, 0x80, 0x66, 0x9b, 0x2b, 0x3f, 0x98,
-  0x9f, 0x6d, 0xe5, 0xca, 0x01, 0x23, 0xf3, 0xb0, 0x42, 0x6e, 0x7d, 0xa7,
-  0x13, 0xbf, 0xb9, 0xf6, 0x87, 0xf1, 0x8f, 0x7f, 0xfe, 0x7d, 0xab, 0xe4,
-  0xc8, 0xee, 0xbb, 0x1b, 0xef, 0xc5, 0xe2, 0x5f, 0xfd, 0x7e, 0x7c, 0x6f,
-  0xe3, 0xfd, 0x5d, 0x9f, 0x9b, 0x9f, 0x6d, 0xc5, 0xd7, 0xbf, 0xf4, 0x59,
-  0xaf, 0xd1, 0x64, 0xd1, 0xd9, 0xda, 0xc9, 0x1d, 0x01, 0x80, 0x01, 0xca,
-  0x38, 0x00, 0xa0, 0xf6, 0xbe, 0xba, 0xf8, 0x64, 0x7c, 0xf5, 0xdc, 0xfc,
-  0xd0, 0xcf, 0xfd, 0xf3, 0x5f, 0xfc, 0x28, 0xce, 0x7f, 0xf8, 0x2f, 0xe2,
-  0xbb, 0x1b, 0xef, 0x55, 0x9c, 0x0a, 0x22, 0x6e, 0x6d, 0xb7, 0xe3, 0xb7,
-  0x7e, 0xfa, 0x47, 0x43, 0xb7, 0xa5, 0x46, 0x74, 0xcf, 0x3f, 0xfc, 0xfa,
-  0xaf, 0x2a, 0xe2, 0xc8, 0x67, 0x6d, 0x7d, 0xd7, 0x7f, 0x97, 0xb6, 0xa9,
-  0x02, 0x64, 0x36, 0x95, 0x3b, 0x00, 0x00, 0xc0, 0x5e, 0x3c, 0x7f, 0x7a,
-  0x36, 0xe6, 0xe7, 0x5a, 0xf1, 0x9d, 0x1f, 0xfd, 0x75, 0xac, 0x6f, 0x6c,
-  0x3f, 0xf0, 0xb9, 0xd5, 0xed, 0x76, 0xfc, 0x83, 0x9f, 0xfe, 0xcb, 0x78,
-  0xa1, 0x75, 0x26, 0xfe, 0xc9, 0xa7, 0xfe, 0x5e, 0x7c, 0xfe, 0x13, 0x0e,
-  0xc8, 0x67, 0xb4, 0xda, 0x3b, 0x9b, 0xf1, 0x07, 0xbf, 0xf8, 0x51, 0xfc,
-  0xc1, 0x2f, 0x7e, 0x34, 0xb4, 0x84, 0x8b, 0x88, 0xf8, 0xd2, 0x73, 0x9f,
-  0x8e, 0x17, 0x86, 0x0c, 0x22, 0x81, 0xcc, 0x6c, 0x53, 0x05, 0xc8, 0xcc,
-  0xca, 0x38, 0x80, 0x86, 0x4a, 0x29, 0x2d, 0x0e, 0x5e, 0x9b, 0x9d, 0xf1,
-  0x1e, 0x0b, 0xe3, 0x6d, 0x7e, 0xb6, 0x15, 0x17, 0xff, 0xdb, 0x33, 0xf1,
-  0xcc, 0x53, 0x4f, 0x0c, 0xfd, 0xfc, 0x5b, 0x9d, 0x5b, 0xb1, 0xf4, 0xe1,
-  0xbf, 0x88, 0xdf, 0xbe, 0xfd, 0xc7, 0x71, 0x6b, 0xbb, 0x5d, 0x71, 0x3a,
-  0x26, 0xc5, 0xb7, 0x3f, 0xfa, 0x8b, 0x58, 0xfc, 0xab, 0xdf, 0x8f, 0x7f,
-  0xd6, 0xfe, 0xe1, 0xd0, 0x22, 0x6e, 0x76, 0x66, 0x2a, 0xbe, 0xfe, 0xab,
-  0x9f, 0x55, 0xc4, 0x91, 0x5d, 0xfb, 0xee, 0x56, 0xee, 0x08, 0x00, 0x0c,
-  0x91, 0x8a, 0xa2, 0xc8, 0x9d, 0x01, 0x80, 0x03, 0x48, 0x29, 0x2d, 0x45,
-  0xc4, 0x0f, 0xca, 0xd7, 0xfe, 0xd7, 0xff, 0xee, 0x99, 0x3c, 0x61, 0x20,
-  0x83, 0xf7, 0x3f, 0xfc, 0x28, 0xfe, 0xd5, 0xbf, 0xfb, 0xe9, 0xae, 0x55,
-  0x72, 0x65, 0x5f, 0x7f, 0xe2, 0xf3, 0xf1, 0x8f, 0xe6, 0xfe, 0x6e, 0x9c,
-  0x99, 0x9a, 0x7b, 0xe8, 0xd7, 0xc0, 0x5e, 0xb4, 0x77, 0x36, 0xe3, 0xdb,
-  0x1f, 0xbd, 0x13, 0x7f, 0xf0, 0x8b, 0x1f, 0xc5, 0xea, 0x23, 0x8a, 0xde,
-  0x2f, 0x3e, 0x7d, 0x32, 0x5e, 0x78, 0xee, 0xd3, 0x26, 0xa6, 0x52, 0x0b,
-  0xab, 0xb7, 0x37, 0xe2, 0x8d, 0x3f, 0xfd, 0xf1, 0x03, 0xd7, 0x8a, 0xa2,
-  0x48, 0x99, 0xe2, 0x00, 0xd0, 0x63, 0x09, 0x05, 0x00, 0xd0, 0x48, 0xcf,
-  0x3e, 0xf5, 0x44, 0x9c, 0x39, 0x35, 0x13, 0x7f, 0xf6, 0xc1, 0x9d, 0xf8,
-  0x93, 0xf7, 0x7e, 0x36, 0xf4, 0x6b, 0xde, 0xf8, 0xe8, 0x9d, 0x78, 0xe3,
-  0xa3, 0x77, 0xe2, 0x85, 0xd6, 0x99, 0xf8, 0x47, 0x73, 0x7f, 0x37, 0x5e,
-  0x38, 0x7e, 0xa6, 0xe2, 0x94, 0x34, 0xdd, 0xad, 0xed, 0x76, 0x7c, 0xfb,
-  0xa3, 0xbf, 0x78, 0xe4, 0x76, 0xd4, 0x88, 0xee, 0xd9, 0x70, 0x5f, 0xf9,
-  0xdc, 0x67, 0x9c, 0x0d, 0x07, 0x00, 0x3c, 0x96, 0x32, 0x0e, 0x00, 0x68,
-  0xac, 0xd6, 0xf4, 0xb1, 0x78, 0xe1, 0xb9, 0x4f, 0xc7, 0xf3, 0x7f, 0xfb,
-  0x93, 0xf1, 0x27, 0xef, 0xfd, 0x2c, 0xde, 0xfd, 0xff, 0x7f, 0x31, 0xf4,
-  0xeb, 0xde, 0xea, 0xdc, 0x8a, 0xdf, 0x5c, 0xfb, 0xc3, 0x38, 0x3d, 0x35,
-  0x17, 0xff, 0xf0, 0x93, 0xbf, 0x12, 0xff, 0xe3, 0x13, 0x9f, 0x8f, 0xb9,
-  0x63, 0xc7, 0x2b, 0x4e, 0x4b, 0x93, 0xbc, 0xb5, 0x79, 0x2b, 0xfe, 0xcf,
-  0x8f, 0xfe, 0x22, 0xde, 0xf8, 0xe8, 0x9d, 0x47, 0x7e, 0xdd, 0xec, 0xcc,
-  0x54, 0xf7, 0xbf, 0xc1, 0xd3, 0xb3, 0x15, 0x25, 0x83, 0xbd, 0x1b, 0xb2,
-  0x4d, 0xd5, 0xfe, 0x7d, 0x80, 0x1a, 0x50, 0xc6, 0x01, 0x34, 0xd7, 0x52,
-  0xf9, 0x81, 0xf3, 0xe2, 0x98, 0x64, 0x73, 0x27, 0xa6, 0xe3, 0xab, 0x8b,
-  0x4f, 0xc6, 0xf3, 0xa7, 0x67, 0xe3, 0xad, 0xf7, 0x7e, 0x16, 0xab, 0xb7,
-  0x37, 0x86, 0x7e, 0xdd, 0xea, 0x76, 0x3b, 0x7e, 0xf7, 0xe7, 0xdf, 0x8f,
-  0xdf, 0xfd, 0xf9, 0xf7, 0xe3, 0xeb, 0x4f, 0x7c, 0x3e, 0x7e, 0xe3, 0xc4,
-  0x73, 0xf1, 0xeb, 0x33, 0xcf, 0x55, 0x9c, 0x96, 0xba, 0xea, 0xaf, 0x82,
-  0xfb, 0xf6, 0x47, 0xef, 0x3c, 0x72, 0x2b, 0x6a, 0x84, 0x12, 0x8e, 0x66,
-  0x68, 0xef, 0xde, 0xc6, 0x6f, 0x92, 0x2a, 0x40, 0x0d, 0xb8, 0x73, 0x03,
-  0x18, 0x13, 0x73, 0x27, 0xa6, 0x73, 0x47, 0x80, 0xec, 0x4e, 0x9f, 0x9a,
-  0x89, 0xaf, 0xff, 0xea, 0x67, 0x63, 0x6d, 0xbd, 0x13, 0x7f, 0xfe, 0x1f,
-  0xef, 0x3c, 0x74, 0xa5, 0x5c, 0xc4, 0xfd, 0x2d, 0xac, 0xb3, 0xc7, 0x5a,
-  0xf1, 0xeb, 0x33, 0xcf, 0xc5, 0x3f, 0xfc, 0xe4, 0xaf, 0x98, 0xc2, 0x3a,
-  0x81, 0x6e, 0x6d, 0xb7, 0xe3, 0xbb, 0x1b, 0xef, 0xc5, 0xb7, 0x3f, 0xfa,
-  0x8b, 0x78, 0xf7, 0xe3, 0xb5, 0xc7, 0x7e, 0xbd, 0x12, 0x0e, 0x00, 0x38,
-  0x2c, 0x65, 0x1c, 0x00, 0x30, 0x76, 0xe6, 0x67, 0x5b, 0xf1, 0xd5, 0xc5,
-  0x27, 0xe3, 0x4b, 0xcf, 0x7d, 0x3a, 0xfe, 0xfc, 0x83, 0x76, 0xbc, 0xbb,
-  0xba, 0x1e, 0x9d, 0xed, 0x9d, 0xa1, 0x5f, 0xbb, 0xbe, 0xd3, 0xd9, 0x55,
-  0xcc, 0x59, 0x31, 0x37, 0xde, 0xf6, 0x5b, 0xc0, 0x45, 0x74, 0x8b, 0xde,
-  0x2f, 0x3e, 0x7d, 0x32, 0x9e, 0x7d, 0xc8, 0x24, 0x5f, 0xa8, 0xa3, 0xb5,
-  0xf5, 0x5d, 0xe7, 0x1c, 0xde, 0xc9, 0x91, 0x03, 0x80, 0x07, 0x29, 0xe3,
-  0x00, 0x80, 0xb1, 0x35, 0x77, 0x62, 0x3a, 0xbe, 0xf2, 0xb9, 0xcf, 0xc4,
-  0x0b, 0xcf, 0x7d, 0x3a, 0xde, 0xff, 0xf0, 0x6f, 0xe2, 0xcf, 0x3f, 0x68,
-  0x0f, 0xbb, 0x39, 0xbd, 0xa7, 0x5c, 0xcc, 0x45, 0x44, 0x7c, 0x75, 0xe6,
-  0xd9, 0xf8, 0x8d, 0x13, 0xcf, 0xc5, 0x0b, 0xad, 0xb3, 0x26, 0xb2, 0x36,
-  0xdc, 0x77, 0x37, 0xde, 0x8b, 0x1f, 0x6e, 0xde, 0x8a, 0xef, 0x6e, 0xbc,
-  0xf7, 0xd8, 0x2d, 0xa8, 0x7d, 0xad, 0xa9, 0x63, 0xf1, 0xfc, 0xe9, 0xd9,
-  0xf8, 0xe2, 0xd3, 0x73, 0x56, 0x1f, 0xd3, 0x48, 0x9d, 0xad, 0x5d, 0x6f,
-  0x42, 0xd8, 0xa6, 0x0a, 0x50, 0x03, 0xca, 0x38, 0x80, 0xe6, 0x5a, 0x2a,
-  0x3f, 0x30, 0xc1, 0x0f, 0x1e, 0xae, 0x35, 0xdd, 0x2d, 0x55, 0x9e, 0x3f,
-  0x3d, 0x1b, 0x6b, 0xeb, 0x9d, 0x78, 0x77, 0xf5, 0x17, 0x8f, 0x5c, 0x2d,
-  0xd7, 0xf7, 0xbd, 0x8d, 0xf7, 0xe3, 0x7b, 0x1b, 0xef, 0x47, 0x44, 0xc4,
-  0xe9, 0xa9, 0xb9, 0x78, 0xa1, 0x75, 0x26, 0x7e, 0xed, 0xf8, 0x19, 0xe5,
-  0x5c, 0x03, 0xbc, 0xb5, 0x79, 0x2b, 0x7e, 0xd8, 0xb9, 0x19, 0x6f, 0x6d,
-  0xde, 0x8a, 0xb7, 0x3a, 0xb7, 0xf6, 0xf5, 0x6f, 0x9f, 0x79, 0xea, 0x89,
-  0x78, 0xf6, 0xc9, 0x27, 0x6c, 0x45, 0x05, 0x00, 0x46, 0x42, 0x19, 0x07,
-  0x30, 0x26, 0x5a, 0xd3, 0xc7, 0x72, 0x47, 0x80, 0x46, 0x98, 0x9f, 0x6d,
-  0xc5, 0x57, 0x3e, 0xd7, 0x8a, 0xaf, 0x7c, 0xee, 0x33, 0xf1, 0xfe, 0x87,
-  0x1f, 0xc5, 0x5f, 0x7e, 0xf8, 0x37, 0xf1, 0xfe, 0x87, 0x1f, 0x3d, 0xb6,
-  0x98, 0x5b, 0xdd, 0x6e, 0xc7, 0x1b, 0xdb, 0xf7, 0x57, 0xcd, 0x95, 0xcb,
-  0xb9, 0xe7, 0xa7, 0x9f, 0x74, 0xde, 0x5c, 0x46, 0xed, 0x9d, 0xcd, 0x78,
-  0xab, 0x73, 0x2b, 0xde, 0xf9, 0xf8, 0x27, 0x07, 0x2a, 0xdf, 0x22, 0xba,
-  0xff, 0x5d, 0x3c, 0x7f, 0xfa, 0x93, 0xf1, 0xcc, 0x93, 0x4f, 0x58, 0x05,
-  0xc7, 0xd8, 0x18, 0x32, 0xcc, 0x66, 0x25, 0x43, 0x0c, 0x00, 0x06, 0x28,
-  0xe3, 0x00, 0x80, 0x89, 0xf5, 0xec, 0x53, 0x4f, 0xc4, 0xb3, 0x4f, 0x3d,
-  0x11, 0x5f, 0x8d, 0xb8, 0x57, 0xcc, 0xdd, 0xba, 0xbd, 0x11, 0xeb, 0xbb,
-  0x27, 0x10, 0xee, 0x32, 0x58, 0xce, 0x45, 0x44, 0xbc, 0xd0, 0x3a, 0x13,
-  0xcf, 0x7f, 0xe2, 0xc9, 0xf8, 0xfc, 0x27, 0xe6, 0x15, 0x74, 0x23, 0xd2,
-  0xde, 0xd9, 0x8c, 0x77, 0x3f, 0x5e, 0x8b, 0x1f, 0x76, 0x6e, 0xc6, 0x3b,
-  0x1f, 0xff, 0x24, 0xde, 0xdd, 0x5a, 0xdb, 0xf3, 0xb6, 0xd3, 0x41, 0xcf,
-  0x3c, 0xf5, 0x44, 0x9c, 0x39, 0x35, 0xa3, 0x80, 0x63, 0x92, 0xac, 0xe4,
-  0x0e, 0x00, 0x80, 0x32, 0x0e, 0xa0, 0xc9, 0x4e, 0xe6, 0x0e, 0x00, 0xe3,
-  0xa4, 0x5f, 0xcc, 0x45, 0x74, 0x0f, 0x3d, 0xef, 0x96, 0x73, 0x1f, 0x3d,
-  0xf2, 0x8c, 0xb9, 0x41, 0x6f, 0x75, 0x76, 0xaf, 0xca, 0x7a, 0xa1, 0x75,
-  0x26, 0x4e, 0x4f, 0xcd, 0xc5, 0x99, 0xa9, 0xb9, 0xf8, 0xb5, 0xd6, 0xd9,
-  0x7b, 0x7f, 0xe7, 0xf1, 0xde, 0xda, 0xbc, 0x15, 0xb7, 0xfe, 0xf3, 0x9d,
-  0xb8, 0xb5, 0xdd, 0x8e, 0xb7, 0x36, 0x6f, 0xc5, 0x3b, 0x5b, 0x3f, 0x89,
-  0xf5, 0x9d, 0xbd, 0xff, 0xff, 0x31, 0x1c, 0x36, 0x13, 0xc1, 0x00, 0x00,
-  0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x68, 0x76, 0x66, 0xaa, 0x5b, 0xbe,
-  0x3d, 0xf5, 0x4b, 0x71, 0xe6, 0xd4, 0x8c, 0x15, 0xc5, 0x00, 0x40, 0x16,
-  0xa9, 0x28, 0x8a, 0xdc, 0x19, 0x00, 0x38, 0x80, 0x94, 0xd2, 0x03, 0x2f,
-  0xe0, 0x17, 0x7e, 0xf9, 0x6f, 0x99, 0xf2, 0x07, 0x23, 0xd0, 0xd9, 0xda,
-  0x89, 0x5b, 0xb7, 0x37, 0x62, 0xb5, 0xf7, 0xb1, 0x9f, 0x72, 0xee, 0x51,
-  0x9e, 0xff, 0xc4, 0x7c, 0xcc, 0xa5, 0xe3, 0xf1, 0xc2, 0xf1, 0x33, 0x31,
-  0x77, 0xec, 0x78, 0x7c, 0x7e, 0xfa, 0xc9, 0x98, 0x3d, 0xd6, 0x9a, 0xa8,
-  0xd5, 0x74, 0xfd, 0x55, 0x6e, 0xed, 0x62, 0x33, 0xde, 0xf9, 0xf8, 0x27,
-  0x71, 0x6b, 0xbb, 0x1d, 0xab, 0xdb, 0xed, 0x43, 0x97, 0x6e, 0x7d, 0xad,
-  0xa9, 0x63, 0x71, 0xfa, 0x33, 0x33, 0x71, 0xe6, 0xd4, 0x4c, 0x9c, 0x3e,
-  0x35, 0xe3, 0x6c, 0x4d, 0x26, 0xca, 0xea, 0xed, 0x8d, 0x78, 0xe3, 0x4f,
-  0x7f, 0x3c, 0x78, 0xf9, 0x53, 0x45, 0x51, 0x98, 0xa8, 0x0a, 0x90, 0x99,
-  0x95, 0x71, 0x00, 0x63, 0xe2, 0xb8, 0x15, 0x1e, 0x30, 0x12, 0xad, 0xe9,
-  0x63, 0x0f, 0xac, 0x9a, 0x2b, 0x97, 0x73, 0x6b, 0xeb, 0x9d, 0x61, 0x67,
-  0x32, 0xed, 0xc9, 0xbb, 0x1f, 0xaf, 0x45, 0x44, 0x0c, 0x3d, 0xdf, 0x6c,
-  0xf6, 0x58, 0x2b, 0x3e, 0x3f, 0xdd, 0x2d, 0xe5, 0x9e, 0xff, 0xc4, 0x93,
-  0x31, 0x77, 0xac, 0x75, 0xaf, 0xb0, 0xbb, 0xf7, 0xf9, 0x1a, 0x97, 0x76,
-  0xfd, 0x92, 0x2d, 0x22, 0xee, 0x15, 0x6d, 0x11, 0x11, 0xef, 0x7c, 0xdc,
-  0x2d, 0xd9, 0x6e, 0xfd, 0xe7, 0xf6, 0x81, 0xb7, 0x96, 0x3e, 0xca, 0xec,
-  0xcc, 0x54, 0xcc, 0xcf, 0xb5, 0x94, 0x6f, 0xf0, 0x10, 0x8a, 0x38, 0x80,
-  0x7a, 0x50, 0xc6, 0x01, 0x00, 0xec, 0xc3, 0x60, 0x39, 0x17, 0x11, 0xf7,
-  0x8a, 0xb9, 0xb5, 0x76, 0x27, 0xd6, 0xd6, 0x3f, 0x3e, 0xf4, 0xea, 0xb9,
-  0xf5, 0x9d, 0xce, 0xbd, 0x92, 0x6e, 0x2f, 0xc3, 0x08, 0xfa, 0xab, 0xec,
-  0xfa, 0x1e, 0x57, 0xd6, 0x95, 0x8b, 0xbd, 0x61, 0xca, 0x05, 0xda, 0xd0,
-  0xcf, 0xef, 0x74, 0xe2, 0xdd, 0x81, 0xcf, 0x1f, 0xd5, 0x6a, 0xb6, 0xbd,
-  0x6a, 0x4d, 0x1d, 0x8b, 0xf9, 0xb9, 0xd6, 0xbd, 0xd2, 0xcd, 0xb6, 0x53,
-  0x78, 0xd0, 0xe6, 0xd6, 0xa3, 0x87, 0xd2, 0x00, 0x90, 0x8f, 0x32, 0x0e,
-  0xa0, 0x81, 0x52, 0x4a, 0xce, 0x8b, 0x83, 0x1a, 0x39, 0xdd, 0x5b, 0x89,
-  0x55, 0xb6, 0x7a, 0x7b, 0x23, 0xda, 0x77, 0xb7, 0xa2, 0xbd, 0xb1, 0x7d,
-  0xef, 0xef, 0x7b, 0x19, 0x0c, 0x71, 0x10, 0xfd, 0x55, 0x68, 0x65, 0xdf,
-  0xdb, 0x78, 0x7f, 0x24, 0xdf, 0x2b, 0x87, 0xd3, 0xa7, 0x66, 0x62, 0x6e,
-  0x66, 0x2a, 0x66, 0x4f, 0x4c, 0xc7, 0x99, 0x5e, 0xf9, 0xa6, 0x78, 0x83,
-  0x47, 0x1b, 0xf2, 0xa6, 0xc0, 0x8d, 0x1c, 0x39, 0x00, 0xd8, 0x4d, 0x19,
-  0x07, 0xd0, 0x4c, 0x8b, 0x83, 0x17, 0x6c, 0xc7, 0x82, 0x7a, 0x19, 0x56,
-  0xd0, 0x45, 0x3c, 0x58, 0xd2, 0xad, 0xad, 0x77, 0xa2, 0xb3, 0xb5, 0x13,
-  0x6b, 0xed, 0x4e, 0x74, 0xb6, 0x27, 0x7b, 0x15, 0x4b, 0xbf, 0x60, 0x3b,
-  0x7d, 0x6a, 0x26, 0x8e, 0x4f, 0x1f, 0x8b, 0xf9, 0xd9, 0x56, 0xcc, 0xce,
-  0x4c, 0x99, 0x72, 0x0a, 0x47, 0xc7, 0x16, 0x55, 0x80, 0x9a, 0x50, 0xc6,
-  0x01, 0x8c, 0x09, 0xab, 0x44, 0xa0, 0x19, 0x1e, 0x56, 0xd2, 0x45, 0xc4,
-  0xfd, 0x72, 0x6e, 0xbd, 0x13, 0x9b, 0x5b, 0x3b, 0xf7, 0xfe, 0x1e, 0x11,
-  0x8d, 0x2e, 0xec, 0xfa, 0xff, 0x7b, 0x5b, 0xbd, 0x92, 0x2d, 0x22, 0xe2,
-  0x4c, 0xef, 0x9a, 0x55, 0x6e, 0x30, 0x1a, 0x1d, 0xdb, 0x54, 0x01, 0x6a,
-  0x4b, 0x19, 0x07, 0x00, 0x50, 0x13, 0xfd, 0xa2, 0xea, 0x61, 0x65, 0x5d,
-  0x5f, 0xbf, 0xb4, 0x8b, 0xe8, 0x9e, 0x0b, 0x35, 0xb8, 0x1d, 0xad, 0xfc,
-  0xf9, 0x61, 0x1e, 0xb7, 0x65, 0xb6, 0x7f, 0x1e, 0xdb, 0xa3, 0x0c, 0x66,
-  0x9c, 0x1b, 0x58, 0xc5, 0xa6, 0x64, 0x83, 0xbc, 0x86, 0x6c, 0x53, 0x5d,
-  0xce, 0x10, 0x03, 0x80, 0x21, 0x94, 0x71, 0x00, 0x00, 0x0d, 0x33, 0xb8,
-  0x2d, 0xbd, 0x3c, 0x4c, 0x02, 0x00, 0x80, 0x7a, 0xf3, 0x76, 0x25, 0x40,
-  0x33, 0x2d, 0x95, 0x1f, 0x38, 0x2f, 0x0e, 0x00, 0x28, 0x6b, 0xdf, 0xdd,
-  0xca, 0x1d, 0x01, 0x80, 0x87, 0x50, 0xc6, 0x01, 0x8c, 0x01, 0x5b, 0xc1,
-  0x00, 0x80, 0xb2, 0x21, 0x5b, 0xd1, 0x97, 0x33, 0xc4, 0x00, 0x60, 0x08,
-  0x77, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x50, 0x11, 0x65, 0x1c, 0x00, 0x00,
-  0xc0, 0x18, 0x79, 0xc8, 0x16, 0xd5, 0x3b, 0x55, 0xe7, 0x00, 0x60, 0x38,
-  0x65, 0x1c, 0x40, 0x33, 0x2d, 0x95, 0x1f, 0x38, 0x33, 0x0e, 0x00, 0xe8,
-  0x1b, 0x36, 0x2d, 0xb9, 0x28, 0x8a, 0xeb, 0x19, 0xa2, 0x00, 0x30, 0x84,
-  0x32, 0x0e, 0x60, 0x0c, 0x38, 0x33, 0x0e, 0x00, 0x00, 0xa0, 0x19, 0xdc,
-  0xbd, 0x01, 0x00, 0x00, 0x8c, 0x91, 0x21, 0xdb, 0x54, 0xdb, 0x39, 0x72,
-  0x00, 0x30, 0x9c, 0x32, 0x0e, 0x00, 0x00, 0x60, 0x8c, 0xb4, 0x77, 0x6f,
-  0x53, 0xb5, 0x45, 0x15, 0xa0, 0x46, 0x94, 0x71, 0x00, 0xcd, 0x74, 0xbe,
-  0xfc, 0x60, 0x6e, 0x66, 0x2a, 0x57, 0x0e, 0x00, 0x00, 0x00, 0xf6, 0x41,
-  0x19, 0x07, 0x30, 0x06, 0xe6, 0x4e, 0x4c, 0xe7, 0x8e, 0x00, 0x00, 0xd4,
-  0xc4, 0xda, 0x7a, 0x67, 0xf0, 0x92, 0x49, 0xaa, 0x00, 0x35, 0xa2, 0x8c,
-  0x03, 0x00, 0x00, 0x18, 0x23, 0x9d, 0xad, 0x9d, 0xc1, 0x4b, 0xb6, 0xa9,
-  0x02, 0xd4, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c,
-  0x03, 0x68, 0x98, 0x94, 0xd2, 0xe2, 0xe0, 0xb5, 0xd6, 0xb4, 0x97, 0x73,
-  0x00, 0xa0, 0x6b, 0xad, 0x6d, 0x9b, 0x2a, 0x40, 0x9d, 0xb9, 0x7b, 0x03,
-  0x68, 0x9e, 0x93, 0x83, 0x17, 0xe6, 0x67, 0x5b, 0x39, 0x72, 0x00, 0x00,
-  0x35, 0xd4, 0xd9, 0xb6, 0x4d, 0x15, 0xa0, 0xce, 0x94, 0x71, 0x00, 0x00,
-  0x00, 0x00, 0x50, 0x11, 0x65, 0x1c, 0x00, 0x00, 0xc0, 0x98, 0x18, 0x32,
-  0x49, 0x35, 0x22, 0x62, 0xa5, 0xe2, 0x18, 0x00, 0x3c, 0x82, 0x32, 0x0e,
-  0xa0, 0x79, 0x16, 0xca, 0x0f, 0x5a, 0x53, 0x5e, 0xca, 0x01, 0x80, 0xae,
-  0x21, 0x93, 0x54, 0xa3, 0x28, 0x8a, 0x95, 0xea, 0x93, 0x00, 0xf0, 0x30,
-  0xee, 0xe0, 0x00, 0x9a, 0x67, 0xa1, 0xfc, 0x60, 0x7e, 0xce, 0x79, 0x71,
-  0x00, 0x00, 0x00, 0x4d, 0xa1, 0x8c, 0x03, 0x00, 0x00, 0x18, 0x13, 0x43,
-  0xb6, 0xa9, 0xde, 0xcc, 0x91, 0x03, 0x80, 0x87, 0x53, 0xc6, 0x01, 0x00,
-  0x00, 0x8c, 0x89, 0xcd, 0xdd, 0xdb, 0x54, 0x57, 0x32, 0xc4, 0x00, 0xe0,
-  0x11, 0x94, 0x71, 0x00, 0xcd, 0x73, 0x32, 0x77, 0x00, 0x00, 0x00, 0x00,
-  0x0e, 0x46, 0x19, 0x07, 0xd0, 0x3c, 0x8b, 0xe5, 0x07, 0xa7, 0x4f, 0xcd,
-  0xe4, 0xca, 0x01, 0x00, 0xd4, 0xcc, 0x90, 0x6d, 0xaa, 0x2b, 0x19, 0x62,
-  0x00, 0xf0, 0x08, 0xca, 0x38, 0x00, 0x00, 0x80, 0x31, 0x31, 0x64, 0x9a,
-  0xea, 0x4a, 0x86, 0x18, 0x00, 0x3c, 0x82, 0x32, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x18, 0x13, 0xab, 0xb7, 0x37,
-  0x06, 0x2f, 0xad, 0x64, 0x88, 0x01, 0xc0, 0x23, 0x28, 0xe3, 0x00, 0x9a,
-  0xe7, 0x7c, 0xf9, 0xc1, 0xdc, 0xcc, 0x54, 0xae, 0x1c, 0x00, 0x40, 0xfd,
-  0xad, 0xe4, 0x0e, 0x00, 0xc0, 0x83, 0x94, 0x71, 0x00, 0x0d, 0x37, 0x77,
-  0x62, 0x3a, 0x77, 0x04, 0x00, 0x00, 0x00, 0xf6, 0x48, 0x19, 0x07, 0x00,
-  0x00, 0x30, 0x06, 0x86, 0x6c, 0x51, 0x8d, 0xb0, 0x32, 0x0e, 0xa0, 0x76,
-  0x94, 0x71, 0x00, 0x00, 0x00, 0x63, 0xaa, 0x28, 0x8a, 0x95, 0xdc, 0x19,
-  0x00, 0x78, 0x90, 0x32, 0x0e, 0xa0, 0x41, 0x52, 0x4a, 0x0b, 0x83, 0xd7,
-  0x5a, 0xd3, 0x5e, 0xca, 0x01, 0x00, 0x00, 0x9a, 0xc2, 0x1d, 0x1c, 0x40,
-  0xb3, 0x2c, 0x0c, 0x5e, 0x98, 0x9f, 0x6d, 0x65, 0x88, 0x01, 0x00, 0xd4,
-  0xcd, 0xad, 0xdd, 0xdb, 0x54, 0x6f, 0xe6, 0xc8, 0x01, 0xc0, 0xa3, 0x29,
-  0xe3, 0x00, 0x00, 0x00, 0xc6, 0xd3, 0x4a, 0xee, 0x00, 0x00, 0xec, 0xa6,
-  0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x9a, 0xe5,
-  0x64, 0xee, 0x00, 0x00, 0x40, 0x3d, 0xad, 0xad, 0x77, 0x06, 0x2f, 0xad,
-  0x64, 0x88, 0x01, 0xc0, 0x63, 0x28, 0xe3, 0x00, 0x9a, 0x65, 0xb1, 0xfc,
-  0xc0, 0x79, 0x71, 0x00, 0x40, 0x5f, 0x67, 0x6b, 0x67, 0xf0, 0xd2, 0x4a,
-  0x86, 0x18, 0x00, 0x3c, 0x86, 0x32, 0x0e, 0xa0, 0xc1, 0x4c, 0x52, 0x05,
-  0x00, 0x00, 0x68, 0x16, 0x77, 0x71, 0x00, 0x00, 0x00, 0x63, 0x60, 0xad,
-  0x6d, 0x9b, 0x2a, 0x40, 0x13, 0x28, 0xe3, 0x00, 0x00, 0x00, 0xc6, 0x40,
-  0x67, 0xdb, 0x36, 0x55, 0x80, 0x26, 0x50, 0xc6, 0x01, 0x34, 0xcb, 0x03,
-  0x67, 0xc6, 0xd9, 0xa6, 0x0a, 0x00, 0x00, 0xd0, 0x2c, 0xee, 0xe2, 0x00,
-  0x9a, 0xe5, 0x81, 0x69, 0xaa, 0x06, 0x38, 0x00, 0x00, 0x11, 0x43, 0x27,
-  0xa9, 0x46, 0x58, 0x19, 0x07, 0x50, 0x4b, 0xca, 0x38, 0x00, 0x00, 0x80,
-  0x86, 0x1b, 0x32, 0x49, 0x35, 0x8a, 0xa2, 0x58, 0xa9, 0x3e, 0x09, 0x00,
-  0x8f, 0xa3, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00,
-  0x9a, 0xe5, 0xe4, 0xe3, 0xbf, 0x04, 0x00, 0x98, 0x34, 0x43, 0xb6, 0xa9,
-  0xb6, 0x73, 0xe4, 0x00, 0xe0, 0xf1, 0x94, 0x71, 0x00, 0xcd, 0x72, 0xae,
-  0xfc, 0xc0, 0x99, 0x71, 0x00, 0x40, 0x44, 0xc4, 0xe6, 0xee, 0x6d, 0xaa,
-  0xd7, 0x73, 0xe4, 0x00, 0xe0, 0xf1, 0x94, 0x71, 0x00, 0x0d, 0x76, 0xdc,
-  0x34, 0x55, 0x00, 0x00, 0x80, 0x46, 0x71, 0x17, 0x07, 0x00, 0x00, 0xd0,
-  0x70, 0x43, 0xb6, 0xa9, 0xde, 0xc9, 0x91, 0x03, 0x80, 0xc7, 0x53, 0xc6,
-  0x01, 0x00, 0x00, 0x34, 0xdc, 0x90, 0x69, 0xaa, 0xb6, 0xa9, 0x02, 0xd4,
-  0x94, 0x32, 0x0e, 0xa0, 0x21, 0x52, 0x4a, 0x0b, 0x83, 0xd7, 0x5a, 0xb6,
-  0xa9, 0x02, 0x00, 0x00, 0x34, 0x8a, 0xbb, 0x38, 0x80, 0xe6, 0x58, 0x18,
-  0xbc, 0x60, 0x80, 0x03, 0x00, 0x10, 0x11, 0xd1, 0xbe, 0xbb, 0x35, 0x78,
-  0xc9, 0x36, 0x55, 0x80, 0x9a, 0x52, 0xc6, 0x01, 0x00, 0x00, 0x34, 0xdc,
-  0xfa, 0xc6, 0xf6, 0xe0, 0x25, 0xdb, 0x54, 0x01, 0x6a, 0x4a, 0x19, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x51, 0xc6, 0x01, 0x00, 0x00, 0x34, 0xd8,
-  0x90, 0x2d, 0xaa, 0x00, 0xd4, 0x98, 0x32, 0x0e, 0xa0, 0x39, 0x96, 0xca,
-  0x0f, 0x66, 0x67, 0xa6, 0x32, 0xc5, 0x00, 0x00, 0xea, 0x64, 0xc8, 0x16,
-  0xd5, 0x28, 0x8a, 0x62, 0xb9, 0xfa, 0x24, 0x00, 0xec, 0x85, 0x32, 0x0e,
-  0xa0, 0xa1, 0xe6, 0x4e, 0x4c, 0xe7, 0x8e, 0x00, 0x00, 0x00, 0xc0, 0x3e,
-  0x29, 0xe3, 0x00, 0x00, 0x00, 0x1a, 0x6c, 0x73, 0x6b, 0x27, 0x77, 0x04,
-  0x00, 0xf6, 0x41, 0x19, 0x07, 0x00, 0x00, 0xd0, 0x60, 0x6b, 0xeb, 0x9d,
-  0xc1, 0x4b, 0xd7, 0x72, 0xe4, 0x00, 0x60, 0x6f, 0x94, 0x71, 0x00, 0xcd,
-  0x71, 0x32, 0x77, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x47, 0x19, 0x07, 0xd0,
-  0x1c, 0x8b, 0xe5, 0x07, 0xf3, 0xb3, 0xad, 0x5c, 0x39, 0x00, 0x80, 0x1a,
-  0xe9, 0xd8, 0xa6, 0x0a, 0xd0, 0x28, 0xca, 0x38, 0x80, 0x86, 0x6a, 0x4d,
-  0x7b, 0x09, 0x07, 0x00, 0x86, 0x6e, 0x53, 0xbd, 0x9e, 0x23, 0x07, 0x00,
-  0x7b, 0xe3, 0x4e, 0x0e, 0x00, 0x00, 0x60, 0xbc, 0xdc, 0xc9, 0x1d, 0x00,
-  0x80, 0x87, 0x53, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x45, 0x94, 0x71,
-  0x00, 0xcd, 0xb1, 0x90, 0x3b, 0x00, 0x00, 0x50, 0x3f, 0xab, 0xb7, 0x37,
-  0x06, 0x2f, 0xd9, 0xa6, 0x0a, 0x50, 0x63, 0xca, 0x38, 0x80, 0xe6, 0x38,
-  0x5b, 0x7e, 0x70, 0xe6, 0xd4, 0x4c, 0xae, 0x1c, 0x00, 0x40, 0xbd, 0xd9,
-  0xa6, 0x0a, 0x50, 0x63, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88,
-  0x32, 0x0e, 0x00, 0x00, 0xa0, 0xa1, 0x86, 0x6c, 0x51, 0x8d, 0x88, 0x58,
-  0xa9, 0x38, 0x06, 0x00, 0xfb, 0xa0, 0x8c, 0x03, 0x00, 0x00, 0x18, 0x23,
-  0x45, 0x51, 0xac, 0xe4, 0xce, 0x00, 0xc0, 0xc3, 0x29, 0xe3, 0x00, 0x1a,
-  0x20, 0xa5, 0xb4, 0x30, 0x78, 0xad, 0x35, 0xed, 0x25, 0x1c, 0x00, 0x00,
-  0xa0, 0x69, 0xdc, 0xc9, 0x01, 0x34, 0xc3, 0xc2, 0xe0, 0x85, 0xf9, 0xd9,
-  0x56, 0x86, 0x18, 0x00, 0x40, 0x9d, 0xac, 0xad, 0x77, 0x06, 0x2f, 0xdd,
-  0xcc, 0x91, 0x03, 0x80, 0xbd, 0x53, 0xc6, 0x01, 0x00, 0x00, 0x34, 0xd4,
-  0xe6, 0xd6, 0xce, 0xe0, 0xa5, 0x95, 0x0c, 0x31, 0x00, 0xd8, 0x07, 0x65,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x54, 0x44, 0x19, 0x07, 0x00, 0x00, 0xd0,
-  0x50, 0x43, 0xb6, 0xa9, 0xde, 0xc9, 0x91, 0x03, 0x80, 0xbd, 0x53, 0xc6,
-  0x01, 0x34, 0xc3, 0x62, 0xf9, 0x41, 0x6b, 0xca, 0xcb, 0x37, 0x00, 0x10,
-  0xd1, 0xd9, 0xbd, 0x4d, 0xf5, 0x7a, 0x8e, 0x1c, 0x00, 0xec, 0x9d, 0xbb,
-  0x39, 0x80, 0x66, 0x38, 0x59, 0x7e, 0x30, 0x3f, 0x67, 0x78, 0x03, 0x00,
-  0x00, 0x40, 0x13, 0x29, 0xe3, 0x00, 0x00, 0x00, 0x1a, 0xaa, 0x7d, 0x77,
-  0x2b, 0x77, 0x04, 0x00, 0xf6, 0x49, 0x19, 0x07, 0x00, 0x00, 0xd0, 0x50,
-  0xeb, 0x1b, 0xdb, 0x83, 0x97, 0x96, 0x33, 0xc4, 0x00, 0x60, 0x1f, 0x94,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x50, 0x11, 0x65, 0x1c, 0x40, 0x33, 0x3c,
-  0x38, 0xc0, 0x61, 0xda, 0xcb, 0x37, 0x00, 0x4c, 0xba, 0x21, 0xc3, 0x1b,
-  0x00, 0x68, 0x00, 0x77, 0x73, 0x00, 0xcd, 0xf0, 0xe0, 0x00, 0x87, 0x59,
-  0x03, 0x1c, 0x00, 0x60, 0xd2, 0xad, 0xad, 0x77, 0x86, 0x5d, 0x36, 0x4d,
-  0x15, 0xa0, 0xe6, 0x94, 0x71, 0x00, 0x00, 0x00, 0x63, 0xa2, 0x28, 0x8a,
-  0x3b, 0xb9, 0x33, 0x00, 0xf0, 0x68, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0xa0, 0x81, 0x6e, 0xdd, 0xde, 0x18,
-  0xbc, 0x74, 0x33, 0x47, 0x0e, 0x00, 0xf6, 0x47, 0x19, 0x07, 0xd0, 0x0c,
-  0x0f, 0x0c, 0x70, 0x38, 0x6e, 0x80, 0x03, 0x00, 0xb0, 0xdb, 0x4a, 0xee,
-  0x00, 0x00, 0x3c, 0x9e, 0xbb, 0x39, 0x80, 0x66, 0x98, 0x2b, 0x3f, 0x30,
-  0xc0, 0x01, 0x00, 0x00, 0xa0, 0x99, 0x94, 0x71, 0x00, 0x00, 0x00, 0x0d,
-  0x34, 0x64, 0x9a, 0xea, 0x4a, 0x86, 0x18, 0x00, 0xec, 0x93, 0x32, 0x0e,
-  0x00, 0x00, 0xa0, 0x81, 0x3a, 0x5b, 0x3b, 0x83, 0x97, 0x56, 0x32, 0xc4,
-  0x00, 0x60, 0x9f, 0x94, 0x71, 0x00, 0x00, 0x00, 0x00, 0x50, 0x11, 0x65,
-  0x1c, 0x40, 0xcd, 0xa5, 0x94, 0x16, 0x06, 0xaf, 0xb5, 0x0c, 0x70, 0x00,
-  0x80, 0x89, 0xd7, 0xbe, 0xbb, 0x35, 0x78, 0xe9, 0x4e, 0x8e, 0x1c, 0x00,
-  0xec, 0x8f, 0xbb, 0x39, 0x80, 0xfa, 0x5b, 0x18, 0xbc, 0x60, 0x80, 0x03,
-  0x00, 0xb0, 0xbe, 0xb1, 0x3d, 0x78, 0xe9, 0x7a, 0x8e, 0x1c, 0x00, 0xec,
-  0x8f, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00,
-  0x00, 0x68, 0x98, 0x21, 0xc3, 0x1b, 0x00, 0x68, 0x08, 0x65, 0x1c, 0x00,
-  0x00, 0x40, 0xc3, 0xac, 0xad, 0x77, 0x76, 0x5d, 0x2b, 0x8a, 0x62, 0xb9,
-  0xfa, 0x24, 0x00, 0xec, 0x97, 0x32, 0x0e, 0xa0, 0xfe, 0x4e, 0xe6, 0x0e,
-  0x00, 0x00, 0x00, 0xc0, 0xd1, 0x50, 0xc6, 0x01, 0xd4, 0xdf, 0x62, 0xf9,
-  0xc1, 0xe9, 0x53, 0x33, 0xb9, 0x72, 0x00, 0x00, 0x00, 0x70, 0x48, 0xca,
-  0x38, 0x00, 0x00, 0x80, 0x86, 0xb9, 0x75, 0x7b, 0x63, 0xf0, 0xd2, 0xcd,
-  0x1c, 0x39, 0x00, 0xd8, 0x3f, 0x65, 0x1c, 0x00, 0x00, 0x40, 0xf3, 0xad,
-  0xe4, 0x0e, 0x00, 0xc0, 0xde, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0,
-  0x22, 0xca, 0x38, 0x00, 0x00, 0x80, 0x86, 0x19, 0x32, 0x4d, 0xf5, 0x4e,
-  0x8e, 0x1c, 0x00, 0xec, 0x9f, 0x32, 0x0e, 0xa0, 0xfe, 0x96, 0xca, 0x0f,
-  0xe6, 0x67, 0x5b, 0x99, 0x62, 0x00, 0x00, 0x75, 0xd1, 0xd9, 0xda, 0x19,
-  0xbc, 0x74, 0x3d, 0x47, 0x0e, 0x00, 0xf6, 0x4f, 0x19, 0x07, 0xd0, 0x30,
-  0xad, 0x69, 0x2f, 0xdd, 0x00, 0x00, 0x00, 0x4d, 0xe5, 0x8e, 0x0e, 0x00,
-  0x00, 0xa0, 0x61, 0xda, 0x77, 0xb7, 0x72, 0x47, 0x00, 0xe0, 0x80, 0x94,
-  0x71, 0x00, 0x00, 0x00, 0x0d, 0xb3, 0xbe, 0xb1, 0x3d, 0x78, 0x69, 0x39,
-  0x43, 0x0c, 0x00, 0x0e, 0x40, 0x19, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15,
-  0x51, 0xc6, 0x01, 0xd4, 0xdf, 0x42, 0xf9, 0xc1, 0x71, 0x67, 0xc6, 0x01,
-  0x00, 0x00, 0x34, 0x96, 0x3b, 0x3a, 0x80, 0xfa, 0x3b, 0x5b, 0x7e, 0x60,
-  0x9a, 0x2a, 0x00, 0x4c, 0xb6, 0xd5, 0xdb, 0x1b, 0xc3, 0x2e, 0x9b, 0xa6,
-  0x0a, 0xd0, 0x10, 0xca, 0x38, 0x00, 0x00, 0x80, 0x86, 0x2b, 0x8a, 0xe2,
-  0x4e, 0xee, 0x0c, 0x00, 0xec, 0x8d, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x68, 0x90, 0xb5, 0xf5, 0xce, 0xe0,
-  0xa5, 0x76, 0x8e, 0x1c, 0x00, 0x1c, 0x8c, 0x32, 0x0e, 0x00, 0x00, 0xa0,
-  0x41, 0x36, 0xb7, 0x76, 0x06, 0x2f, 0x39, 0x2f, 0x0e, 0xa0, 0x41, 0x94,
-  0x71, 0x00, 0x35, 0x96, 0x52, 0x5a, 0x1a, 0xbc, 0x66, 0x80, 0x03, 0x00,
-  0x00, 0x40, 0x73, 0x29, 0xe3, 0x00, 0x1a, 0xa6, 0x35, 0xed, 0xa5, 0x1b,
-  0x00, 0x26, 0x59, 0x67, 0xf7, 0xca, 0x38, 0x00, 0x1a, 0xc4, 0x1d, 0x1d,
-  0x00, 0x00, 0x40, 0x83, 0x0c, 0x39, 0x33, 0x6e, 0x39, 0x43, 0x0c, 0x00,
-  0x0e, 0x48, 0x19, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0x51, 0xc6, 0x01,
-  0x00, 0x00, 0x00, 0x40, 0x45, 0x94, 0x71, 0x00, 0xf5, 0xb6, 0x50, 0x7e,
-  0xd0, 0x9a, 0xf2, 0xb2, 0x0d, 0x00, 0x93, 0x6e, 0xf5, 0xf6, 0xc6, 0xe0,
-  0xa5, 0x95, 0x0c, 0x31, 0x00, 0x38, 0x20, 0x77, 0x75, 0x00, 0xf5, 0xb6,
-  0x50, 0x7e, 0x30, 0x3f, 0x67, 0x92, 0x2a, 0x00, 0xb0, 0xcb, 0x4a, 0xee,
-  0x00, 0x00, 0xec, 0x9d, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2,
-  0x8c, 0x03, 0x00, 0x00, 0x68, 0x88, 0xf6, 0xdd, 0xad, 0x61, 0x97, 0xef,
-  0x54, 0x9d, 0x03, 0x80, 0x83, 0x53, 0xc6, 0x01, 0x00, 0x00, 0x34, 0xc4,
-  0xfa, 0xc6, 0xf6, 0xae, 0x6b, 0x45, 0x51, 0x5c, 0xcf, 0x10, 0x05, 0x80,
-  0x03, 0x52, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x45, 0x94, 0x71, 0x00,
-  0xf5, 0xb6, 0x58, 0x7e, 0x30, 0x37, 0x33, 0x95, 0x2b, 0x07, 0x00, 0x50,
-  0x03, 0x9b, 0x5b, 0x3b, 0xb9, 0x23, 0x00, 0x70, 0x48, 0xca, 0x38, 0x80,
-  0x7a, 0x3b, 0x59, 0x7e, 0x30, 0x7b, 0x62, 0x3a, 0x57, 0x0e, 0x00, 0xa0,
-  0x06, 0xd6, 0xd6, 0x3b, 0x83, 0x97, 0x6e, 0xe4, 0xc8, 0x01, 0xc0, 0xc1,
-  0x29, 0xe3, 0x00, 0x00, 0x00, 0x9a, 0xcb, 0xf0, 0x06, 0x80, 0x86, 0x51,
-  0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x45, 0x94, 0x71, 0x00, 0x00, 0x00,
-  0x0d, 0x31, 0x64, 0x9b, 0xaa, 0x95, 0x71, 0x00, 0x0d, 0xa3, 0x8c, 0x03,
-  0x00, 0x00, 0x68, 0x88, 0xce, 0xee, 0x01, 0x0e, 0xd7, 0x73, 0xe4, 0x00,
-  0xe0, 0xe0, 0x94, 0x71, 0x00, 0xf5, 0x76, 0xbe, 0xfc, 0xc0, 0x34, 0x55,
-  0x00, 0x00, 0x80, 0x66, 0x53, 0xc6, 0x01, 0x34, 0xc8, 0x9c, 0x69, 0xaa,
-  0x00, 0x30, 0xd1, 0x86, 0xac, 0x8c, 0x03, 0xa0, 0x61, 0x94, 0x71, 0x00,
-  0x00, 0x00, 0x0d, 0x31, 0xe4, 0xcc, 0xb8, 0xe5, 0x0c, 0x31, 0x00, 0x38,
-  0x04, 0x65, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x54, 0x44, 0x19, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x15, 0x51, 0xc6, 0x01, 0x00, 0x00, 0x34, 0xc0, 0x90,
-  0x2d, 0xaa, 0x11, 0x11, 0x2b, 0x15, 0xc7, 0x00, 0xe0, 0x90, 0x94, 0x71,
-  0x00, 0x35, 0x95, 0x52, 0x5a, 0x1a, 0xbc, 0x36, 0x3f, 0xdb, 0xca, 0x90,
-  0x04, 0x00, 0xa8, 0x83, 0x61, 0xc3, 0x1b, 0x8a, 0xa2, 0x58, 0xa9, 0x3e,
-  0x09, 0x00, 0x87, 0xa1, 0x8c, 0x03, 0x68, 0x90, 0xd6, 0xb4, 0x97, 0x6d,
-  0x00, 0x00, 0x80, 0x26, 0x73, 0x57, 0x07, 0x00, 0x00, 0xd0, 0x00, 0xed,
-  0xbb, 0x5b, 0xb9, 0x23, 0x00, 0x70, 0x04, 0x94, 0x71, 0x00, 0x00, 0x00,
-  0x0d, 0xd0, 0xde, 0xd8, 0x1e, 0xbc, 0x74, 0x2d, 0x47, 0x0e, 0x00, 0x0e,
-  0x47, 0x19, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0x51, 0xc6, 0x01, 0x00,
-  0x00, 0x00, 0x40, 0x45, 0x94, 0x71, 0x00, 0xf5, 0xb5, 0x58, 0x7e, 0x30,
-  0x3b, 0x33, 0x95, 0x2b, 0x07, 0x00, 0x50, 0x03, 0xab, 0xb7, 0x37, 0x06,
-  0x2f, 0xad, 0x64, 0x88, 0x01, 0xc0, 0x21, 0x29, 0xe3, 0x00, 0xea, 0xeb,
-  0x64, 0xf9, 0xc1, 0xdc, 0x89, 0xe9, 0x5c, 0x39, 0x00, 0x80, 0x7a, 0x5a,
-  0xc9, 0x1d, 0x00, 0x80, 0xfd, 0x53, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x45, 0x94, 0x71, 0x00, 0x00, 0x00, 0x0d, 0xd0, 0xbe, 0xbb, 0x95, 0x3b,
-  0x02, 0x00, 0x47, 0x40, 0x19, 0x07, 0x00, 0x00, 0xd0, 0x00, 0xeb, 0x1b,
-  0xdb, 0x83, 0x97, 0x96, 0x33, 0xc4, 0x00, 0xe0, 0x90, 0x94, 0x71, 0x00,
-  0x00, 0x00, 0x00, 0x50, 0x11, 0x65, 0x1c, 0x40, 0x7d, 0x3d, 0x30, 0x4d,
-  0xb5, 0x35, 0xed, 0x25, 0x1b, 0x00, 0x00, 0xa0, 0xe9, 0xdc, 0xd9, 0x01,
-  0xd4, 0xd7, 0x03, 0xd3, 0x54, 0xe7, 0x67, 0x5b, 0xb9, 0x72, 0x00, 0x00,
-  0x99, 0xad, 0xad, 0x77, 0x86, 0x5d, 0x5e, 0xa9, 0x38, 0x06, 0x00, 0x47,
-  0x40, 0x19, 0x07, 0x00, 0x00, 0x50, 0x73, 0x9d, 0xad, 0x9d, 0x5d, 0xd7,
-  0x8a, 0xa2, 0x58, 0xa9, 0x3e, 0x09, 0x00, 0x87, 0xa5, 0x8c, 0x03, 0x00,
-  0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x6a, 0x6e, 0x73,
-  0xc8, 0xca, 0x38, 0x00, 0x9a, 0x49, 0x19, 0x07, 0x00, 0x00, 0x50, 0x73,
-  0x43, 0xce, 0x8c, 0xbb, 0x96, 0x23, 0x07, 0x00, 0x87, 0xa7, 0x8c, 0x03,
-  0xa8, 0xaf, 0x93, 0x8f, 0xff, 0x12, 0x00, 0x00, 0x00, 0x9a, 0x44, 0x19,
-  0x07, 0x50, 0x5f, 0xe7, 0xca, 0x0f, 0xce, 0x9c, 0x9a, 0xc9, 0x95, 0x03,
-  0x00, 0x00, 0x80, 0x23, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0xa8, 0xb9, 0x21,
-  0xdb, 0x54, 0xef, 0xe4, 0xc8, 0x01, 0xc0, 0xe1, 0x29, 0xe3, 0x00, 0x00,
-  0x00, 0x6a, 0xae, 0xb3, 0x7b, 0x80, 0xc3, 0xf5, 0x1c, 0x39, 0x00, 0x38,
-  0x3c, 0x65, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x54, 0x44, 0x19, 0x07, 0x00,
-  0x00, 0x50, 0x73, 0x43, 0x56, 0xc6, 0x01, 0xd0, 0x50, 0xca, 0x38, 0x00,
-  0x00, 0x80, 0x9a, 0x1b, 0x72, 0x66, 0x9c, 0x6d, 0xaa, 0x00, 0x0d, 0xa5,
-  0x8c, 0x03, 0xa8, 0xa1, 0x94, 0xd2, 0xe2, 0xe0, 0xb5, 0xd9, 0x99, 0xa9,
-  0x1c, 0x51, 0x00, 0x80, 0x7a, 0x32, 0xc0, 0x01, 0xa0, 0xa1, 0x94, 0x71,
-  0x00, 0xf5, 0x74, 0x72, 0xf0, 0xc2, 0xdc, 0x89, 0xe9, 0x1c, 0x39, 0x00,
-  0x00, 0x00, 0x38, 0x42, 0xca, 0x38, 0x00, 0x00, 0x80, 0x1a, 0x6b, 0xdf,
-  0xdd, 0x1a, 0x76, 0xd9, 0xca, 0x38, 0x80, 0x86, 0x52, 0xc6, 0x01, 0x00,
-  0x00, 0xd4, 0xd8, 0xfa, 0xc6, 0xf6, 0xae, 0x6b, 0x45, 0x51, 0x38, 0x33,
-  0x0e, 0xa0, 0xa1, 0x94, 0x71, 0x00, 0x00, 0x00, 0x0d, 0x93, 0x52, 0xba,
-  0x9e, 0x52, 0xba, 0x3c, 0xec, 0x9c, 0x59, 0x00, 0xea, 0x4d, 0x19, 0x07,
-  0x00, 0x00, 0xd0, 0x3c, 0xe7, 0x22, 0xe2, 0x9b, 0x11, 0xf1, 0x76, 0x4a,
-  0xe9, 0x4e, 0x4a, 0xe9, 0x4a, 0x4a, 0xe9, 0x42, 0x4a, 0x69, 0xd7, 0xb9,
-  0xb3, 0x00, 0xd4, 0x8b, 0x32, 0x0e, 0xa0, 0x9e, 0x9e, 0xc9, 0x1d, 0x00,
-  0x00, 0xa8, 0x87, 0x5b, 0xb7, 0x37, 0x1e, 0xf7, 0x25, 0x73, 0x11, 0xf1,
-  0x52, 0x44, 0x7c, 0x27, 0x22, 0x7e, 0x9e, 0x52, 0xba, 0x9a, 0x52, 0xba,
-  0x94, 0x52, 0x5a, 0x18, 0x71, 0x34, 0x00, 0x0e, 0x40, 0x19, 0x07, 0x50,
-  0x13, 0xbd, 0x77, 0xb3, 0xaf, 0xa4, 0x94, 0x56, 0x22, 0xe2, 0x7f, 0x2b,
-  0x7f, 0x6e, 0x7e, 0xb6, 0x95, 0x27, 0x14, 0x00, 0xd0, 0x44, 0x2f, 0x46,
-  0xc4, 0xb7, 0x22, 0xe2, 0x83, 0xde, 0x76, 0xd6, 0x4b, 0xb6, 0xb3, 0x02,
-  0xd4, 0xc7, 0x54, 0xee, 0x00, 0x00, 0x93, 0xaa, 0xb7, 0x8d, 0xe4, 0x42,
-  0x44, 0x2c, 0xf5, 0xfe, 0x9c, 0x7b, 0xd8, 0xd7, 0xb6, 0xa6, 0xbd, 0x77,
-  0x02, 0x00, 0x1c, 0xc8, 0xb9, 0xe8, 0x16, 0x73, 0x91, 0x52, 0xba, 0x19,
-  0x11, 0x57, 0x23, 0xe2, 0x8a, 0x01, 0x10, 0x00, 0xf9, 0x28, 0xe3, 0x00,
-  0x2a, 0x54, 0x2a, 0xe0, 0x2e, 0x44, 0xf7, 0x5d, 0x6b, 0x00, 0x80, 0x47,
-  0xea, 0x6c, 0xed, 0x1c, 0xd5, 0x53, 0x9d, 0x8d, 0x88, 0x6f, 0x44, 0xc4,
-  0x37, 0x4a, 0xc5, 0xdc, 0x72, 0x51, 0x14, 0x57, 0x8f, 0xea, 0x1b, 0x00,
-  0xf0, 0x78, 0xca, 0x38, 0x80, 0x11, 0x53, 0xc0, 0x01, 0x00, 0x87, 0xb1,
-  0xb6, 0xde, 0x19, 0xc5, 0xd3, 0x96, 0x8b, 0xb9, 0x76, 0x74, 0x8b, 0xb9,
-  0xab, 0x8a, 0x39, 0x80, 0xd1, 0x53, 0xc6, 0x01, 0x8c, 0x80, 0x02, 0x0e,
-  0x00, 0x68, 0x90, 0xfe, 0x00, 0x88, 0x97, 0x14, 0x73, 0x00, 0xa3, 0xa7,
-  0x8c, 0x03, 0x38, 0x22, 0x0a, 0x38, 0x00, 0x60, 0x0c, 0x0c, 0x16, 0x73,
-  0x57, 0xc2, 0x19, 0x73, 0x00, 0x47, 0x4a, 0x19, 0x07, 0x70, 0x48, 0x29,
-  0xa5, 0x7e, 0x01, 0xf7, 0xc8, 0x21, 0x0c, 0x00, 0x00, 0x07, 0xd1, 0xbe,
-  0xbb, 0x95, 0xeb, 0x5b, 0xcf, 0xc5, 0xee, 0x33, 0xe6, 0x14, 0x73, 0x00,
-  0x87, 0x64, 0x3c, 0x1f, 0xc0, 0x01, 0xa4, 0x94, 0x16, 0x53, 0x4a, 0x57,
-  0x52, 0x4a, 0x77, 0x22, 0xe2, 0x3b, 0xd1, 0x7d, 0x07, 0x79, 0x64, 0x45,
-  0xdc, 0xfc, 0x6c, 0x6b, 0x54, 0x4f, 0x0d, 0x00, 0xd4, 0xdc, 0xfa, 0xc6,
-  0x76, 0xee, 0x08, 0x11, 0xf7, 0xcf, 0x98, 0x7b, 0x3b, 0xa5, 0x74, 0x3d,
-  0xa5, 0x74, 0x29, 0xa5, 0xb4, 0x90, 0x37, 0x12, 0x40, 0x33, 0x29, 0xe3,
-  0x00, 0xf6, 0x28, 0xa5, 0xb4, 0x90, 0x52, 0xba, 0x9c, 0x52, 0x5a, 0x89,
-  0x88, 0xb7, 0x63, 0xc4, 0x05, 0x5c, 0x59, 0x6b, 0xda, 0xcb, 0x35, 0x00,
-  0x50, 0x1b, 0xe7, 0x22, 0xe2, 0x5b, 0x11, 0xf1, 0x41, 0x4a, 0x69, 0x39,
-  0xa5, 0x74, 0xb1, 0x77, 0x5c, 0x07, 0x00, 0x7b, 0xe0, 0xee, 0x0e, 0xe0,
-  0x11, 0x52, 0x4a, 0x27, 0x7b, 0xbf, 0x60, 0x5e, 0x8f, 0x88, 0x0f, 0x22,
-  0xe2, 0x9b, 0xd1, 0x7d, 0x67, 0x18, 0x00, 0x80, 0x88, 0xf3, 0x11, 0xf1,
-  0x5a, 0x44, 0xfc, 0xbc, 0xb7, 0x6b, 0xe0, 0x42, 0xee, 0x40, 0x00, 0x75,
-  0xa7, 0x8c, 0x03, 0x18, 0x22, 0xa5, 0xb4, 0x94, 0x52, 0xba, 0x12, 0x11,
-  0x3f, 0x8f, 0xee, 0x2f, 0x98, 0xe7, 0xf2, 0x26, 0x02, 0x00, 0x26, 0xd1,
-  0xea, 0xed, 0x8d, 0xdc, 0x11, 0xf6, 0xe3, 0xa5, 0x88, 0xf8, 0x4e, 0x4a,
-  0x69, 0x25, 0xa5, 0xf4, 0x8a, 0x6d, 0xac, 0x00, 0xc3, 0x29, 0xe3, 0x00,
-  0x7a, 0x06, 0xb6, 0xa1, 0xfe, 0x20, 0xba, 0xbf, 0x50, 0x02, 0x00, 0xb0,
-  0x3f, 0xfd, 0xf3, 0xe5, 0x6c, 0x63, 0x05, 0x18, 0x42, 0x19, 0x07, 0x4c,
-  0xbc, 0xde, 0x2f, 0x88, 0x57, 0xc3, 0x36, 0x54, 0x00, 0x80, 0xa3, 0xd6,
-  0xdf, 0xc6, 0xba, 0xd2, 0xdb, 0xc6, 0xba, 0x98, 0x3b, 0x10, 0x40, 0x6e,
-  0xca, 0x38, 0x60, 0x22, 0xf5, 0x56, 0xc1, 0xbd, 0xd2, 0x9b, 0x86, 0xfa,
-  0x5a, 0x44, 0xbc, 0x98, 0x3b, 0x13, 0x00, 0xc0, 0xa0, 0xcd, 0xad, 0x9d,
-  0xdc, 0x11, 0x8e, 0xca, 0x5c, 0x74, 0x77, 0x1d, 0xf4, 0xa7, 0xb1, 0x5a,
-  0x2d, 0x07, 0x4c, 0x2c, 0x65, 0x1c, 0x30, 0x51, 0x52, 0x4a, 0x17, 0x52,
-  0x4a, 0xcb, 0xd1, 0x5d, 0x05, 0xf7, 0x8d, 0xa8, 0x68, 0x1a, 0xea, 0x61,
-  0xcd, 0xcf, 0xb6, 0x72, 0x47, 0x00, 0x00, 0x32, 0x58, 0x5b, 0xef, 0xe4,
-  0x8e, 0x30, 0x0a, 0xe7, 0xc2, 0x6a, 0x39, 0x60, 0x82, 0x29, 0xe3, 0x80,
-  0xb1, 0x37, 0x70, 0x16, 0xdc, 0x77, 0xa2, 0xbb, 0x5d, 0xa2, 0x51, 0x8e,
-  0x4f, 0x7b, 0xb9, 0x06, 0x00, 0xc6, 0x4e, 0x79, 0xb5, 0xdc, 0x72, 0x4a,
-  0xe9, 0x62, 0xe6, 0x3c, 0x00, 0x95, 0x70, 0x77, 0x07, 0x8c, 0xad, 0xd2,
-  0x44, 0x54, 0x67, 0xc1, 0x01, 0x00, 0xd4, 0xdb, 0xf9, 0x88, 0x78, 0x2d,
-  0xa5, 0x74, 0xa7, 0xf7, 0x26, 0xea, 0x42, 0xe6, 0x3c, 0x00, 0x23, 0xa3,
-  0x8c, 0x03, 0xc6, 0x4e, 0xef, 0x0c, 0x92, 0xeb, 0x61, 0x22, 0x2a, 0x00,
-  0xd0, 0x70, 0xeb, 0x77, 0xb7, 0x72, 0x47, 0xa8, 0xda, 0x5c, 0x74, 0xdf,
-  0x44, 0xfd, 0xa0, 0xb7, 0x85, 0x75, 0x29, 0x73, 0x1e, 0x80, 0x23, 0xa7,
-  0x8c, 0x03, 0xc6, 0x42, 0x69, 0x2b, 0x6a, 0x7f, 0x20, 0xc3, 0xb9, 0xdc,
-  0x99, 0x00, 0x00, 0x0e, 0xab, 0xbd, 0xb1, 0x9d, 0x3b, 0x42, 0x4e, 0x2f,
-  0x45, 0xc4, 0x0f, 0xfa, 0x03, 0x1f, 0x72, 0x87, 0x01, 0x38, 0x2a, 0xca,
-  0x38, 0xa0, 0xd1, 0x52, 0x4a, 0x8b, 0x03, 0x5b, 0x51, 0x1b, 0x31, 0x90,
-  0x01, 0x00, 0x80, 0x3d, 0x3b, 0x17, 0xdd, 0x2d, 0xac, 0x2b, 0xbd, 0x37,
-  0x5f, 0x4d, 0x61, 0x05, 0x1a, 0x4d, 0x19, 0x07, 0x34, 0x52, 0xef, 0x3c,
-  0xb8, 0xe5, 0x88, 0x78, 0x3b, 0x6c, 0x45, 0x05, 0x00, 0x98, 0x04, 0x67,
-  0xa3, 0xfb, 0xe6, 0x6b, 0x7f, 0x0a, 0xeb, 0x42, 0xde, 0x38, 0x00, 0x07,
-  0xa3, 0x8c, 0x03, 0x1a, 0xa5, 0x77, 0x1e, 0xdc, 0x4a, 0x74, 0xcf, 0x83,
-  0x6b, 0xdc, 0x54, 0xd4, 0x83, 0x6a, 0x99, 0xa6, 0x0a, 0x00, 0x13, 0x69,
-  0xad, 0xdd, 0xc9, 0x1d, 0xa1, 0x8e, 0xfa, 0x53, 0x58, 0x9d, 0x2b, 0x07,
-  0x34, 0x92, 0xbb, 0x3b, 0xa0, 0xf6, 0x52, 0x4a, 0x27, 0x4b, 0x25, 0xdc,
-  0x6b, 0x31, 0x81, 0x53, 0x51, 0xe7, 0x67, 0x5b, 0xb9, 0x23, 0x00, 0x00,
-  0x19, 0x74, 0xb6, 0x77, 0x72, 0x47, 0xa8, 0xbb, 0xfe, 0xb9, 0x72, 0xcb,
-  0x4a, 0x39, 0xa0, 0x29, 0x94, 0x71, 0x40, 0x6d, 0xf5, 0x4a, 0xb8, 0xcb,
-  0x11, 0xb1, 0x12, 0x13, 0x5a, 0xc2, 0x01, 0x00, 0xb0, 0x27, 0xe7, 0xe3,
-  0x7e, 0x29, 0x77, 0x31, 0x77, 0x18, 0x80, 0x47, 0x51, 0xc6, 0x01, 0xb5,
-  0x33, 0x50, 0xc2, 0x19, 0xca, 0x00, 0x00, 0xc0, 0x5e, 0x9d, 0x8f, 0xfb,
-  0xc3, 0x1e, 0x2e, 0xe6, 0x0e, 0x03, 0x30, 0x8c, 0x32, 0x0e, 0xa8, 0x0d,
-  0x25, 0x1c, 0x00, 0xc0, 0x7d, 0xab, 0xb7, 0x37, 0x72, 0x47, 0x68, 0xb2,
-  0xb3, 0xa1, 0x94, 0x03, 0x6a, 0x4a, 0x19, 0x07, 0x64, 0xa7, 0x84, 0x03,
-  0x00, 0x60, 0x44, 0x94, 0x72, 0x40, 0xed, 0x28, 0xe3, 0x80, 0x6c, 0x94,
-  0x70, 0x00, 0x00, 0x54, 0x44, 0x29, 0x07, 0xd4, 0x86, 0x32, 0x0e, 0xa8,
-  0x9c, 0x12, 0x0e, 0x00, 0xe0, 0xf1, 0x36, 0xb7, 0x4c, 0x52, 0x1d, 0x81,
-  0x72, 0x29, 0x77, 0x21, 0x77, 0x18, 0x60, 0x32, 0x29, 0xe3, 0x80, 0x4a,
-  0x29, 0xe1, 0xf6, 0x6f, 0x7e, 0xb6, 0x95, 0x3b, 0x02, 0x00, 0x90, 0xc1,
-  0xda, 0x7a, 0x27, 0x77, 0x84, 0x71, 0x76, 0x36, 0x22, 0xbe, 0xd3, 0x9b,
-  0xbe, 0xba, 0x94, 0x3b, 0x0c, 0x30, 0x59, 0x94, 0x71, 0x40, 0x25, 0x52,
-  0x4a, 0x17, 0x53, 0x4a, 0x2b, 0xa1, 0x84, 0xdb, 0xb7, 0xd6, 0xb4, 0x97,
-  0x6a, 0x00, 0x80, 0x11, 0x39, 0x1f, 0x11, 0x3f, 0xe8, 0x95, 0x72, 0x8b,
-  0xb9, 0xc3, 0x00, 0x93, 0xc1, 0x1d, 0x1e, 0x30, 0x52, 0x29, 0xa5, 0xa5,
-  0x94, 0xd2, 0xf5, 0x88, 0x78, 0x2d, 0xba, 0xef, 0x40, 0x02, 0x00, 0x40,
-  0xdd, 0x9c, 0x8f, 0x88, 0xb7, 0x53, 0x4a, 0x57, 0x52, 0x4a, 0x0b, 0x99,
-  0xb3, 0x00, 0x63, 0x4e, 0x19, 0x07, 0x8c, 0x44, 0x4a, 0x69, 0x31, 0xa5,
-  0xb4, 0x1c, 0x11, 0x3f, 0x88, 0x88, 0x73, 0x99, 0xe3, 0x00, 0x00, 0x34,
-  0x4e, 0xc7, 0x99, 0x71, 0x39, 0xbc, 0x14, 0x11, 0x1f, 0xa4, 0x94, 0x2e,
-  0xa7, 0x94, 0x4e, 0xe6, 0x0e, 0x03, 0x8c, 0x27, 0x65, 0x1c, 0x70, 0xa4,
-  0x7a, 0xc3, 0x19, 0xae, 0x44, 0xc4, 0xdb, 0xd1, 0x7d, 0x87, 0x11, 0x00,
-  0x80, 0x03, 0x70, 0x66, 0x5c, 0x56, 0xdf, 0x8c, 0x08, 0x93, 0x57, 0x81,
-  0x91, 0x50, 0xc6, 0x01, 0x47, 0xa6, 0x34, 0x9c, 0xe1, 0xa5, 0xbc, 0x49,
-  0x00, 0x00, 0xe0, 0xd0, 0xe6, 0xa2, 0x3b, 0x79, 0xf5, 0xba, 0x21, 0x0f,
-  0xc0, 0x51, 0x52, 0xc6, 0x01, 0x87, 0xd6, 0x3b, 0x17, 0x6e, 0x25, 0x0c,
-  0x67, 0x00, 0x00, 0x60, 0xfc, 0x9c, 0x8b, 0xee, 0x90, 0x87, 0xab, 0xce,
-  0x93, 0x03, 0x8e, 0x82, 0x32, 0x0e, 0x38, 0xb0, 0x94, 0xd2, 0x42, 0x4a,
-  0xe9, 0x6a, 0x74, 0xcf, 0x85, 0x33, 0x9c, 0x01, 0x00, 0xe0, 0x08, 0xb5,
-  0xef, 0x6e, 0xe5, 0x8e, 0xc0, 0x83, 0x5e, 0x8c, 0x88, 0xeb, 0xbd, 0xdd,
-  0x20, 0x00, 0x07, 0xa6, 0x8c, 0x03, 0x0e, 0xa4, 0xf7, 0x4b, 0xc8, 0xf5,
-  0xe8, 0xfe, 0x52, 0xc2, 0x08, 0xcd, 0xcf, 0xb6, 0x72, 0x47, 0x00, 0x00,
-  0x32, 0x58, 0xdf, 0xd8, 0xce, 0x1d, 0x81, 0xdd, 0xe6, 0x22, 0xe2, 0x9b,
-  0x29, 0xa5, 0x15, 0x5b, 0x57, 0x81, 0x83, 0x52, 0xc6, 0x01, 0xfb, 0x62,
-  0x4b, 0x6a, 0xf5, 0x5a, 0xd3, 0x5e, 0xaa, 0x01, 0x00, 0x6a, 0xe6, 0x6c,
-  0xdc, 0xdf, 0xba, 0x6a, 0xea, 0x2a, 0xb0, 0x2f, 0xee, 0xf0, 0x80, 0x3d,
-  0x29, 0x4d, 0x49, 0xb5, 0x25, 0x15, 0x00, 0x00, 0xba, 0x5e, 0x8c, 0xee,
-  0xd4, 0xd5, 0x4b, 0xb9, 0x83, 0x00, 0xcd, 0xa1, 0x8c, 0x03, 0x1e, 0x2b,
-  0xa5, 0x74, 0x21, 0x4c, 0x49, 0x05, 0x00, 0xa8, 0xcc, 0xda, 0x7a, 0x27,
-  0x77, 0x04, 0xf6, 0x6e, 0x2e, 0x22, 0xbe, 0x95, 0x52, 0x5a, 0x36, 0xe0,
-  0x01, 0xd8, 0x0b, 0x65, 0x1c, 0xf0, 0x50, 0xbd, 0xd5, 0x70, 0x57, 0x23,
-  0xe2, 0x3b, 0x61, 0x4b, 0x2a, 0x00, 0x40, 0x65, 0x3a, 0x5b, 0x3b, 0xb9,
-  0x23, 0xb0, 0x7f, 0xe7, 0x23, 0xe2, 0x03, 0x03, 0x1e, 0x80, 0xc7, 0x51,
-  0xc6, 0x01, 0x43, 0x95, 0x56, 0xc3, 0x19, 0xd0, 0x00, 0x00, 0x00, 0x7b,
-  0xf7, 0xcd, 0x94, 0xd2, 0xf5, 0x94, 0xd2, 0x62, 0xee, 0x20, 0x40, 0x3d,
-  0x29, 0xe3, 0x80, 0x07, 0x58, 0x0d, 0x07, 0x00, 0x00, 0x87, 0x76, 0x2e,
-  0x22, 0xde, 0xb6, 0x4a, 0x0e, 0x18, 0x46, 0x19, 0x07, 0xdc, 0x63, 0x35,
-  0x1c, 0x00, 0x40, 0x3d, 0x38, 0x33, 0x6e, 0x6c, 0x7c, 0xd3, 0x59, 0x72,
-  0xc0, 0x20, 0x65, 0x1c, 0x50, 0x9e, 0x94, 0x6a, 0x35, 0x5c, 0x0d, 0xcd,
-  0xcf, 0xb6, 0x72, 0x47, 0x00, 0x00, 0x2a, 0xb6, 0xe9, 0xcc, 0xb8, 0x71,
-  0x72, 0x3e, 0x22, 0xae, 0xa7, 0x94, 0x2e, 0xe6, 0x0e, 0x02, 0xd4, 0x83,
-  0x32, 0x0e, 0x26, 0x5c, 0xef, 0x2c, 0x8b, 0xeb, 0x61, 0x52, 0x6a, 0x6d,
-  0x1d, 0x9f, 0xf6, 0x52, 0x0d, 0x00, 0xd0, 0x70, 0x73, 0x11, 0xf1, 0x5a,
-  0x4a, 0xe9, 0x6a, 0x4a, 0xe9, 0x64, 0xee, 0x30, 0x40, 0x5e, 0xee, 0xf0,
-  0x60, 0x82, 0xa5, 0x94, 0x2e, 0x45, 0xc4, 0xdb, 0x11, 0x71, 0x36, 0x77,
-  0x16, 0x00, 0x00, 0x98, 0x00, 0x2f, 0x46, 0x77, 0x95, 0x9c, 0xe1, 0x0e,
-  0x30, 0xc1, 0x94, 0x71, 0x30, 0x81, 0x7a, 0xdb, 0x52, 0x97, 0x23, 0xe2,
-  0x5b, 0xb9, 0xb3, 0x00, 0x00, 0xb0, 0x9b, 0x33, 0xe3, 0xc6, 0xda, 0xd9,
-  0xe8, 0x0e, 0x77, 0xb8, 0x94, 0x3b, 0x08, 0x90, 0x87, 0x32, 0x0e, 0x26,
-  0x4c, 0x69, 0x5b, 0xea, 0xf9, 0xdc, 0x59, 0x00, 0x00, 0x18, 0xae, 0xe3,
-  0xcc, 0xb8, 0x49, 0xf0, 0x2d, 0xdb, 0x56, 0x61, 0x32, 0x29, 0xe3, 0x60,
-  0x82, 0xd8, 0x96, 0x0a, 0x00, 0x00, 0xb5, 0x62, 0xdb, 0x2a, 0x4c, 0x20,
-  0x65, 0x1c, 0x4c, 0x80, 0xd2, 0xb4, 0x54, 0xdb, 0x52, 0x01, 0x00, 0xa0,
-  0x5e, 0xfa, 0xdb, 0x56, 0x2f, 0xe6, 0x0e, 0x02, 0x54, 0x43, 0x19, 0x07,
-  0x63, 0x2e, 0xa5, 0xb4, 0x10, 0x11, 0xcb, 0x61, 0x5a, 0x2a, 0x00, 0x40,
-  0x63, 0xac, 0xde, 0xde, 0xc8, 0x1d, 0x81, 0xea, 0xbd, 0xd6, 0x7b, 0x03,
-  0x1d, 0x18, 0x73, 0xca, 0x38, 0x18, 0x63, 0xa5, 0xf3, 0xe1, 0xce, 0xe5,
-  0xce, 0xc2, 0xc1, 0xb5, 0xa6, 0xbd, 0x54, 0x03, 0x00, 0x4c, 0x88, 0x97,
-  0x52, 0x4a, 0xcb, 0xce, 0x91, 0x83, 0xf1, 0xe6, 0x0e, 0x0f, 0xc6, 0x54,
-  0x6f, 0x99, 0xfb, 0xdb, 0x11, 0x31, 0x97, 0x39, 0x0a, 0x87, 0x34, 0x3f,
-  0xdb, 0xca, 0x1d, 0x01, 0x00, 0x80, 0xea, 0x9c, 0x8f, 0x88, 0x65, 0xe7,
-  0xc8, 0xc1, 0xf8, 0x52, 0xc6, 0xc1, 0x18, 0x4a, 0x29, 0xbd, 0x12, 0x11,
-  0xaf, 0xe5, 0xce, 0x01, 0x00, 0x00, 0x1c, 0xc8, 0xb9, 0xe8, 0x16, 0x72,
-  0x4b, 0xb9, 0x83, 0x00, 0x47, 0x4f, 0x19, 0x07, 0x63, 0xa6, 0x77, 0xce,
-  0xc4, 0x37, 0x72, 0xe7, 0x00, 0x00, 0xe0, 0x60, 0x9c, 0x17, 0x47, 0xcf,
-  0x5c, 0x44, 0xfc, 0xc0, 0x60, 0x07, 0x18, 0x3f, 0x53, 0xb9, 0x03, 0x00,
-  0x47, 0xa3, 0x77, 0xae, 0xc4, 0x72, 0x38, 0x1f, 0x0e, 0x00, 0x00, 0xc6,
-  0xc9, 0x6b, 0x29, 0xa5, 0x93, 0x45, 0x51, 0xbc, 0x92, 0x3b, 0x08, 0x70,
-  0x34, 0xac, 0x8c, 0x83, 0x31, 0xa0, 0x88, 0x03, 0x00, 0x80, 0xb1, 0xf6,
-  0x2d, 0x93, 0x56, 0x61, 0x7c, 0x28, 0xe3, 0xa0, 0xe1, 0x7a, 0x07, 0xbb,
-  0x2e, 0x87, 0x22, 0x0e, 0x00, 0x00, 0xc6, 0xd9, 0x4b, 0x0a, 0x39, 0x18,
-  0x0f, 0xb6, 0xa9, 0x42, 0x83, 0x95, 0x8a, 0x38, 0x13, 0x53, 0x01, 0x00,
-  0xc6, 0xc4, 0x2d, 0x67, 0xc6, 0xf1, 0x70, 0x2f, 0xa5, 0x94, 0xa2, 0x28,
-  0x8a, 0x8b, 0xb9, 0x83, 0x00, 0x07, 0x67, 0x65, 0x1c, 0x34, 0x94, 0x22,
-  0x0e, 0x00, 0x00, 0x26, 0xd2, 0x4b, 0x29, 0xa5, 0xab, 0xbd, 0xa3, 0x6a,
-  0x80, 0x06, 0x52, 0xc6, 0x41, 0x03, 0x29, 0xe2, 0x26, 0x47, 0x6b, 0xca,
-  0xcb, 0x34, 0x00, 0x00, 0xbb, 0xbc, 0x18, 0x11, 0xcb, 0x0a, 0x39, 0x68,
-  0x26, 0x77, 0x79, 0xd0, 0x30, 0x8a, 0xb8, 0xc9, 0x32, 0x3f, 0xd7, 0xca,
-  0x1d, 0x01, 0x00, 0x80, 0x7a, 0x3a, 0x17, 0x11, 0x57, 0x73, 0x87, 0x00,
-  0xf6, 0x4f, 0x19, 0x07, 0x0d, 0xa2, 0x88, 0x03, 0x00, 0x18, 0x7f, 0xab,
-  0xce, 0x8c, 0x63, 0xef, 0xce, 0x1b, 0xea, 0x00, 0xcd, 0xa3, 0x8c, 0x83,
-  0x86, 0xe8, 0x2d, 0x41, 0x5f, 0x0e, 0x45, 0x1c, 0x00, 0x00, 0x70, 0x9f,
-  0x29, 0xab, 0xd0, 0x30, 0xca, 0x38, 0x68, 0x00, 0x45, 0x1c, 0x00, 0x00,
-  0xf0, 0x08, 0x0a, 0x39, 0x68, 0x10, 0x65, 0x1c, 0xd4, 0x5c, 0xa9, 0x88,
-  0x3b, 0x97, 0x39, 0x0a, 0x00, 0x00, 0x50, 0x5f, 0x2f, 0xa5, 0x94, 0x2e,
-  0xe7, 0x0e, 0x01, 0x3c, 0x9e, 0x32, 0x0e, 0xea, 0xef, 0x95, 0x50, 0xc4,
-  0x01, 0x00, 0x4c, 0x0c, 0x67, 0xc6, 0x71, 0x08, 0xdf, 0x4c, 0x29, 0x5d,
-  0xcc, 0x1d, 0x02, 0x78, 0x34, 0x65, 0x1c, 0xd4, 0x58, 0x4a, 0xe9, 0x95,
-  0x88, 0x78, 0x29, 0x77, 0x0e, 0x00, 0x00, 0xa0, 0x31, 0x5e, 0xeb, 0x0d,
-  0x7e, 0x03, 0x6a, 0x4a, 0x19, 0x07, 0x35, 0xd5, 0x7b, 0x47, 0xeb, 0x1b,
-  0xb9, 0x73, 0x00, 0x00, 0x00, 0x8d, 0xb3, 0x9c, 0x52, 0x5a, 0xc8, 0x1d,
-  0x02, 0x18, 0x4e, 0x19, 0x07, 0x35, 0xd4, 0x7b, 0x27, 0xeb, 0xb5, 0xdc,
-  0x39, 0x00, 0x00, 0x80, 0x46, 0x9a, 0x8b, 0x88, 0xab, 0xbd, 0xf3, 0xa7,
-  0x81, 0x9a, 0x51, 0xc6, 0x41, 0xcd, 0x94, 0x06, 0x36, 0x40, 0x9c, 0x3e,
-  0x35, 0x93, 0x3b, 0x02, 0x00, 0x50, 0x21, 0xe7, 0xc5, 0x71, 0x84, 0xce,
-  0x45, 0xf7, 0xfc, 0x69, 0xa0, 0x66, 0x94, 0x71, 0x50, 0x3f, 0x57, 0xa3,
-  0xfb, 0x4e, 0x16, 0x00, 0x00, 0xc0, 0x61, 0xbc, 0x94, 0x52, 0xba, 0x94,
-  0x3b, 0x04, 0xf0, 0x20, 0x65, 0x1c, 0xd4, 0x48, 0x6f, 0x14, 0xf9, 0xf9,
-  0xdc, 0x39, 0x00, 0x00, 0x80, 0xb1, 0xf1, 0x2d, 0x03, 0x1d, 0xa0, 0x5e,
-  0x94, 0x71, 0x50, 0x13, 0x29, 0xa5, 0xa5, 0x88, 0xf8, 0x66, 0xee, 0x1c,
-  0x00, 0x00, 0xc0, 0xd8, 0x71, 0x7e, 0x1c, 0xd4, 0x88, 0x32, 0x0e, 0x6a,
-  0xa0, 0xf7, 0x83, 0xf1, 0x6a, 0xee, 0x1c, 0x00, 0x00, 0xe4, 0xb5, 0xb6,
-  0xde, 0xc9, 0x1d, 0x81, 0xf1, 0x74, 0x36, 0x9c, 0x1f, 0x07, 0xb5, 0xa1,
-  0x8c, 0x83, 0x7a, 0xb8, 0x12, 0xce, 0x89, 0x03, 0x00, 0x98, 0x78, 0x9b,
-  0x5b, 0x3b, 0xb9, 0x23, 0x30, 0xbe, 0x5e, 0x4a, 0x29, 0x5d, 0xc8, 0x1d,
-  0x02, 0x50, 0xc6, 0x41, 0x76, 0xbd, 0x1f, 0x88, 0x2f, 0xe6, 0xce, 0x01,
-  0x00, 0x00, 0x8c, 0xbd, 0x2b, 0xb6, 0xab, 0x42, 0x7e, 0xca, 0x38, 0xc8,
-  0xa8, 0xf7, 0x83, 0xf0, 0x4a, 0xee, 0x1c, 0x00, 0x00, 0xc0, 0x44, 0x98,
-  0x0b, 0xf7, 0x1f, 0x90, 0x9d, 0x32, 0x0e, 0xf2, 0x7a, 0x25, 0x6c, 0x4f,
-  0x05, 0x00, 0xa0, 0xc7, 0x99, 0x71, 0x54, 0xe0, 0xc5, 0xde, 0xf0, 0x38,
-  0x20, 0x13, 0x65, 0x1c, 0x64, 0xd2, 0xfb, 0x01, 0xf8, 0x52, 0xee, 0x1c,
-  0x00, 0x00, 0xd4, 0x47, 0xc7, 0x99, 0x71, 0x54, 0xe3, 0x4a, 0xee, 0x00,
-  0x30, 0xc9, 0x94, 0x71, 0x90, 0x8f, 0x69, 0x46, 0x3c, 0xd6, 0x99, 0x53,
-  0x33, 0xb9, 0x23, 0x00, 0x00, 0x30, 0x7e, 0xce, 0xa6, 0x94, 0x2e, 0xe7,
-  0x0e, 0x01, 0x93, 0x4a, 0x19, 0x07, 0x19, 0xa4, 0x94, 0x2e, 0x46, 0xc4,
-  0xb9, 0xdc, 0x39, 0x00, 0x00, 0x80, 0x89, 0x75, 0xc9, 0x30, 0x07, 0xc8,
-  0x43, 0x19, 0x07, 0x15, 0xeb, 0xfd, 0xc0, 0xbb, 0x9c, 0x3b, 0x07, 0x00,
-  0x00, 0xf5, 0xd3, 0xbe, 0xbb, 0x95, 0x3b, 0x02, 0x93, 0x63, 0x2e, 0xec,
-  0xd6, 0x81, 0x2c, 0x94, 0x71, 0x50, 0xbd, 0x4b, 0x11, 0x71, 0x36, 0x77,
-  0x08, 0x00, 0x00, 0xea, 0x67, 0x7d, 0x63, 0x3b, 0x77, 0x04, 0x26, 0xcb,
-  0x4b, 0x29, 0xa5, 0x85, 0xdc, 0x21, 0x60, 0xd2, 0x28, 0xe3, 0xa0, 0x42,
-  0xbd, 0x55, 0x71, 0x97, 0x72, 0xe7, 0x00, 0x00, 0x00, 0xe8, 0xb9, 0x9c,
-  0x3b, 0x00, 0x4c, 0x1a, 0x65, 0x1c, 0x54, 0xeb, 0x52, 0x74, 0x97, 0x83,
-  0x03, 0x00, 0x00, 0xd4, 0x81, 0xd5, 0x71, 0x50, 0x31, 0x65, 0x1c, 0x54,
-  0xc4, 0xaa, 0x38, 0x00, 0x00, 0x1e, 0xc5, 0x79, 0x71, 0x64, 0x74, 0x39,
-  0x77, 0x00, 0x98, 0x24, 0xca, 0x38, 0xa8, 0xce, 0x85, 0xb0, 0x2a, 0x0e,
-  0x00, 0x80, 0x87, 0x70, 0x5e, 0x1c, 0x19, 0x59, 0x1d, 0x07, 0x15, 0x52,
-  0xc6, 0x41, 0x75, 0x2e, 0xe7, 0x0e, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x17,
-  0x73, 0x07, 0x80, 0x49, 0xa1, 0x8c, 0x83, 0x0a, 0xa4, 0x94, 0x96, 0xc2,
-  0x04, 0x55, 0x00, 0x00, 0xa0, 0xbe, 0x1c, 0xa9, 0x03, 0x15, 0x51, 0xc6,
-  0x41, 0x35, 0x2e, 0xe6, 0x0e, 0x40, 0x33, 0xcd, 0xce, 0x4c, 0xe5, 0x8e,
-  0x00, 0x00, 0x54, 0x64, 0x73, 0x6b, 0x27, 0x77, 0x04, 0x26, 0xdb, 0x5c,
-  0x4a, 0xe9, 0x62, 0xee, 0x10, 0x30, 0x09, 0x94, 0x71, 0x30, 0x62, 0xbd,
-  0xc1, 0x0d, 0x2f, 0xe5, 0xce, 0x41, 0x33, 0xcd, 0x9d, 0x98, 0xce, 0x1d,
-  0x01, 0x00, 0xa8, 0xc8, 0xda, 0x7a, 0x27, 0x77, 0x04, 0xb8, 0x90, 0x3b,
-  0x00, 0x4c, 0x02, 0x65, 0x1c, 0x8c, 0x9e, 0x1f, 0x68, 0x00, 0x00, 0x40,
-  0x13, 0xbc, 0xd8, 0x5b, 0x4c, 0x00, 0x8c, 0x90, 0x32, 0x0e, 0x46, 0x4f,
-  0x19, 0x07, 0x00, 0x00, 0x34, 0x85, 0xfb, 0x17, 0x18, 0x31, 0x65, 0x1c,
-  0x8c, 0x50, 0xef, 0x5d, 0xa5, 0x17, 0x73, 0xe7, 0x00, 0x00, 0x00, 0xd8,
-  0x23, 0x65, 0x1c, 0x8c, 0x98, 0x32, 0x0e, 0x46, 0xcb, 0x0f, 0x32, 0x00,
-  0x00, 0xf6, 0x64, 0xf5, 0xf6, 0x46, 0xee, 0x08, 0x10, 0x61, 0xab, 0x2a,
-  0x8c, 0x9c, 0x32, 0x0e, 0x46, 0x4b, 0x19, 0x07, 0x00, 0x00, 0x34, 0xcd,
-  0x52, 0xee, 0x00, 0x30, 0xce, 0x94, 0x71, 0x30, 0x5a, 0x4b, 0xb9, 0x03,
-  0x00, 0x00, 0x00, 0xec, 0x93, 0x45, 0x05, 0x30, 0x42, 0xca, 0x38, 0x18,
-  0x91, 0x94, 0xd2, 0x62, 0x44, 0xcc, 0xe5, 0xce, 0x01, 0x00, 0x00, 0xb0,
-  0x4f, 0x4b, 0xb9, 0x03, 0xc0, 0x38, 0x53, 0xc6, 0xc1, 0xe8, 0x2c, 0xe5,
-  0x0e, 0x00, 0x00, 0x40, 0x73, 0xac, 0xb5, 0x3b, 0xb9, 0x23, 0x40, 0xdf,
-  0x59, 0xe7, 0xc6, 0xc1, 0xe8, 0x28, 0xe3, 0x60, 0x74, 0x16, 0x73, 0x07,
-  0x00, 0x00, 0xa0, 0x39, 0x3a, 0xdb, 0x3b, 0xb9, 0x23, 0x40, 0xd9, 0x52,
-  0xee, 0x00, 0x30, 0xae, 0x94, 0x71, 0x30, 0x3a, 0xca, 0x38, 0x0e, 0xa5,
-  0x35, 0xe5, 0x25, 0x1a, 0x00, 0x80, 0x6c, 0xdc, 0xcf, 0xc0, 0x88, 0xb8,
-  0xd3, 0x83, 0xd1, 0x39, 0x97, 0x3b, 0x00, 0xcd, 0x36, 0x3f, 0xd7, 0xca,
-  0x1d, 0x01, 0x00, 0x80, 0xc9, 0xa5, 0x8c, 0x83, 0x11, 0x51, 0xc6, 0xc1,
-  0x08, 0xf4, 0x86, 0x37, 0x00, 0x00, 0xc0, 0x9e, 0xb4, 0xef, 0x6e, 0xe5,
-  0x8e, 0x00, 0x83, 0x16, 0x72, 0x07, 0x80, 0x71, 0xa5, 0x8c, 0x83, 0xd1,
-  0x70, 0xd8, 0x29, 0x00, 0x00, 0x7b, 0xb6, 0xbe, 0xb1, 0x9d, 0x3b, 0x02,
-  0x0c, 0xb2, 0xd3, 0x07, 0x46, 0x44, 0x19, 0x07, 0xa3, 0xb1, 0x94, 0x3b,
-  0x00, 0x00, 0x00, 0xc0, 0x61, 0xa4, 0x94, 0x16, 0x72, 0x67, 0x80, 0x71,
-  0xa4, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x86, 0x59, 0xc8, 0x1d, 0x00, 0xc6,
-  0x91, 0x32, 0x0e, 0x46, 0xc3, 0x99, 0x71, 0x00, 0x00, 0x00, 0xc0, 0x2e,
-  0xca, 0x38, 0x18, 0x0d, 0x67, 0xc6, 0x01, 0x00, 0xb0, 0x67, 0xb7, 0x6e,
-  0x6f, 0xe4, 0x8e, 0x00, 0xc3, 0x58, 0x64, 0x00, 0x23, 0xa0, 0x8c, 0x03,
-  0x00, 0x00, 0x00, 0x86, 0xb1, 0xc8, 0x00, 0x46, 0x40, 0x19, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x15, 0x51, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x40, 0x45,
-  0x94, 0x71, 0x00, 0x00, 0x00, 0x99, 0xad, 0xad, 0x77, 0x72, 0x47, 0x00,
-  0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x80, 0xcc, 0x3a, 0x5b, 0x3b, 0xb9,
-  0x23, 0x00, 0x50, 0x11, 0x65, 0x1c, 0x40, 0x4d, 0x9d, 0x3e, 0x35, 0x93,
-  0x3b, 0x02, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x19, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x15, 0x51, 0xc6, 0x01, 0x00, 0x00, 0x64, 0x66, 0x9b, 0x2a, 0x35,
-  0xb5, 0x9c, 0x3b, 0x00, 0x8c, 0x23, 0x65, 0x1c, 0x8c, 0xc6, 0x72, 0xee,
-  0x00, 0x00, 0x00, 0x34, 0x87, 0x01, 0x0e, 0x00, 0x93, 0x43, 0x19, 0x07,
-  0x00, 0x00, 0x00, 0x0c, 0xb3, 0x92, 0x3b, 0x00, 0x8c, 0x23, 0x65, 0x1c,
-  0x8c, 0xc6, 0xf5, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x0e, 0xa3, 0x28, 0x8a,
-  0x95, 0xdc, 0x19, 0x60, 0x1c, 0x29, 0xe3, 0x60, 0x34, 0xee, 0xe4, 0x0e,
-  0x00, 0x00, 0x00, 0x70, 0x08, 0x37, 0x73, 0x07, 0x80, 0x71, 0xa5, 0x8c,
-  0x83, 0x11, 0x28, 0x8a, 0x62, 0x39, 0x77, 0x06, 0x00, 0x00, 0x9a, 0x61,
-  0xf5, 0xf6, 0x46, 0xee, 0x08, 0x30, 0xcc, 0x4a, 0xee, 0x00, 0x30, 0xae,
-  0x94, 0x71, 0x30, 0x3a, 0xde, 0x49, 0x02, 0x00, 0x00, 0x9a, 0x6a, 0x39,
-  0x77, 0x00, 0x18, 0x57, 0xca, 0x38, 0x18, 0x1d, 0xe7, 0xc6, 0x01, 0x00,
-  0x00, 0x4d, 0xe5, 0x7e, 0x06, 0x46, 0x44, 0x19, 0x07, 0xa3, 0xe3, 0x87,
-  0x17, 0x00, 0x00, 0xd0, 0x54, 0xee, 0x67, 0x60, 0x44, 0x94, 0x71, 0x30,
-  0x3a, 0xcb, 0xb9, 0x03, 0x00, 0x00, 0x50, 0x7f, 0xed, 0xbb, 0x5b, 0xb9,
-  0x23, 0xc0, 0xa0, 0x9b, 0x26, 0xa9, 0xc2, 0xe8, 0x28, 0xe3, 0x60, 0x44,
-  0x0c, 0x71, 0x00, 0x00, 0x60, 0x2f, 0xda, 0x1b, 0xdb, 0xb9, 0x23, 0xc0,
-  0xa0, 0xe5, 0xdc, 0x01, 0x60, 0x9c, 0x29, 0xe3, 0x60, 0xb4, 0xde, 0xcc,
-  0x1d, 0x80, 0xe6, 0x9a, 0x9b, 0x99, 0xca, 0x1d, 0x01, 0x00, 0x80, 0xc9,
-  0xb4, 0x9c, 0x3b, 0x00, 0x8c, 0x33, 0x65, 0x1c, 0x8c, 0xd6, 0x72, 0xee,
-  0x00, 0x34, 0xd7, 0xdc, 0x89, 0xe9, 0xdc, 0x11, 0x00, 0x00, 0x98, 0x4c,
-  0xcb, 0xb9, 0x03, 0xc0, 0x38, 0x53, 0xc6, 0xc1, 0x68, 0x5d, 0xcd, 0x1d,
-  0x00, 0x00, 0x00, 0x60, 0x1f, 0x6e, 0x38, 0x2f, 0x0e, 0x46, 0x4b, 0x19,
-  0x07, 0x23, 0xd4, 0xfb, 0x21, 0x76, 0x23, 0x77, 0x0e, 0x00, 0x00, 0xea,
-  0x6b, 0xf5, 0xf6, 0x46, 0xee, 0x08, 0x50, 0x76, 0x25, 0x77, 0x00, 0x18,
-  0x77, 0xca, 0x38, 0x18, 0xbd, 0x2b, 0xb9, 0x03, 0x00, 0x00, 0x00, 0xec,
-  0x91, 0xdd, 0x3d, 0x30, 0x62, 0xca, 0x38, 0x18, 0x3d, 0x3f, 0xcc, 0x00,
-  0x00, 0x80, 0x26, 0xb0, 0x45, 0x15, 0x2a, 0xa0, 0x8c, 0x83, 0x11, 0xeb,
-  0xfd, 0x30, 0xbb, 0x96, 0x3b, 0x07, 0x00, 0x00, 0xc0, 0x63, 0xbc, 0x92,
-  0x3b, 0x00, 0x4c, 0x02, 0x65, 0x1c, 0x54, 0xe3, 0x4a, 0xee, 0x00, 0x00,
-  0x00, 0xd4, 0x53, 0xfb, 0xee, 0x56, 0xee, 0x08, 0x10, 0x11, 0xd1, 0x0e,
-  0xbb, 0x7a, 0xa0, 0x12, 0xca, 0x38, 0xa8, 0x40, 0x51, 0x14, 0x57, 0x22,
-  0xe2, 0x66, 0xee, 0x1c, 0x00, 0x00, 0xd4, 0xcf, 0xfa, 0xc6, 0x76, 0xee,
-  0x08, 0x10, 0x11, 0x71, 0xb5, 0x28, 0x8a, 0x3b, 0xb9, 0x43, 0xc0, 0x24,
-  0x50, 0xc6, 0x41, 0x75, 0xae, 0xe4, 0x0e, 0x00, 0x00, 0x00, 0xf0, 0x10,
-  0x97, 0x73, 0x07, 0x80, 0x49, 0xa1, 0x8c, 0x83, 0xea, 0xbc, 0x12, 0xdd,
-  0xa5, 0xdf, 0x00, 0x00, 0x00, 0x75, 0x72, 0xcd, 0xe0, 0x06, 0xa8, 0x8e,
-  0x32, 0x0e, 0x2a, 0xd2, 0x5b, 0xf2, 0xed, 0x0c, 0x06, 0x00, 0x00, 0xa0,
-  0x6e, 0x2e, 0xe7, 0x0e, 0x00, 0x93, 0x44, 0x19, 0x07, 0xd5, 0xba, 0x9c,
-  0x3b, 0x00, 0x00, 0x00, 0xf5, 0xb1, 0x7a, 0x7b, 0x23, 0x77, 0x04, 0xb8,
-  0x56, 0x14, 0xc5, 0x72, 0xee, 0x10, 0x30, 0x49, 0x94, 0x71, 0x50, 0xa1,
-  0xde, 0xd2, 0xef, 0xd7, 0x73, 0xe7, 0x00, 0x00, 0x00, 0xe8, 0xb9, 0x9c,
-  0x3b, 0x00, 0x4c, 0x1a, 0x65, 0x1c, 0x54, 0xef, 0x52, 0x38, 0x3b, 0x0e,
-  0x00, 0x00, 0xc8, 0xcf, 0xaa, 0x38, 0xc8, 0x40, 0x19, 0x07, 0x15, 0xeb,
-  0x9d, 0x1d, 0xf7, 0x4a, 0xee, 0x1c, 0xd4, 0x5f, 0x6b, 0xda, 0x4b, 0x34,
-  0x00, 0x00, 0x23, 0x75, 0x31, 0x77, 0x00, 0x98, 0x44, 0xee, 0xf4, 0x20,
-  0x8f, 0x57, 0x22, 0xe2, 0x66, 0xee, 0x10, 0xd4, 0xdb, 0xfc, 0x6c, 0x2b,
-  0x77, 0x04, 0x00, 0x60, 0xc4, 0x36, 0xb7, 0x76, 0x72, 0x47, 0x60, 0x72,
-  0xbd, 0x6a, 0x82, 0x2a, 0xe4, 0xa1, 0x8c, 0x83, 0x0c, 0x7a, 0xab, 0xe3,
-  0x2e, 0xe5, 0xce, 0x01, 0x00, 0x40, 0x5e, 0x6b, 0xeb, 0x9d, 0xdc, 0x11,
-  0x98, 0x4c, 0xed, 0x70, 0x56, 0x1c, 0x64, 0xa3, 0x8c, 0x83, 0x4c, 0x8a,
-  0xa2, 0xb8, 0x1a, 0x11, 0xd7, 0x72, 0xe7, 0x00, 0x00, 0x00, 0x26, 0xce,
-  0xe5, 0xde, 0x02, 0x01, 0x20, 0x03, 0x65, 0x1c, 0xe4, 0x75, 0x31, 0x0c,
-  0x73, 0x00, 0x00, 0x00, 0xaa, 0x73, 0xad, 0x28, 0x0a, 0x67, 0x58, 0x43,
-  0x46, 0xca, 0x38, 0xc8, 0xa8, 0x77, 0x46, 0x83, 0x1f, 0x84, 0x00, 0x00,
-  0x40, 0x55, 0x2e, 0xe6, 0x0e, 0x00, 0x93, 0x4e, 0x19, 0x07, 0x99, 0x15,
-  0x45, 0x71, 0x39, 0x22, 0x6e, 0xe4, 0xce, 0x01, 0x00, 0x40, 0xf5, 0x9c,
-  0x19, 0x47, 0xc5, 0x7e, 0xc7, 0xd0, 0x06, 0xc8, 0x4f, 0x19, 0x07, 0xf5,
-  0x70, 0x21, 0x6c, 0x57, 0x05, 0x00, 0x98, 0x38, 0x1d, 0xd3, 0x54, 0xa9,
-  0x8e, 0xed, 0xa9, 0x50, 0x13, 0xca, 0x38, 0xa8, 0x81, 0xde, 0xbb, 0x53,
-  0x97, 0x33, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0x53, 0x3b, 0x6c, 0x4f, 0x85,
-  0xda, 0x50, 0xc6, 0x41, 0x4d, 0xf4, 0xde, 0xa5, 0x7a, 0x33, 0x77, 0x0e,
-  0x00, 0x00, 0x60, 0xec, 0x5c, 0xb4, 0x3d, 0x15, 0xea, 0x43, 0x19, 0x07,
-  0xf5, 0x72, 0x31, 0x22, 0x6e, 0xe6, 0x0e, 0x01, 0x00, 0x00, 0x8c, 0x8d,
-  0x57, 0x8b, 0xa2, 0xb8, 0x9a, 0x3b, 0x04, 0x70, 0x9f, 0x32, 0x0e, 0x6a,
-  0xa4, 0x28, 0x8a, 0x3b, 0xe1, 0xfc, 0x38, 0x00, 0x80, 0x89, 0xb1, 0x7a,
-  0x7b, 0x23, 0x77, 0x04, 0xc6, 0xdb, 0x8d, 0xa2, 0x28, 0x2e, 0xe5, 0x0e,
-  0x01, 0x3c, 0x48, 0x19, 0x07, 0x35, 0x53, 0x14, 0xc5, 0xf5, 0x88, 0xf0,
-  0x03, 0x13, 0x00, 0x00, 0x38, 0x8c, 0x76, 0x74, 0xdf, 0xe8, 0x07, 0x6a,
-  0x46, 0x19, 0x07, 0x35, 0x54, 0x14, 0xc5, 0x95, 0x88, 0x78, 0x35, 0x77,
-  0x0e, 0x00, 0x00, 0xa0, 0xb1, 0x96, 0x9c, 0x13, 0x07, 0xf5, 0xa4, 0x8c,
-  0x83, 0x9a, 0xea, 0x2d, 0x27, 0x37, 0xd0, 0x01, 0x00, 0x00, 0xd8, 0xaf,
-  0x97, 0x7b, 0x3b, 0x6e, 0x80, 0x1a, 0x52, 0xc6, 0x41, 0xbd, 0x5d, 0x8c,
-  0x88, 0x1b, 0xb9, 0x43, 0x00, 0x00, 0x70, 0xf4, 0x3a, 0x5b, 0x3b, 0xb9,
-  0x23, 0x30, 0x9e, 0x5e, 0xed, 0xed, 0xb4, 0x01, 0x6a, 0x4a, 0x19, 0x07,
-  0x35, 0xd6, 0x1b, 0xe8, 0xb0, 0x14, 0x06, 0x3a, 0x00, 0x00, 0x8c, 0x9d,
-  0xb5, 0xf5, 0x4e, 0xee, 0x08, 0x8c, 0x9f, 0xd7, 0x0d, 0x6c, 0x80, 0xfa,
-  0x53, 0xc6, 0x41, 0xcd, 0x29, 0xe4, 0x00, 0x00, 0x80, 0x3d, 0xb8, 0x56,
-  0x14, 0xc5, 0xc5, 0xdc, 0x21, 0x80, 0xc7, 0x53, 0xc6, 0x41, 0x03, 0xf4,
-  0xce, 0x7b, 0x58, 0x0a, 0x85, 0xdc, 0xc4, 0x68, 0x4d, 0x79, 0x79, 0x06,
-  0x00, 0x60, 0xcf, 0x6e, 0x84, 0xc9, 0xa9, 0xd0, 0x18, 0xee, 0xf6, 0xa0,
-  0x21, 0x4a, 0x85, 0x1c, 0x13, 0x60, 0x7e, 0xae, 0x95, 0x3b, 0x02, 0x00,
-  0x00, 0xcd, 0x70, 0x23, 0xba, 0x93, 0x53, 0xef, 0xe4, 0x0e, 0x02, 0xec,
-  0x8d, 0x32, 0x0e, 0x1a, 0xa4, 0x57, 0xc8, 0xbd, 0x9c, 0x3b, 0x07, 0x00,
-  0x00, 0x87, 0xd7, 0xbe, 0xbb, 0x95, 0x3b, 0x02, 0xcd, 0xa7, 0x88, 0x83,
-  0x06, 0x52, 0xc6, 0x41, 0xc3, 0xf4, 0x26, 0x23, 0x29, 0xe4, 0x00, 0x00,
-  0x1a, 0xae, 0xbd, 0xb1, 0x9d, 0x3b, 0x02, 0xcd, 0xa6, 0x88, 0x83, 0x86,
-  0x52, 0xc6, 0x41, 0x03, 0x29, 0xe4, 0x00, 0x00, 0x60, 0xa2, 0x29, 0xe2,
-  0xa0, 0xc1, 0x94, 0x71, 0xd0, 0x50, 0xbd, 0x42, 0xee, 0x6b, 0x61, 0xa8,
-  0x03, 0x00, 0x00, 0x4c, 0x12, 0x45, 0x1c, 0x34, 0x9c, 0x32, 0x0e, 0x1a,
-  0xac, 0x28, 0x8a, 0xab, 0x61, 0xca, 0x2a, 0x00, 0x00, 0x4c, 0x0a, 0x45,
-  0x1c, 0x8c, 0x01, 0x65, 0x1c, 0x34, 0x5c, 0x69, 0xca, 0xaa, 0x42, 0x0e,
-  0x00, 0xa0, 0x41, 0xd6, 0xd6, 0x3b, 0xb9, 0x23, 0xd0, 0x2c, 0xd7, 0x42,
-  0x11, 0x07, 0x63, 0x41, 0x19, 0x07, 0x63, 0xa0, 0x54, 0xc8, 0xdd, 0xcc,
-  0x1c, 0x05, 0x00, 0x80, 0x3d, 0xea, 0x6c, 0xed, 0xe4, 0x8e, 0x40, 0x73,
-  0xbc, 0x5e, 0x14, 0x85, 0x22, 0x0e, 0xc6, 0x84, 0x32, 0x0e, 0xc6, 0x44,
-  0xaf, 0x90, 0x5b, 0x8c, 0xee, 0xd2, 0x75, 0x00, 0x00, 0x60, 0x3c, 0xbc,
-  0x5e, 0x14, 0xc5, 0xc5, 0xdc, 0x21, 0x80, 0xa3, 0xa3, 0x8c, 0x83, 0x31,
-  0xd2, 0x7b, 0xa7, 0x6c, 0x29, 0x22, 0xde, 0xcc, 0x1c, 0x05, 0x00, 0x00,
-  0x38, 0xbc, 0x97, 0x15, 0x71, 0x30, 0x7e, 0x94, 0x71, 0x30, 0x66, 0x8a,
-  0xa2, 0xb8, 0x53, 0x14, 0xc5, 0x85, 0x88, 0x78, 0x3d, 0x77, 0x16, 0x00,
-  0x00, 0xe0, 0x40, 0xda, 0x11, 0xf1, 0xb5, 0xa2, 0x28, 0xae, 0xe4, 0x0e,
-  0x02, 0x1c, 0x3d, 0x65, 0x1c, 0x8c, 0xa9, 0xde, 0x3b, 0x68, 0x2f, 0xe7,
-  0xce, 0x01, 0x00, 0xc0, 0x70, 0xab, 0xb7, 0x37, 0x72, 0x47, 0xa0, 0x9e,
-  0x6e, 0x46, 0x77, 0x50, 0xc3, 0xd5, 0xdc, 0x41, 0x80, 0xd1, 0x50, 0xc6,
-  0xc1, 0x18, 0xeb, 0xbd, 0x93, 0xf6, 0xe5, 0x30, 0x69, 0x15, 0x00, 0x00,
-  0x9a, 0xe0, 0x5a, 0x44, 0x2c, 0xf6, 0xce, 0x83, 0x06, 0xc6, 0x94, 0x32,
-  0x0e, 0xc6, 0x5c, 0x51, 0x14, 0xcb, 0x61, 0xb0, 0x03, 0x00, 0x00, 0xd4,
-  0xdd, 0xab, 0x26, 0xa6, 0xc2, 0x64, 0x50, 0xc6, 0xc1, 0x04, 0x28, 0x8a,
-  0x62, 0x25, 0xba, 0x83, 0x1d, 0x9c, 0x23, 0x07, 0x00, 0x00, 0xf5, 0xd2,
-  0x8e, 0xee, 0xa0, 0x86, 0x4b, 0xb9, 0x83, 0x00, 0xd5, 0x50, 0xc6, 0xc1,
-  0x84, 0xe8, 0x0d, 0x76, 0xb8, 0x18, 0xdd, 0x73, 0xe4, 0x6c, 0x5b, 0x05,
-  0x00, 0x80, 0xfc, 0x6e, 0x44, 0xf7, 0x7c, 0xb8, 0x2b, 0xb9, 0x83, 0x00,
-  0xd5, 0x51, 0xc6, 0xc1, 0x84, 0xe9, 0xfd, 0xa0, 0x5f, 0x8a, 0xee, 0xc1,
-  0xb0, 0x00, 0x00, 0x64, 0x60, 0x78, 0x03, 0x11, 0xf1, 0x66, 0x74, 0x8b,
-  0x38, 0xe7, 0xc3, 0xc1, 0x84, 0x51, 0xc6, 0xc1, 0x04, 0xea, 0xfd, 0xc0,
-  0x5f, 0x0c, 0xdb, 0x56, 0x01, 0x00, 0xa0, 0x6a, 0xfd, 0x6d, 0xa9, 0x17,
-  0x9c, 0x0f, 0x07, 0x93, 0x49, 0x19, 0x07, 0x13, 0xca, 0xb6, 0x55, 0x00,
-  0x00, 0xa8, 0x9c, 0x6d, 0xa9, 0x80, 0x32, 0x0e, 0x26, 0x5d, 0xef, 0x17,
-  0x01, 0xd3, 0x56, 0x01, 0x00, 0x60, 0xb4, 0x5e, 0x2d, 0x8a, 0x62, 0xd1,
-  0xb6, 0x54, 0x40, 0x19, 0x07, 0x44, 0x51, 0x14, 0x2b, 0x45, 0x51, 0x2c,
-  0x46, 0xc4, 0xef, 0xe5, 0xce, 0x02, 0x00, 0x30, 0x09, 0x36, 0xb7, 0x76,
-  0x72, 0x47, 0xa0, 0x3a, 0xed, 0x88, 0xf8, 0xb2, 0x69, 0xa9, 0x40, 0x9f,
-  0x32, 0x0e, 0xb8, 0xa7, 0x28, 0x8a, 0xcb, 0x11, 0xf1, 0x85, 0x30, 0xdc,
-  0x01, 0x00, 0x60, 0xa4, 0xd6, 0xd6, 0x3b, 0xb9, 0x23, 0x50, 0x8d, 0x37,
-  0x23, 0x62, 0xa1, 0x28, 0x8a, 0xe5, 0xdc, 0x41, 0x80, 0xfa, 0x50, 0xc6,
-  0x01, 0x0f, 0x28, 0x0d, 0x77, 0x78, 0x35, 0x77, 0x96, 0x49, 0x36, 0x37,
-  0x33, 0x95, 0x3b, 0x02, 0x00, 0x00, 0x07, 0xd7, 0x8e, 0x88, 0xaf, 0x19,
-  0xd2, 0x00, 0x0c, 0xa3, 0x8c, 0x03, 0x76, 0xe9, 0x0d, 0x77, 0xb8, 0x14,
-  0x11, 0x5f, 0x0e, 0xab, 0xe4, 0xb2, 0x98, 0x3d, 0x31, 0x9d, 0x3b, 0x02,
-  0x00, 0x00, 0x07, 0xd3, 0x5f, 0x0d, 0x77, 0x35, 0x77, 0x10, 0xa0, 0x9e,
-  0x94, 0x71, 0xc0, 0x43, 0x15, 0x45, 0xb1, 0x5c, 0x14, 0xc5, 0x42, 0x38,
-  0x4b, 0x0e, 0x00, 0x00, 0x1e, 0xc7, 0x6a, 0x38, 0x60, 0x4f, 0x94, 0x71,
-  0xc0, 0x63, 0x95, 0xce, 0x92, 0x33, 0x71, 0x15, 0x00, 0xe0, 0x08, 0x74,
-  0x0c, 0x70, 0x18, 0x37, 0xaf, 0x86, 0xd5, 0x70, 0xc0, 0x1e, 0x29, 0xe3,
-  0x80, 0x3d, 0x29, 0x8a, 0xe2, 0x7a, 0x6f, 0xe2, 0xea, 0xef, 0x44, 0xf7,
-  0x5d, 0x3f, 0x00, 0x00, 0x0e, 0xc8, 0x00, 0x87, 0xb1, 0x71, 0x23, 0x7a,
-  0x93, 0x52, 0xad, 0x86, 0x03, 0xf6, 0x4a, 0x19, 0x07, 0xec, 0x4b, 0x51,
-  0x14, 0xaf, 0x44, 0x77, 0xc0, 0xc3, 0x9b, 0xb9, 0xb3, 0x00, 0x00, 0x40,
-  0x26, 0xed, 0x88, 0xf8, 0xbd, 0xa2, 0x28, 0x16, 0x4d, 0x4a, 0x05, 0xf6,
-  0x4b, 0x19, 0x07, 0xec, 0x5b, 0x51, 0x14, 0x2b, 0x45, 0x51, 0x5c, 0x08,
-  0x03, 0x1e, 0x00, 0x00, 0x98, 0x3c, 0x6f, 0x46, 0xc4, 0x62, 0xef, 0x28,
-  0x17, 0x80, 0x7d, 0x53, 0xc6, 0x01, 0x07, 0x36, 0x30, 0xe0, 0xc1, 0xd6,
-  0x55, 0x00, 0x00, 0xc6, 0xd9, 0xcd, 0xe8, 0x6e, 0x49, 0xbd, 0x50, 0x14,
-  0xc5, 0x4a, 0xee, 0x30, 0x40, 0x73, 0x29, 0xe3, 0x80, 0x43, 0xeb, 0xbd,
-  0x2b, 0xb8, 0x18, 0x11, 0xaf, 0x67, 0x8e, 0x02, 0x00, 0xd0, 0x08, 0x06,
-  0x38, 0x34, 0x4a, 0x7f, 0x4b, 0xea, 0x82, 0x2d, 0xa9, 0xc0, 0x51, 0x50,
-  0xc6, 0x01, 0x47, 0xa2, 0xb7, 0x75, 0xf5, 0x62, 0x74, 0xb7, 0xae, 0x5e,
-  0xcb, 0x1c, 0x07, 0x00, 0xa0, 0xd6, 0x0c, 0x70, 0x68, 0x8c, 0xd7, 0xa3,
-  0x3b, 0x25, 0xf5, 0x72, 0xee, 0x20, 0xc0, 0xf8, 0x50, 0xc6, 0x01, 0x47,
-  0xaa, 0xb7, 0x75, 0x75, 0x29, 0x22, 0x5e, 0x0e, 0xe7, 0xc9, 0x01, 0x00,
-  0xd0, 0x4c, 0xd7, 0x22, 0xe2, 0x0b, 0x45, 0x51, 0x5c, 0x34, 0x25, 0x15,
-  0x38, 0x6a, 0xca, 0x38, 0x60, 0x24, 0x8a, 0xa2, 0xb8, 0xe2, 0x3c, 0x39,
-  0x00, 0x00, 0x1a, 0xa6, 0x7f, 0x2e, 0xdc, 0x52, 0x51, 0x14, 0xd7, 0x73,
-  0x87, 0x01, 0xc6, 0x93, 0x32, 0x0e, 0x18, 0xa9, 0xde, 0x92, 0xfe, 0x85,
-  0x88, 0x78, 0x35, 0x6f, 0x12, 0x00, 0x00, 0x78, 0xa8, 0x9b, 0x11, 0xf1,
-  0xb2, 0x73, 0xe1, 0x80, 0x2a, 0x28, 0xe3, 0x80, 0x91, 0x2b, 0x8a, 0xe2,
-  0x4e, 0x51, 0x14, 0x97, 0x22, 0xe2, 0xe9, 0x30, 0xe4, 0x01, 0x00, 0x80,
-  0xfa, 0x28, 0x0f, 0x67, 0xb8, 0x92, 0x3b, 0x0c, 0x30, 0x19, 0x94, 0x71,
-  0x40, 0x65, 0x4a, 0x43, 0x1e, 0x9e, 0x8e, 0x88, 0x37, 0x33, 0xc7, 0x01,
-  0x00, 0xc8, 0x62, 0xf5, 0xf6, 0x46, 0xee, 0x08, 0xf4, 0x4a, 0xb8, 0x30,
-  0x9c, 0x01, 0xc8, 0x40, 0x19, 0x07, 0x54, 0xae, 0x57, 0xca, 0x5d, 0x08,
-  0x93, 0x57, 0x01, 0x00, 0xa8, 0xd6, 0x03, 0x25, 0x9c, 0xe1, 0x0c, 0x40,
-  0x0e, 0xca, 0x38, 0x20, 0x9b, 0xd2, 0xe4, 0x55, 0xa5, 0x1c, 0x00, 0x00,
-  0xa3, 0xa6, 0x84, 0x03, 0x6a, 0x41, 0x19, 0x07, 0x64, 0xa7, 0x94, 0x03,
-  0x00, 0x60, 0x44, 0xda, 0xd1, 0x3d, 0xb3, 0xf8, 0x69, 0x25, 0x1c, 0x50,
-  0x17, 0xca, 0x38, 0xa0, 0x36, 0x94, 0x72, 0x00, 0x00, 0x1c, 0x91, 0xf2,
-  0x76, 0xd4, 0x3a, 0x4b, 0x29, 0x25, 0x00, 0x00, 0x13, 0x71, 0x49, 0x44,
-  0x41, 0x54, 0x8b, 0x45, 0x51, 0xac, 0x64, 0xce, 0x03, 0x70, 0x8f, 0x32,
-  0x0e, 0xa8, 0x9d, 0x52, 0x29, 0xf7, 0x85, 0x30, 0x7d, 0x15, 0x00, 0x18,
-  0x33, 0xb7, 0x0c, 0x70, 0x18, 0x25, 0x67, 0xc2, 0x01, 0xb5, 0xa7, 0x8c,
-  0x03, 0x6a, 0xab, 0x28, 0x8a, 0xeb, 0xa5, 0xe9, 0xab, 0x4a, 0x39, 0x00,
-  0x00, 0x1e, 0xe6, 0x66, 0x28, 0xe1, 0x80, 0x86, 0x50, 0xc6, 0x01, 0xb5,
-  0xd7, 0x9b, 0xbe, 0x7a, 0x31, 0xba, 0xa5, 0xdc, 0xab, 0xd1, 0x7d, 0xc7,
-  0x13, 0x00, 0x00, 0x6e, 0x46, 0xc4, 0xcb, 0x45, 0x51, 0x28, 0xe1, 0x80,
-  0xc6, 0x50, 0xc6, 0x01, 0x8d, 0xd1, 0x2b, 0xe5, 0x2e, 0x45, 0xc4, 0x42,
-  0x74, 0xdf, 0xf9, 0xbc, 0x99, 0x37, 0x11, 0x00, 0x00, 0x99, 0x5c, 0x8b,
-  0xfb, 0x25, 0xdc, 0x95, 0xdc, 0x61, 0x00, 0xf6, 0x43, 0x19, 0x07, 0x34,
-  0x4e, 0x51, 0x14, 0x77, 0x7a, 0xef, 0x7c, 0x2e, 0x44, 0xc4, 0xcb, 0xa1,
-  0x94, 0x03, 0x00, 0x98, 0x14, 0xaf, 0x47, 0xc4, 0x97, 0x8b, 0xa2, 0x58,
-  0x52, 0xc2, 0x01, 0x4d, 0xa5, 0x8c, 0x03, 0x1a, 0xad, 0x28, 0x8a, 0x2b,
-  0xbd, 0x52, 0xee, 0xcb, 0x11, 0xf1, 0x66, 0xe6, 0x38, 0x00, 0x00, 0x8f,
-  0xb5, 0xb6, 0xde, 0xc9, 0x1d, 0xa1, 0x69, 0xda, 0xd1, 0x3d, 0xaa, 0xe4,
-  0xe9, 0xde, 0x64, 0xd4, 0xe5, 0xcc, 0x79, 0x00, 0x0e, 0x45, 0x19, 0x07,
-  0x8c, 0x85, 0xde, 0x04, 0xd6, 0x0b, 0xe1, 0x5c, 0x39, 0x00, 0xa0, 0xe6,
-  0x3a, 0x5b, 0x3b, 0xb9, 0x23, 0x34, 0xc5, 0xcd, 0xe8, 0xee, 0x82, 0x58,
-  0x28, 0x8a, 0xe2, 0x52, 0x51, 0x14, 0x2b, 0x99, 0xf3, 0x00, 0x1c, 0x09,
-  0x65, 0x1c, 0x30, 0x56, 0x06, 0xce, 0x95, 0xb3, 0x85, 0x15, 0x00, 0xa0,
-  0x79, 0xde, 0x8c, 0xee, 0x56, 0xd4, 0x85, 0xde, 0x2e, 0x08, 0x43, 0x19,
-  0x80, 0xb1, 0xa2, 0x8c, 0x03, 0xc6, 0x52, 0xef, 0x5c, 0x39, 0x5b, 0x58,
-  0x01, 0x00, 0x9a, 0xa1, 0xbc, 0x15, 0xf5, 0x82, 0xad, 0xa8, 0xc0, 0x38,
-  0x9b, 0xca, 0x1d, 0x00, 0x60, 0xd4, 0x7a, 0xbf, 0xcc, 0x2d, 0xa7, 0x94,
-  0x16, 0x22, 0xe2, 0x62, 0xef, 0xe3, 0x6c, 0xb6, 0x40, 0x00, 0x00, 0xf4,
-  0xdd, 0x88, 0x88, 0x57, 0x0c, 0x63, 0x00, 0x26, 0x89, 0x95, 0x71, 0xc0,
-  0xc4, 0xe8, 0x6d, 0x61, 0xed, 0x4f, 0x61, 0xfd, 0x5a, 0x58, 0x2d, 0x07,
-  0x00, 0x64, 0xb0, 0xd6, 0x9e, 0xf8, 0x01, 0x0e, 0xed, 0xe8, 0x4e, 0x45,
-  0xfd, 0x42, 0x51, 0x14, 0x8b, 0x8a, 0x38, 0x60, 0xd2, 0x58, 0x19, 0x07,
-  0x4c, 0xa4, 0xa2, 0x28, 0xae, 0x46, 0xc4, 0x55, 0xab, 0xe5, 0x00, 0x80,
-  0xaa, 0x75, 0xb6, 0x27, 0x76, 0x80, 0xc3, 0x8d, 0x88, 0x78, 0x25, 0x22,
-  0xae, 0x3a, 0x07, 0x0e, 0x98, 0x64, 0x56, 0xc6, 0x01, 0x13, 0xcd, 0x6a,
-  0x39, 0x00, 0x80, 0x91, 0x2a, 0x9f, 0x05, 0xb7, 0x68, 0x20, 0x03, 0x80,
-  0x32, 0x0e, 0xe0, 0x9e, 0xa2, 0x28, 0xae, 0x16, 0x45, 0x71, 0x21, 0x22,
-  0x3e, 0x15, 0x11, 0xbf, 0x13, 0x26, 0xb1, 0x02, 0x00, 0x1c, 0xd4, 0x9b,
-  0x11, 0xf1, 0x72, 0x51, 0x14, 0x27, 0x8b, 0xa2, 0xb8, 0x54, 0x14, 0xc5,
-  0x4a, 0xee, 0x40, 0x00, 0x75, 0xa1, 0x8c, 0x03, 0x18, 0xd0, 0x9b, 0xc4,
-  0xfa, 0x4a, 0x6f, 0xb5, 0xdc, 0x17, 0xa2, 0x7b, 0xa6, 0x49, 0x3b, 0x6f,
-  0x2a, 0x00, 0x80, 0xda, 0xbb, 0x19, 0xdd, 0x37, 0x34, 0xfb, 0x13, 0x51,
-  0xaf, 0x64, 0xce, 0x03, 0x50, 0x4b, 0xce, 0x8c, 0x03, 0x78, 0x84, 0xa2,
-  0x28, 0xae, 0x47, 0xf7, 0x3c, 0xb9, 0x48, 0x29, 0x5d, 0x8c, 0x88, 0x0b,
-  0x11, 0xf1, 0x62, 0xc6, 0x48, 0x00, 0x40, 0x83, 0x75, 0xb6, 0xc6, 0xee,
-  0xbc, 0xb8, 0x76, 0x44, 0x5c, 0x89, 0x88, 0x2b, 0xbd, 0xdf, 0x9b, 0x00,
-  0x78, 0x0c, 0x65, 0x1c, 0xc0, 0x1e, 0xf5, 0xde, 0xdd, 0xbd, 0x92, 0x52,
-  0x3a, 0x19, 0xf7, 0x87, 0x3e, 0x9c, 0xcb, 0x18, 0x09, 0x00, 0x68, 0x98,
-  0xb5, 0xf5, 0xb1, 0x99, 0xa4, 0xfa, 0x7a, 0x74, 0x07, 0x31, 0x5c, 0xcd,
-  0x1d, 0x04, 0xa0, 0x69, 0x6c, 0x53, 0x05, 0xd8, 0xa7, 0xd2, 0x36, 0xd6,
-  0xc5, 0x88, 0x78, 0x3a, 0x22, 0x7e, 0x2f, 0x9c, 0x2f, 0x07, 0x00, 0x8c,
-  0xbf, 0x37, 0x23, 0xe2, 0xe5, 0x88, 0xf8, 0x54, 0x51, 0x14, 0x17, 0x15,
-  0x71, 0x00, 0x07, 0xa3, 0x8c, 0x03, 0x38, 0x84, 0x81, 0x69, 0xac, 0x5f,
-  0x88, 0xee, 0xb4, 0x30, 0xc5, 0x1c, 0x00, 0x30, 0x2e, 0x6e, 0x44, 0xf7,
-  0x1c, 0xb8, 0x4f, 0xf5, 0xcf, 0x81, 0x33, 0x0d, 0x15, 0xe0, 0x70, 0x94,
-  0x71, 0x00, 0x47, 0xa4, 0x28, 0x8a, 0xeb, 0xbd, 0x69, 0x61, 0x0b, 0x71,
-  0xc8, 0x62, 0x6e, 0x0c, 0xcf, 0x93, 0x01, 0x00, 0x9a, 0xa3, 0x5f, 0xc0,
-  0x3d, 0x5d, 0x14, 0xc5, 0x62, 0x6f, 0x47, 0x80, 0x02, 0x0e, 0xe0, 0x88,
-  0xa4, 0xa2, 0x28, 0x72, 0x67, 0x00, 0x18, 0x6b, 0x29, 0xa5, 0xc5, 0xe8,
-  0x9e, 0x2f, 0x77, 0x21, 0x22, 0xce, 0xee, 0xf5, 0xdf, 0xb5, 0xa6, 0x8e,
-  0xc5, 0xb3, 0x4f, 0x3d, 0x11, 0xa7, 0x4f, 0xcd, 0xc4, 0xe9, 0x53, 0x33,
-  0x31, 0x77, 0x62, 0x7a, 0x54, 0x11, 0x01, 0x80, 0x8a, 0xac, 0xde, 0xde,
-  0x88, 0x37, 0xfe, 0xf4, 0xc7, 0xb9, 0x63, 0x0c, 0x73, 0x23, 0xba, 0x83,
-  0x18, 0xae, 0x16, 0x45, 0xb1, 0x92, 0x37, 0x0a, 0xc0, 0x78, 0x53, 0xc6,
-  0x01, 0x54, 0xe8, 0xa0, 0xc5, 0x5c, 0x44, 0xc4, 0xec, 0xcc, 0x54, 0x9c,
-  0x39, 0x35, 0x13, 0xcf, 0x3c, 0xf5, 0x4b, 0x71, 0xe6, 0xd4, 0x4c, 0xb4,
-  0xa6, 0x2d, 0x6e, 0x06, 0x80, 0xa6, 0x79, 0xeb, 0xbd, 0x9f, 0xc5, 0x9f,
-  0xbc, 0xf7, 0xb3, 0xdc, 0x31, 0xfa, 0x14, 0x70, 0x00, 0x19, 0x28, 0xe3,
-  0x00, 0x32, 0x39, 0x4c, 0x31, 0x17, 0x11, 0x31, 0x3f, 0xdb, 0xba, 0xb7,
-  0x6a, 0x4e, 0x39, 0x07, 0x00, 0xcd, 0x50, 0x83, 0x32, 0xee, 0xcd, 0x88,
-  0x58, 0x0e, 0x05, 0x1c, 0x40, 0x36, 0xca, 0x38, 0x80, 0x1a, 0x48, 0x29,
-  0xfd, 0x7a, 0x44, 0xfc, 0xcf, 0x11, 0xf1, 0x42, 0x44, 0xfc, 0xd2, 0x41,
-  0x9e, 0x43, 0x39, 0x07, 0x00, 0xf5, 0x97, 0xa9, 0x8c, 0x7b, 0x33, 0x22,
-  0xae, 0x46, 0xb7, 0x80, 0x73, 0xf6, 0x1b, 0x40, 0x66, 0xca, 0x38, 0x80,
-  0x9a, 0x49, 0x29, 0x2d, 0x44, 0xc4, 0xff, 0x12, 0x11, 0xbf, 0x11, 0x11,
-  0x7f, 0xe7, 0xa0, 0xcf, 0xa3, 0x9c, 0x03, 0x80, 0xfa, 0xa9, 0xa8, 0x8c,
-  0xbb, 0x19, 0xf7, 0x57, 0xbf, 0x5d, 0x1d, 0xf5, 0x37, 0x03, 0x60, 0x7f,
-  0x94, 0x71, 0x00, 0x35, 0x96, 0x52, 0x3a, 0x19, 0xdd, 0x52, 0xee, 0x7f,
-  0x8a, 0xee, 0xaa, 0xb9, 0x4f, 0x1c, 0xf4, 0xb9, 0x94, 0x73, 0x00, 0x90,
-  0xdf, 0x08, 0xcb, 0xb8, 0x1b, 0xd1, 0x2d, 0xe0, 0xae, 0x14, 0x45, 0x71,
-  0x7d, 0x14, 0xdf, 0x00, 0x80, 0xa3, 0xa1, 0x8c, 0x03, 0x68, 0x90, 0xd2,
-  0x39, 0x73, 0xff, 0x7d, 0x44, 0x9c, 0x3e, 0xcc, 0x73, 0xf5, 0xcb, 0xb9,
-  0xf9, 0xd9, 0x4f, 0x98, 0xd6, 0x0a, 0x00, 0x15, 0xf9, 0xce, 0x9f, 0xfd,
-  0x75, 0xfc, 0xe5, 0x87, 0x1f, 0x1d, 0xd5, 0xd3, 0xf5, 0xb7, 0x9f, 0x2e,
-  0x3b, 0xff, 0x0d, 0xa0, 0x39, 0x94, 0x71, 0x00, 0x0d, 0xd5, 0xdb, 0xce,
-  0xba, 0x14, 0x11, 0x7f, 0x3f, 0x22, 0x7e, 0x2d, 0x22, 0x66, 0x0e, 0xf3,
-  0x7c, 0xfd, 0x69, 0xad, 0xf3, 0x73, 0xfd, 0x92, 0xae, 0x75, 0xe8, 0x8c,
-  0x00, 0x40, 0x57, 0x67, 0x6b, 0x27, 0x6e, 0xdd, 0xde, 0x88, 0x7f, 0xf5,
-  0xef, 0x7e, 0x1a, 0xeb, 0x1b, 0xdb, 0x07, 0x7d, 0x9a, 0x9b, 0x71, 0xbf,
-  0x7c, 0xb3, 0xfd, 0x14, 0xa0, 0xa1, 0x94, 0x71, 0x00, 0x63, 0x22, 0xa5,
-  0xb4, 0x14, 0xdd, 0x72, 0xee, 0x7f, 0x88, 0x88, 0xff, 0xe6, 0xb0, 0xcf,
-  0xd7, 0x9a, 0x3a, 0x16, 0xa7, 0x3f, 0xd3, 0x2d, 0xe5, 0xce, 0xf4, 0xb6,
-  0xb7, 0x02, 0x00, 0x7b, 0xb3, 0xb6, 0xde, 0x89, 0xb5, 0x76, 0x27, 0x56,
-  0x6f, 0x6f, 0xc4, 0xad, 0xdb, 0x1b, 0x87, 0x29, 0xe0, 0x4c, 0x3f, 0x05,
-  0x18, 0x33, 0xca, 0x38, 0x80, 0x31, 0xd4, 0x3b, 0x6b, 0xee, 0x42, 0x74,
-  0xcb, 0xb9, 0xbf, 0x17, 0x11, 0x9f, 0x3d, 0x8a, 0xe7, 0x2d, 0x9f, 0x3b,
-  0x37, 0x3f, 0xfb, 0x09, 0x5b, 0x5b, 0x01, 0xa0, 0xa7, 0x5f, 0xba, 0xad,
-  0xde, 0xde, 0x88, 0xb5, 0x76, 0x27, 0x3a, 0xdb, 0x3b, 0x07, 0x7d, 0xaa,
-  0xfe, 0xd9, 0x6f, 0x57, 0x8b, 0xa2, 0x58, 0x3e, 0xaa, 0x7c, 0x00, 0xd4,
-  0x87, 0x32, 0x0e, 0x60, 0x02, 0xf4, 0xce, 0x9a, 0x5b, 0xea, 0x7d, 0x7c,
-  0x25, 0x22, 0x3e, 0x79, 0x14, 0xcf, 0x3b, 0x3b, 0x33, 0x15, 0xf3, 0x73,
-  0xdd, 0x95, 0x73, 0xfd, 0xa2, 0x0e, 0x00, 0xc6, 0x5d, 0x7f, 0xd5, 0xdb,
-  0xda, 0xfa, 0xc7, 0xdd, 0xf2, 0x6d, 0xbd, 0x73, 0x98, 0xa7, 0x6b, 0x47,
-  0x6f, 0xeb, 0x69, 0x74, 0x0b, 0xb8, 0x3b, 0x47, 0x91, 0x11, 0x80, 0xfa,
-  0x52, 0xc6, 0x01, 0x4c, 0xa0, 0xd2, 0x96, 0xd6, 0xa5, 0x88, 0x38, 0x7f,
-  0x94, 0xcf, 0xdd, 0x3f, 0x6f, 0xce, 0x60, 0x08, 0x00, 0xc6, 0x41, 0x67,
-  0x6b, 0x27, 0xd6, 0xd6, 0x3b, 0x47, 0xb5, 0xea, 0x2d, 0x22, 0x62, 0x27,
-  0x22, 0x7e, 0x1c, 0x11, 0x3f, 0x8c, 0x88, 0xdf, 0x2f, 0x8a, 0xe2, 0x87,
-  0x47, 0x12, 0x14, 0x80, 0xc6, 0x50, 0xc6, 0x01, 0xd0, 0x2f, 0xe7, 0xfa,
-  0xdb, 0x5a, 0xcf, 0x1d, 0xe5, 0x73, 0xb7, 0xa6, 0x8e, 0xdd, 0x1b, 0x0a,
-  0xd1, 0x5f, 0x41, 0xd7, 0x9a, 0x3e, 0x76, 0x94, 0xdf, 0x02, 0x00, 0x8e,
-  0x4c, 0x7f, 0xa5, 0xdb, 0x5a, 0xbb, 0x73, 0xd8, 0xb3, 0xde, 0xfa, 0xb6,
-  0x23, 0xe2, 0x56, 0x74, 0x57, 0xbe, 0x5d, 0x29, 0x8a, 0xe2, 0x5f, 0x1f,
-  0xf6, 0x09, 0x01, 0x68, 0x36, 0x65, 0x1c, 0x00, 0x0f, 0xe8, 0x9d, 0x37,
-  0xb7, 0x54, 0xfa, 0x38, 0xd2, 0x72, 0x2e, 0xe2, 0xfe, 0xf6, 0x56, 0xc3,
-  0x21, 0x00, 0xc8, 0xe9, 0x88, 0xb7, 0x9b, 0xf6, 0x6d, 0x45, 0xc4, 0x7f,
-  0x8c, 0x88, 0xef, 0x47, 0xc4, 0xff, 0x5e, 0x14, 0xc5, 0xf5, 0xa3, 0x78,
-  0x52, 0x00, 0xc6, 0x87, 0x32, 0x0e, 0x80, 0x47, 0xea, 0x95, 0x73, 0xe5,
-  0x33, 0xe7, 0x8e, 0x74, 0x5b, 0x6b, 0x5f, 0x7f, 0x6b, 0x6b, 0xbf, 0xa4,
-  0x53, 0xd0, 0x01, 0x70, 0x94, 0xca, 0xc5, 0xdb, 0xda, 0x7a, 0x77, 0xca,
-  0xe9, 0x11, 0xe9, 0x44, 0xc4, 0xbf, 0x8f, 0x88, 0x3f, 0x8e, 0x88, 0xff,
-  0x4b, 0xf9, 0x06, 0xc0, 0xe3, 0x28, 0xe3, 0x00, 0xd8, 0xb7, 0x81, 0x33,
-  0xe7, 0x16, 0x23, 0x62, 0x6e, 0x14, 0xdf, 0x67, 0xb0, 0xa0, 0xb3, 0xc5,
-  0x15, 0x80, 0xbd, 0x18, 0x61, 0xf1, 0x16, 0xd1, 0x1d, 0xb8, 0xf0, 0x6f,
-  0x22, 0xe2, 0xff, 0x89, 0x88, 0x65, 0xe5, 0x1b, 0x00, 0xfb, 0xa5, 0x8c,
-  0x03, 0xe0, 0xd0, 0x4a, 0xd3, 0x5a, 0xfb, 0x7f, 0x9e, 0x1d, 0xd5, 0xf7,
-  0x1a, 0xdc, 0xe2, 0xaa, 0xa0, 0x03, 0x98, 0x6c, 0xe5, 0x33, 0xde, 0xda,
-  0x1b, 0xdb, 0x47, 0x5d, 0xbc, 0x45, 0x44, 0xac, 0x44, 0xc4, 0x0f, 0x22,
-  0xe2, 0xff, 0x8e, 0x88, 0xeb, 0x45, 0x51, 0xac, 0x1c, 0xf5, 0x37, 0x00,
-  0x60, 0xb2, 0x28, 0xe3, 0x00, 0x38, 0x72, 0x29, 0xa5, 0x85, 0xb8, 0x5f,
-  0xcc, 0x2d, 0xc6, 0x88, 0xb6, 0xb6, 0xf6, 0x95, 0x87, 0x44, 0xcc, 0xcf,
-  0xb6, 0x62, 0xee, 0xc4, 0x54, 0xcc, 0xcf, 0xb6, 0x46, 0xf9, 0x2d, 0x01,
-  0xa8, 0x58, 0xfb, 0xee, 0x56, 0xac, 0x6f, 0x6c, 0xc7, 0xad, 0x5e, 0xf9,
-  0xb6, 0x7e, 0x77, 0xfb, 0xa8, 0xce, 0x78, 0x2b, 0xdb, 0x88, 0x88, 0x7f,
-  0x1b, 0x11, 0xd7, 0xa2, 0xbb, 0xea, 0x6d, 0xf9, 0xa8, 0xbf, 0x01, 0x00,
-  0x28, 0xe3, 0x00, 0xa8, 0x44, 0x6f, 0x6b, 0x6b, 0xb9, 0xa0, 0x1b, 0xd9,
-  0xea, 0xb9, 0xbe, 0xd3, 0xa7, 0x66, 0x62, 0xae, 0xb4, 0x92, 0xce, 0x2a,
-  0x3a, 0x80, 0x66, 0x58, 0xbd, 0xbd, 0x11, 0xed, 0xbb, 0x5b, 0xf7, 0xb6,
-  0x99, 0xae, 0xb5, 0x3b, 0xd1, 0xd9, 0xde, 0x19, 0xc5, 0xb7, 0x7a, 0x2f,
-  0x22, 0xbe, 0x17, 0x11, 0xd7, 0xa3, 0x5b, 0xbe, 0xad, 0x8c, 0xe2, 0x9b,
-  0x00, 0x40, 0x99, 0x32, 0x0e, 0x80, 0x2c, 0x4a, 0x53, 0x5b, 0xcb, 0x05,
-  0xdd, 0x48, 0xce, 0x9e, 0x2b, 0x2b, 0xaf, 0xa2, 0x9b, 0x9b, 0x99, 0x8a,
-  0xb9, 0x13, 0xd3, 0x86, 0x45, 0x00, 0x64, 0xb2, 0xb6, 0xde, 0x89, 0x76,
-  0x6f, 0x85, 0xdb, 0x08, 0x57, 0xbb, 0xf5, 0xfd, 0x24, 0xba, 0xe7, 0xbc,
-  0x5d, 0x8f, 0xee, 0x76, 0xd3, 0xe5, 0x51, 0x7d, 0x23, 0x00, 0x78, 0x14,
-  0x65, 0x1c, 0x00, 0xb5, 0x51, 0xda, 0xde, 0xda, 0x2f, 0xe8, 0x46, 0xba,
-  0xbd, 0xb5, 0x6c, 0x76, 0x60, 0x05, 0x9d, 0xad, 0xae, 0x00, 0x47, 0xa7,
-  0xbc, 0xc5, 0x74, 0xfd, 0xee, 0xd6, 0xa8, 0xce, 0x76, 0x2b, 0xfb, 0xeb,
-  0x88, 0xf8, 0xff, 0xa2, 0xb7, 0xe2, 0x2d, 0xba, 0xe5, 0xdb, 0x9d, 0x51,
-  0x7e, 0x43, 0x00, 0xd8, 0x2b, 0x65, 0x1c, 0x00, 0xb5, 0xd6, 0x1b, 0x0e,
-  0x31, 0xf8, 0x31, 0xf2, 0x15, 0x74, 0x7d, 0xf3, 0xb3, 0xad, 0x98, 0xed,
-  0x15, 0x73, 0x56, 0xd2, 0x01, 0x3c, 0xda, 0xda, 0x7a, 0x27, 0x3a, 0x5b,
-  0x3b, 0x55, 0x96, 0x6e, 0x11, 0x11, 0x3f, 0x8e, 0x88, 0x3f, 0x0b, 0xc5,
-  0x1b, 0x00, 0x0d, 0xa1, 0x8c, 0x03, 0xa0, 0x71, 0x86, 0xac, 0xa0, 0xab,
-  0xb4, 0xa0, 0x8b, 0xe8, 0xae, 0xa4, 0xeb, 0x17, 0x73, 0xc7, 0xa7, 0x8f,
-  0x39, 0x93, 0x0e, 0x98, 0x28, 0xfd, 0x33, 0xdd, 0xda, 0x1b, 0xdb, 0x55,
-  0x6c, 0x2f, 0x2d, 0x7b, 0x37, 0x22, 0xfe, 0x43, 0x28, 0xde, 0x00, 0x68,
-  0x30, 0x65, 0x1c, 0x00, 0x63, 0xa1, 0x77, 0x06, 0x5d, 0xbf, 0x9c, 0x5b,
-  0xe8, 0xfd, 0xfd, 0x5c, 0x8e, 0x2c, 0xfd, 0xf3, 0xe8, 0x66, 0x4f, 0x4c,
-  0xc7, 0xfc, 0x6c, 0x2b, 0x8e, 0x4f, 0x1f, 0xb3, 0x9a, 0x0e, 0x68, 0x9c,
-  0xf2, 0x2a, 0xb7, 0xce, 0xd6, 0xce, 0xa8, 0x07, 0x29, 0x0c, 0x73, 0x2d,
-  0xba, 0xa5, 0xdb, 0x4a, 0x38, 0xe3, 0x0d, 0x80, 0x31, 0xa2, 0x8c, 0x03,
-  0x60, 0xac, 0x95, 0xb6, 0xb9, 0x2e, 0x44, 0xa6, 0x55, 0x74, 0x7d, 0xfd,
-  0xd5, 0x74, 0xfd, 0x15, 0x74, 0x67, 0x4e, 0xcd, 0x44, 0xab, 0xb7, 0xaa,
-  0x0e, 0x20, 0x87, 0xfe, 0x59, 0x6e, 0x6b, 0xeb, 0x9d, 0xd8, 0xdc, 0xda,
-  0x89, 0xd5, 0x52, 0xf1, 0x56, 0xa1, 0x1b, 0xd1, 0x2b, 0xdc, 0xe2, 0xfe,
-  0x70, 0x85, 0x95, 0x2a, 0x03, 0x00, 0x40, 0x95, 0x94, 0x71, 0x00, 0x4c,
-  0x9c, 0xd2, 0x2a, 0xba, 0x7e, 0x49, 0x57, 0xf9, 0x59, 0x74, 0x83, 0xfa,
-  0x53, 0x5e, 0x07, 0x57, 0xd4, 0xd9, 0xfa, 0x0a, 0x1c, 0x56, 0xff, 0xcc,
-  0xb6, 0xf2, 0x0a, 0xb7, 0x7e, 0x09, 0x57, 0xb1, 0x9b, 0xd1, 0x2d, 0xdd,
-  0x96, 0x7b, 0x7f, 0xae, 0x58, 0xed, 0x06, 0xc0, 0x24, 0x52, 0xc6, 0x01,
-  0x40, 0x4f, 0x1d, 0x4b, 0xba, 0xbe, 0xfe, 0x36, 0xd7, 0xfe, 0x9f, 0x56,
-  0xd5, 0x01, 0x7d, 0x83, 0xab, 0xdb, 0xfa, 0xdb, 0x4b, 0x2b, 0xde, 0x52,
-  0x5a, 0xa6, 0x74, 0x03, 0x80, 0x47, 0x50, 0xc6, 0x01, 0xc0, 0x63, 0x94,
-  0x4a, 0xba, 0x85, 0xb8, 0xbf, 0xdd, 0x75, 0x21, 0x22, 0xce, 0xe6, 0xca,
-  0x54, 0xd6, 0x5f, 0x55, 0x17, 0xf1, 0x60, 0x59, 0x57, 0x7e, 0x0c, 0x34,
-  0xd7, 0xbd, 0x72, 0x6d, 0xa0, 0x6c, 0xcb, 0xb4, 0xba, 0xad, 0xec, 0x5a,
-  0x44, 0xdc, 0x89, 0xfb, 0xdb, 0x4b, 0x57, 0x8a, 0xa2, 0xb8, 0x9e, 0x33,
-  0x10, 0x00, 0x34, 0x81, 0x32, 0x0e, 0x00, 0x0e, 0xa1, 0x77, 0x26, 0xdd,
-  0xc9, 0xb8, 0x5f, 0xd0, 0x2d, 0x44, 0x4d, 0x56, 0xd3, 0x95, 0xf5, 0xb7,
-  0xbb, 0xf6, 0xb7, 0xc1, 0x1e, 0x2f, 0xad, 0xaa, 0x53, 0xd8, 0x41, 0x3e,
-  0xe5, 0x62, 0xad, 0xbd, 0xb1, 0xfd, 0xc0, 0x79, 0x6d, 0xfd, 0xed, 0xa5,
-  0x99, 0x95, 0x57, 0xb9, 0xf5, 0x8b, 0xb7, 0x15, 0x67, 0xba, 0x01, 0xc0,
-  0xc1, 0x29, 0xe3, 0x00, 0x60, 0x44, 0x52, 0x4a, 0x4b, 0xd1, 0x2d, 0xea,
-  0xca, 0xab, 0xea, 0x6a, 0x57, 0xd4, 0xf5, 0x0d, 0x16, 0x76, 0x11, 0xf7,
-  0x57, 0xd8, 0xf5, 0x87, 0x4f, 0x00, 0x7b, 0x53, 0x2e, 0xd5, 0xfa, 0x2b,
-  0xda, 0x6a, 0x58, 0xb4, 0xf5, 0xdd, 0x88, 0xfb, 0x45, 0xdb, 0x9d, 0xe8,
-  0x15, 0x6f, 0x56, 0xb9, 0x01, 0xc0, 0x68, 0x28, 0xe3, 0x00, 0x20, 0x83,
-  0x81, 0x15, 0x75, 0xfd, 0xc2, 0xee, 0x64, 0x44, 0x9c, 0xcb, 0x18, 0x6b,
-  0x4f, 0xfa, 0x2b, 0xe9, 0xca, 0xa5, 0x5d, 0x7f, 0xe0, 0x44, 0xf9, 0xf3,
-  0x30, 0x8e, 0xfa, 0x2b, 0xd9, 0x22, 0xba, 0x03, 0x11, 0x22, 0x22, 0xd6,
-  0x7b, 0xab, 0xda, 0x22, 0x22, 0xe7, 0x39, 0x6d, 0x8f, 0x53, 0xde, 0x52,
-  0x6a, 0x85, 0x1b, 0x00, 0x64, 0xa4, 0x8c, 0x03, 0x80, 0x9a, 0x29, 0x9d,
-  0x51, 0x37, 0xec, 0xcf, 0xda, 0x97, 0x75, 0x65, 0xfd, 0x62, 0x6e, 0x70,
-  0xd8, 0xc4, 0x99, 0x52, 0x61, 0xa7, 0xbc, 0x23, 0xa7, 0x72, 0xb9, 0xd6,
-  0x5f, 0xc1, 0xb6, 0xeb, 0x7a, 0x7d, 0x0b, 0xb6, 0xb2, 0x6b, 0xbd, 0x3f,
-  0x97, 0xcb, 0x7f, 0x1a, 0x9c, 0x00, 0x00, 0xf5, 0xa3, 0x8c, 0x03, 0x80,
-  0x86, 0x19, 0x52, 0xd6, 0x45, 0x74, 0x57, 0xd8, 0x45, 0xd4, 0x78, 0x1b,
-  0xec, 0x5e, 0xf4, 0xb7, 0xca, 0x46, 0xec, 0x2e, 0xf0, 0xca, 0xab, 0xef,
-  0x06, 0xbf, 0x16, 0xca, 0xdb, 0x3e, 0x37, 0x4b, 0xdb, 0x41, 0x23, 0x1e,
-  0x5c, 0xb9, 0x36, 0xf8, 0xb5, 0x0d, 0xf1, 0xd7, 0x11, 0xf1, 0x5e, 0xec,
-  0x5e, 0xd9, 0xa6, 0x6c, 0x03, 0x80, 0x06, 0x52, 0xc6, 0x01, 0xc0, 0x18,
-  0x4a, 0x29, 0x2d, 0x44, 0xf7, 0x8c, 0xba, 0x61, 0x85, 0xdd, 0x42, 0xd4,
-  0x64, 0x12, 0xec, 0x51, 0x1a, 0x2c, 0xe7, 0xca, 0xdb, 0x68, 0xcb, 0x5f,
-  0x73, 0x7c, 0xa0, 0xc0, 0x53, 0xea, 0xe5, 0x35, 0xac, 0x18, 0xbb, 0x35,
-  0x70, 0xad, 0x33, 0x50, 0xae, 0x3d, 0xec, 0xdf, 0x35, 0xd4, 0x7b, 0xd1,
-  0x2d, 0xdb, 0xee, 0x15, 0x6c, 0x71, 0x7f, 0x75, 0xdb, 0xf5, 0xa2, 0x28,
-  0xee, 0xe4, 0x08, 0x05, 0x00, 0x8c, 0x8e, 0x32, 0x0e, 0x00, 0x26, 0x54,
-  0x69, 0x85, 0x5d, 0xc4, 0xfd, 0x95, 0x76, 0xe5, 0x6b, 0x0b, 0x31, 0x86,
-  0xa5, 0xdd, 0x5e, 0x3d, 0x6c, 0xfb, 0xec, 0xe0, 0x8a, 0xbd, 0x61, 0xce,
-  0xec, 0x73, 0xeb, 0x6d, 0xae, 0x42, 0x70, 0xbf, 0x85, 0x56, 0x79, 0x1b,
-  0xe7, 0x30, 0x83, 0x2b, 0xd0, 0x1e, 0xf8, 0xb7, 0xcd, 0xd8, 0xea, 0x79,
-  0x94, 0xfe, 0x43, 0x44, 0x7c, 0x18, 0x11, 0xff, 0x29, 0xee, 0x97, 0x6c,
-  0xfd, 0x55, 0x6d, 0x86, 0x23, 0x00, 0xc0, 0x04, 0x53, 0xc6, 0x01, 0x00,
-  0x8f, 0x55, 0x1a, 0x38, 0x11, 0x71, 0x7f, 0x85, 0x5d, 0xb9, 0xb8, 0x6b,
-  0xdc, 0x79, 0x76, 0x70, 0x00, 0x37, 0x22, 0x62, 0x33, 0xba, 0x25, 0x5b,
-  0xbf, 0x4c, 0x2b, 0xaf, 0x68, 0x33, 0x10, 0x01, 0x00, 0x78, 0x2c, 0x65,
-  0x1c, 0x00, 0x70, 0xa4, 0x06, 0x56, 0xdc, 0x45, 0xdc, 0x2f, 0xef, 0x22,
-  0xee, 0xaf, 0xc0, 0x8b, 0x50, 0xe0, 0x91, 0xd7, 0x8d, 0xde, 0x9f, 0x9b,
-  0x11, 0xf1, 0x6f, 0xa2, 0x5b, 0xaa, 0x45, 0x3c, 0x58, 0xae, 0x59, 0xc1,
-  0x06, 0x00, 0x1c, 0x39, 0x65, 0x1c, 0x00, 0x50, 0x0b, 0xa5, 0x73, 0xee,
-  0xfa, 0xca, 0xc5, 0xdd, 0xe0, 0xe3, 0xa9, 0x88, 0x78, 0x26, 0x22, 0x9e,
-  0xac, 0x20, 0x1a, 0xf5, 0xb4, 0x1a, 0x11, 0x3f, 0x2b, 0x3d, 0xfe, 0xcb,
-  0x88, 0x78, 0xb7, 0xf4, 0x78, 0xa5, 0xf7, 0xd1, 0xe7, 0xfc, 0x35, 0x00,
-  0xa0, 0x16, 0x94, 0x71, 0x00, 0xc0, 0xd8, 0x18, 0xd8, 0x4e, 0xdb, 0x37,
-  0xec, 0xda, 0xe0, 0x16, 0xdb, 0x32, 0xab, 0xf5, 0x8e, 0x56, 0x3b, 0xba,
-  0xab, 0xcd, 0x36, 0x7b, 0x1f, 0x65, 0xd7, 0xa3, 0xbb, 0xe5, 0xb3, 0x7c,
-  0x7d, 0x25, 0x1e, 0x2c, 0xd1, 0x22, 0x6c, 0xff, 0x04, 0x00, 0xc6, 0x88,
-  0x32, 0x0e, 0x00, 0x60, 0x8f, 0x86, 0xac, 0xde, 0x7b, 0x98, 0xa5, 0x7d,
-  0x3e, 0xf5, 0xc3, 0x9e, 0xf3, 0xa9, 0xde, 0xc7, 0x7e, 0xfd, 0x4d, 0x74,
-  0x57, 0x8a, 0x3d, 0xce, 0x60, 0x11, 0x36, 0x68, 0x25, 0x76, 0x17, 0x63,
-  0xc3, 0x58, 0x75, 0x06, 0x00, 0xb0, 0x47, 0xca, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0xa8, 0xc8, 0xb1, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x52,
-  0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00,
-  0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2,
-  0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00,
-  0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8,
-  0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00,
-  0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22,
-  0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c,
-  0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e,
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80,
-  0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00,
-  0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a,
-  0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88,
-  0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00,
-  0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03,
-  0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0,
-  0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00,
-  0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a,
-  0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00,
-  0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2,
-  0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00,
-  0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8,
-  0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00,
-  0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22,
-  0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c,
-  0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e,
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80,
-  0x8a, 0x28, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00,
-  0x00, 0x00, 0x00, 0xa8, 0x88, 0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a,
-  0xa2, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x80, 0x8a, 0x28, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0xa0, 0x22, 0xca, 0x38, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x88,
-  0x32, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x8c, 0x03, 0x80, 0xff,
-  0xd2, 0x8e, 0x1d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0xb7, 0x9e,
-  0xc5, 0xae, 0xc2, 0x08, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x22, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x22,
-  0xe3, 0x00, 0x00, 0x00, 0x00, 0x60, 0x12, 0xb8, 0x9c, 0x7e, 0xa5, 0x3c,
-  0x51, 0x27, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
-  0x42, 0x60, 0x82
-};
-unsigned int Mole_png_len = 29667;
-
-#endif // Mole_HPP
\ No newline at end of file
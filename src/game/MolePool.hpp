@@ -0,0 +1,80 @@
+/*
+ * Filename: MolePool.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing a fixed pool of mole records addressed by generation-tagged handles.
+ */
+
+#if !defined(MOLEPOOL_HPP)
+#define MOLEPOOL_HPP
+
+#include <vector>
+#include <cstdint>
+
+// Struct for a handle to a mole: the slot of its record in the pool and the generation of the slot when the mole was created. The default handle refers to no mole.
+typedef struct {
+	uint32_t slot, generation;
+} MoleHandle;
+
+// Struct for the record of a mole: the index of the location it is at. The times of the mole are kept by the board with its location.
+typedef struct {
+	int cell;
+} MoleRecord;
+
+// The MolePool class keeps all mole records in one block allocated up front, with a stack of free slots, so that creating and destroying moles never allocates. Every slot has a generation that moves on when a mole is created in it and again when it is destroyed, so a handle kept after its mole is gone (e.g. in the deadline queue) is detected as stale even if the slot has been reused.
+class MolePool {
+public:
+	// Constructor accepting the maximum number of moles alive at once
+	MolePool(size_t capacity = 0) : records(capacity), generations(capacity, 0) {
+		free_slots.reserve(capacity);
+		for (size_t i = capacity; i > 0; i--)
+			free_slots.push_back((uint32_t)(i - 1));
+	}
+
+	// Function to create a mole record. Returns the handle of the mole, or a handle to no mole if the pool is exhausted.
+	MoleHandle create(const MoleRecord &record) {
+		if (free_slots.empty())
+			return MoleHandle{0, 0};
+		uint32_t slot = free_slots.back();
+		free_slots.pop_back();
+		// The generation of a slot is odd while a mole lives in it
+		generations[slot]++;
+		records[slot] = record;
+		return MoleHandle{slot, generations[slot]};
+	}
+
+	// Function to destroy a mole, making all handles to it stale. Does nothing for a stale handle.
+	void destroy(MoleHandle h) {
+		if (!is_alive(h))
+			return;
+		generations[h.slot]++;
+		free_slots.push_back(h.slot);
+	}
+
+	// Function to check whether a handle refers to a mole that is still alive
+	bool is_alive(MoleHandle h) const {
+		return h.slot < generations.size() && h.generation % 2 == 1 && generations[h.slot] == h.generation;
+	}
+
+	// Function to get the record of a live mole
+	const MoleRecord& get(MoleHandle h) const {
+		return records[h.slot];
+	}
+
+	// Function to get the number of live moles
+	size_t size() const {
+		return records.size() - free_slots.size();
+	}
+
+	// Function to get the maximum number of live moles
+	size_t capacity() const {
+		return records.size();
+	}
+
+private:
+	std::vector<MoleRecord> records;
+	std::vector<uint32_t> generations;
+	std::vector<uint32_t> free_slots;
+};
+
+#endif // MOLEPOOL_HPP
\ No newline at end of file
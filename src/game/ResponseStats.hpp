@@ -0,0 +1,175 @@
+/*
+ * Filename: ResponseStats.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Classes for streaming statistics of the response times, in constant time and memory per sample.
+ */
+
+#if !defined(RESPONSESTATS_HPP)
+#define RESPONSESTATS_HPP
+
+#include <cmath>
+#include <algorithm>
+
+// The P2Quantile class estimates a single quantile of a stream with the P-square algorithm (Jain and Chlamtac), keeping only five markers whose heights are adjusted with a piecewise-parabolic fit as samples arrive.
+class P2Quantile {
+public:
+	// Constructor accepting the quantile to estimate, from (0, 1)
+	P2Quantile(double p = 0.5) : p(p) {
+		reset();
+	}
+
+	// Function to clear all samples
+	void reset() {
+		count = 0;
+		for (int i = 0; i < 5; i++)
+			positions[i] = i;
+		desired[0] = 0; desired[1] = 2 * p; desired[2] = 4 * p; desired[3] = 2 + 2 * p; desired[4] = 4;
+		increments[0] = 0; increments[1] = p / 2; increments[2] = p; increments[3] = (1 + p) / 2; increments[4] = 1;
+	}
+
+	// Function to add a sample
+	void add(double x) {
+		// Collect the first five samples as the initial marker heights, inserting each in order so that the heights are always sorted
+		if (count < 5) {
+			int i = (int)count++;
+			for (; i > 0 && heights[i - 1] > x; i--)
+				heights[i] = heights[i - 1];
+			heights[i] = x;
+			return;
+		}
+		count++;
+
+		// Find the cell the sample falls in, extending the extreme markers if needed
+		int k;
+		if (x < heights[0]) {
+			heights[0] = x;
+			k = 0;
+		} else if (x >= heights[4]) {
+			heights[4] = x;
+			k = 3;
+		} else {
+			k = 0;
+			while (x >= heights[k + 1])
+				k++;
+		}
+
+		// Move the positions of the markers above the cell and the desired positions of all markers
+		for (int i = k + 1; i < 5; i++)
+			positions[i]++;
+		for (int i = 0; i < 5; i++)
+			desired[i] += increments[i];
+
+		// Adjust the heights of the middle markers that are off their desired positions by one or more
+		for (int i = 1; i < 4; i++) {
+			double d = desired[i] - positions[i];
+			if ((d >= 1 && positions[i + 1] - positions[i] > 1) || (d <= -1 && positions[i - 1] - positions[i] < -1)) {
+				int s = (d > 0) ? 1 : -1;
+				double h = parabolic(i, s);
+				if (heights[i - 1] < h && h < heights[i + 1])
+					heights[i] = h;
+				else
+					heights[i] = heights[i] + s * (heights[i + s] - heights[i]) / (positions[i + s] - positions[i]);
+				positions[i] += s;
+			}
+		}
+	}
+
+	// Function to get the estimate of the quantile (0 if there are no samples). Exact while there are five samples or fewer.
+	double get() const {
+		if (count == 0)
+			return 0;
+		if (count <= 5)
+			return heights[(int)std::lround(p * (count - 1))];
+		return heights[2];
+	}
+
+private:
+	double p;
+	long long count;
+	double heights[5];
+	double positions[5], desired[5], increments[5];
+
+	// Function to get the piecewise-parabolic prediction of the height of marker i moved by s (+1 or -1)
+	double parabolic(int i, int s) const {
+		return heights[i] + s / (positions[i + 1] - positions[i - 1]) * (
+			(positions[i] - positions[i - 1] + s) * (heights[i + 1] - heights[i]) / (positions[i + 1] - positions[i]) +
+			(positions[i + 1] - positions[i] - s) * (heights[i] - heights[i - 1]) / (positions[i] - positions[i - 1]));
+	}
+};
+
+// The ResponseStats class accumulates the count, mean and variance (with Welford's method), minimum and maximum of a stream of response times, along with estimates of the 50th, 90th and 99th percentiles. Every sample and every query take constant time and memory.
+class ResponseStats {
+public:
+	// Function to clear all samples
+	void reset() {
+		n = 0;
+		m_mean = m_m2 = m_min = m_max = 0;
+		p50.reset();
+		p90.reset();
+		p99.reset();
+	}
+
+	// Function to add a sample
+	void add(double x) {
+		n++;
+		double delta = x - m_mean;
+		m_mean += delta / n;
+		m_m2 += delta * (x - m_mean);
+		m_min = (n == 1) ? x : std::min(m_min, x);
+		m_max = (n == 1) ? x : std::max(m_max, x);
+		p50.add(x);
+		p90.add(x);
+		p99.add(x);
+	}
+
+	// Function to get the number of samples
+	long long get_count() const {
+		return n;
+	}
+
+	// Function to get the mean of the samples (0 if there are none)
+	double get_mean() const {
+		return m_mean;
+	}
+
+	// Function to get the sample variance (0 if there are fewer than two samples)
+	double get_variance() const {
+		return (n > 1) ? m_m2 / (n - 1) : 0;
+	}
+
+	// Function to get the sample standard deviation
+	double get_stddev() const {
+		return std::sqrt(get_variance());
+	}
+
+	// Function to get the smallest sample
+	double get_min() const {
+		return m_min;
+	}
+
+	// Function to get the largest sample
+	double get_max() const {
+		return m_max;
+	}
+
+	// Functions to get the estimated 50th, 90th and 99th percentiles
+	double get_p50() const {
+		return p50.get();
+	}
+
+	double get_p90() const {
+		return p90.get();
+	}
+
+	double get_p99() const {
+		return p99.get();
+	}
+
+private:
+	long long n = 0;
+	double m_mean = 0, m_m2 = 0, m_min = 0, m_max = 0;
+	P2Quantile p50 = P2Quantile(0.5), p90 = P2Quantile(0.9), p99 = P2Quantile(0.99);
+};
+
+#endif // RESPONSESTATS_HPP
\ No newline at end of file
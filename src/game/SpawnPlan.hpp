@@ -0,0 +1,83 @@
+/*
+ * Filename: SpawnPlan.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class for precomputing the times and positions at which moles are spawned.
+ */
+
+#if !defined(SPAWNPLAN_HPP)
+#define SPAWNPLAN_HPP
+
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+
+// Struct for a single planned spawn: the time (offset into the music) and the board position of the mole
+typedef struct {
+	std::chrono::microseconds time;
+	int x, y;
+} PlannedSpawn;
+
+// The SpawnPlan class computes the positions of all moles up front from a list of spawn times (e.g. the beats of a song) and the seed of the random generator, so that a session can be reproduced exactly.
+class SpawnPlan {
+public:
+	// Default constructor creating an empty plan
+	SpawnPlan() {}
+
+	// Constructor accepting the spawn times, the board size and the seed of the random generator. Generates a position for every spawn time, sorted by time.
+	SpawnPlan(const std::vector<std::chrono::microseconds> &times, int x, int y, uint32_t seed = std::random_device()()) : seed(seed) {
+		std::mt19937 rd(seed);
+		std::uniform_int_distribution<int> xdist(0, x - 1), ydist(0, y - 1);
+
+		spawns.reserve(times.size());
+		for (auto time : times) {
+			int px = xdist(rd);
+			int py = ydist(rd);
+			spawns.push_back(PlannedSpawn{time, px, py});
+		}
+
+		// Beat times are already sorted, but other sources of times may not be
+		std::stable_sort(spawns.begin(), spawns.end(), [](const PlannedSpawn &a, const PlannedSpawn &b) { return a.time < b.time; });
+	}
+
+	// Function to get the planned spawns
+	const std::vector<PlannedSpawn>& get_spawns() const {
+		return spawns;
+	}
+
+	// Function to get the seed that the plan was generated with
+	uint32_t get_seed() const {
+		return seed;
+	}
+
+	// Function to get a hash of the spawn times (the beat map), to check that a replay uses the same music and settings. Uses 64 bit FNV-1a.
+	uint64_t get_hash() const {
+		uint64_t hash = 14695981039346656037ull;
+		for (auto &spawn : spawns) {
+			uint64_t t = (uint64_t)spawn.time.count();
+			for (int i = 0; i < 8; i++) {
+				hash ^= (t >> (8 * i)) & 0xFF;
+				hash *= 1099511628211ull;
+			}
+		}
+		return hash;
+	}
+
+	// Function to get the number of planned spawns
+	size_t size() const {
+		return spawns.size();
+	}
+
+	// Function to check whether the plan is empty
+	bool empty() const {
+		return spawns.empty();
+	}
+
+private:
+	std::vector<PlannedSpawn> spawns;
+	uint32_t seed = 0;
+};
+
+#endif // SPAWNPLAN_HPP
\ No newline at end of file
@@ -2,7 +2,7 @@
  * Filename: game.hpp
  * Author: Malolan Venkataraghavan
  * 
- * Class implementing the game logic and graphics.
+ * Class implementing the game logic.
  */
 
 #if !defined(GAME_H)
@@ -14,60 +14,64 @@
 #include <chrono>
 #include <random>
 #include <functional>
-#include <thread>
-#include <mutex>
-#include <SFML/Graphics.hpp>
-#include "Hole.hpp"
-#include "Mole.hpp"
+#include <queue>
+#include <atomic>
+#include "SpawnPlan.hpp"
+#include "Board.hpp"
+#include "ResponseStats.hpp"
+#include "EventQueue.hpp"
+#include "Difficulty.hpp"
+#include "../replay/ReplayLog.hpp"
+#include "../clock/Clock.hpp"
 
-// Defines the logic of the mole game and function for displaying to the screen. Moles can be randomly spawned on the board and vanish in 6 seconds if not whacked.
+// Struct for the deadline of a mole: the time at which it vanishes and the handle of the mole
+typedef struct {
+	Clock::time_point deadline;
+	MoleHandle mole;
+} MoleDeadline;
+
+// Types of the events that change the game state
+enum class GameEventType { Spawn, Whack, Expire };
+
+// Struct for an event that changes the game state: its type, the location x and y (-1 for a spawn at a random location, unused for expiries), the handle of the mole (for expiries) and the time at which the event happened
+typedef struct {
+	GameEventType type;
+	int x, y;
+	MoleHandle mole;
+	Clock::time_point time;
+} GameEvent;
+
+// Comparator ordering mole deadlines so that the earliest is at the top of a priority queue
+struct MoleDeadlineLater {
+	bool operator()(const MoleDeadline &a, const MoleDeadline &b) const {
+		return a.deadline > b.deadline;
+	}
+};
+
+// Defines the logic of the mole game, without any graphics (see GameRenderer). Moles can be randomly spawned on the board and vanish in 7 seconds if not whacked.
+// The game state is owned by the thread that calls 'update' (the game loop). Spawns and whacks from any thread (tickers, controllers) are posted as events to a lock-free queue that 'update' drains, so the state has a single writer and needs no locks.
 class Game {
 public:
 	// The default 3x3 game constructor
 	Game() : Game(3, 3) {}
 
-	// Constructor with customisable board size
-	Game(int x = 3, int y = 3) {
+	// Constructor with customisable board size and the clock used for timing moles (the real clock by default)
+	Game(int x = 3, int y = 3, Clock &clock = Clock::system()) : board(x, y), m_clock(&clock) {
 		// Set the board x and y sizes
 		this->x = x;
 		this->y = y;
-		// Loop through the sizes and initialise the board, mole start times and terminate_remove_thread vectors
-		for (int i = 0; i < x; i++) {
-			std::vector<bool> b;
-			std::vector<std::chrono::steady_clock::time_point> t;
-			std::vector<bool> trt;
-			for (int j = 0; j < y; j++) {
-				b.push_back(false);
-				t.push_back(std::chrono::high_resolution_clock::now());
-				trt.push_back(false);
-			}
-			this->board.push_back(b);
-			this->mole_start_times.push_back(t);
-			this->terminate_remove_thread.push_back(trt);
-		}
 
-		// Initialise the number of whacked, missed and total moles and the times taken to whack
+		// Initialise the number of whacked, missed and total moles
 		this->n_whacked = 0;
 		this->n_missed = 0;
 		this->n_total = 0;
-		this->whack_times = std::vector<std::chrono::duration<double>>();
-
-		// Initialise random device and uniform distributions for x and y
-		this->rd = std::mt19937(std::random_device()());
-		this->xdist = std::uniform_int_distribution<int>(0, x - 1);
-		this->ydist = std::uniform_int_distribution<int>(0, y - 1);
-
-		// Load the mole and hole texture, set sprites and their scales and origins
-		this->moleTex.loadFromMemory(Mole_png, Mole_png_len);
-		this->holeTex.loadFromMemory(Hole_png, Hole_png_len);
-		this->moleSprite.setTexture(moleTex);
-		this->holeSprite.setTexture(holeTex);
-		this->moleSprite.setScale(0.3, 0.3);
-		this->holeSprite.setScale(0.3, 0.3);
-		auto holeSize = holeSprite.getLocalBounds();
-		auto moleSize = moleSprite.getLocalBounds();
-		this->moleSprite.setOrigin(0.5 * moleSize.width, 0.5 * moleSize.height);
-		this->holeSprite.setOrigin(0.5 * holeSize.width, 0.5 * holeSize.height);
+		this->n_dropped = 0;
+		this->avg_whack_time = 0;
+		this->version = 0;
+
+		// Initialise random device, keeping the seed so that the session can be reproduced
+		this->seed = std::random_device()();
+		this->rd = std::mt19937(seed);
 	}
 
 	// Reset function to reset the scoring variables
@@ -75,41 +79,61 @@ public:
 		this->n_total = 0;
 		this->n_whacked = 0;
 		this->n_missed = 0;
-		this->whack_times.clear();
+		this->whack_stats.reset();
+		this->avg_whack_time = 0;
 	}
 
-	// Function to create a random mole
+	// Function to create a mole at a random empty location (from any thread, applied on the next update)
 	void make_mole() {
-		// Get random x and y values until there is no mole in that location
-		int x = xdist(rd);
-		int y = ydist(rd);
-		while (board[x][y]) {
-			x = xdist(rd);
-			y = ydist(rd);
-		}
-		
-		// Set the board to have a mole there
-		board[x][y] = true;
+		post(GameEvent{GameEventType::Spawn, -1, -1, MoleHandle{0, 0}, m_clock->now()});
+	}
 
-		// Check if the board is full of moles
-		bool board_full = true;
-		for (int i = 0; i < this->x; i++)
-			for (int j = 0; j < this->y; j++)
-				if (!board[i][j])
-					board_full = false;
-		
-		// If the board is full of moles, reset the game and call the game over callback function
-		if (board_full) {
-			this->reset();
-			this->game_over_callback();
+	// Function to create a mole at a location x and y from [0, x-1] and [0, y-1] (from any thread, applied on the next update). If there is already a mole at the location, an empty location chosen deterministically from the requested one is used instead.
+	void make_mole_at(int x, int y) {
+		post(GameEvent{GameEventType::Spawn, x, y, MoleHandle{0, 0}, m_clock->now()});
+	}
+
+	// Function to set a precomputed spawn plan and rewind it to the start
+	void set_spawn_plan(SpawnPlan plan) {
+		this->plan = plan;
+		this->plan_cursor = 0;
+	}
+
+	// Function to spawn every mole in the spawn plan that is due at the given time (offset into the music), advancing the plan cursor. No random numbers are drawn. Like the ComposedTicker, planned spawns more than the maximum lateness before the given time are skipped, so that a stall does not spawn them in one burst and fill the board. With a difficulty controller, planned spawns sooner than its spawn period after the previous one are skipped too.
+	void advance_plan(std::chrono::microseconds time) {
+		auto &spawns = plan.get_spawns();
+		while (plan_cursor < spawns.size() && spawns[plan_cursor].time <= time) {
+			auto t = spawns[plan_cursor].time;
+			if (time - t > plan_lateness) {
+				plan_cursor++;
+				continue;
+			}
+			if (!difficulty || plan_cursor == 0 || t - last_planned >= difficulty->get_spawn_period()) {
+				make_mole_at(spawns[plan_cursor].x, spawns[plan_cursor].y);
+				last_planned = t;
+			}
+			plan_cursor++;
 		}
+	}
 
-		// Set the time at which the mole is spawned
-		this->mole_start_times[x][y] = std::chrono::high_resolution_clock::now();
-		// Start a thread to remove the mole in 6 seconds
-		m_threads.push_back(std::thread(&Game::remove_mole, this, x, y));
-		// Increment the total number of moles
-		n_total++;
+	// Function to create a mole at a random empty location if the difficulty controller's spawn period has passed since the last paced spawn (every call without a difficulty controller). To be called from a ticker running faster than the shortest spawn period.
+	void make_mole_paced() {
+		auto now = m_clock->now();
+		if (difficulty && paced && now - last_paced < difficulty->get_spawn_period())
+			return;
+		paced = true;
+		last_paced = now;
+		make_mole();
+	}
+
+	// Function to set the maximum lateness after which a planned spawn is skipped by advance_plan
+	void set_plan_lateness(std::chrono::microseconds lateness) {
+		plan_lateness = lateness;
+	}
+
+	// Function to get the spawn plan
+	const SpawnPlan& get_spawn_plan() {
+		return plan;
 	}
 
 	// Function to whack a mole at a location x and y passed are from [0, x] and [0, y]
@@ -120,30 +144,28 @@ public:
 			return;
 		}
 
-		// If the board has a mole at the location
-		if (board[x][y]) {
-			// Acquire mutex for terminate_remove_thread
-			trt_mutex.lock();
-			// Set it to true to stop the thread
-			terminate_remove_thread[x][y] = true;
-			trt_mutex.unlock();
-			// Set the board to false at that location
-			board[x][y] = false;
-			// Increment the number of moles whacked
-			n_whacked++;
-			// Add the response time to the whack times vector
-			whack_times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mole_start_times[x][y]));
-		}
+		// Post the whack with the time of the input, so that the response time does not depend on when the event is applied
+		whack_at(x, y, m_clock->now());
+	}
+
+	// Function to whack a mole at a location x and y from [0, x-1] and [0, y-1] with the time of the input (from any thread, applied on the next update), e.g. for replaying a session
+	void whack_at(int x, int y, Clock::time_point time) {
+		post(GameEvent{GameEventType::Whack, x, y, MoleHandle{0, 0}, time});
 	}
 
 	// Function to print the current board to the terminal
 	void print_board() {
-		std::cout << "+---+---+---+\n";
+		// Build the frame line for the width of the board
+		std::string line = "+";
+		for (int j = 0; j < this->y; j++)
+			line += "---+";
+
+		std::cout << line << "\n";
 		for (int i = 0; i < this->x; i++) {
 			for (int j = 0; j < this->y; j++) {
-				std::cout << "| " << (board[i][j] ? "#" : " ") << " ";
+				std::cout << "| " << (board.is_occupied(i, j) ? "#" : " ") << " ";
 			}
-			std::cout << "|\n+---+---+---+\n";
+			std::cout << "|\n" << line << "\n";
 		}
 	}
 
@@ -162,18 +184,24 @@ public:
 		return n_total;
 	}
 
-	// Function to get the response times vector
-	std::vector<std::chrono::duration<double>> get_whack_times() {
-		return whack_times;
+	// Function to get the response time statistics (in milliseconds), from the thread that owns the game state
+	const ResponseStats& get_whack_stats() {
+		return whack_stats;
 	}
 
-	// Function to get the average response time
+	// Function to get the average response time in milliseconds (0 before the first whack), from any thread
 	double get_avg_whack_time() {
-		double sum = 0;
-		for (auto time : whack_times) {
-			sum += std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
-		}
-		return sum / whack_times.size();
+		return avg_whack_time;
+	}
+
+	// Function to get a counter that moves on whenever the board or the scores change, from any thread (e.g. to redraw only on change)
+	uint64_t get_version() {
+		return version;
+	}
+
+	// Function to get the number of events dropped because the event queue was full
+	int get_n_dropped() {
+		return n_dropped;
 	}
 
 	// Function to get the score as the fraction of moles whacked
@@ -181,8 +209,8 @@ public:
 		return (double)n_whacked / n_total;
 	}
 	
-	// Function to get the board
-	std::vector<std::vector<bool>> get_board() {
+	// Function to get a read-only view of the board (without copying it)
+	const Board& get_board() {
 		return board;
 	}
 
@@ -196,81 +224,236 @@ public:
 		return y;
 	}
 
+	// Function to set the seed of the random generator used for placing moles without a spawn plan, e.g. for replaying a session
+	void set_seed(uint32_t seed) {
+		this->seed = seed;
+		this->rd = std::mt19937(seed);
+	}
+
+	// Function to get the seed of the random generator used for placing moles without a spawn plan
+	uint32_t get_seed() {
+		return seed;
+	}
+
+	// Function to set the time a mole stays up for if not whacked, for moles spawned after the call
+	void set_mole_lifetime(Clock::duration lifetime) {
+		// Record changes to the lifetime, since the deadlines in a replay depend on it
+		if (recorder && lifetime != mole_lifetime)
+			recorder->record_lifetime(std::chrono::duration_cast<std::chrono::nanoseconds>(lifetime));
+		mole_lifetime = lifetime;
+	}
+
+	// Function to set the difficulty controller that adapts the mole lifetime and spawn period to the player (nullptr to disable). Must be set before the game is started.
+	void set_difficulty(DifficultyController *difficulty) {
+		this->difficulty = difficulty;
+		if (difficulty)
+			mole_lifetime = difficulty->get_mole_lifetime();
+	}
+
+	// Function to get the time a mole stays up for if not whacked
+	Clock::duration get_mole_lifetime() {
+		return mole_lifetime;
+	}
+
+	// Function to get the header of a replay log of this game: the board size, the mole lifetime, and the seed and beat map hash of the spawn plan (or the seed of the random generator without a plan)
+	ReplayHeader get_replay_header() {
+		return ReplayHeader{x, y, std::chrono::duration_cast<std::chrono::nanoseconds>(mole_lifetime).count(), plan.empty() ? seed : plan.get_seed(), plan.empty() ? 0 : plan.get_hash()};
+	}
+
+	// Function to get the footer of a replay log of this game with the current counts
+	ReplayFooter get_replay_footer() {
+		return ReplayFooter{(uint32_t)n_whacked, (uint32_t)n_missed, (uint32_t)n_total};
+	}
+
+	// Function to set the replay log that every applied spawn, whack and expiry is recorded to (nullptr to disable). The log is written from the thread that owns the game state.
+	void set_recorder(ReplayWriter *recorder) {
+		this->recorder = recorder;
+	}
+
+	// Function to set a function called on the posting thread after every event that is posted (a spawn or whack), e.g. to resume a simulation step that was paused while the game was idle
+	void set_wake_callback(std::function<void()> f) {
+		this->wake_callback = f;
+	}
+
 	// Function to set the callback function for when the board becomes full
 	void set_game_over_callback(std::function<void()> f) {
 		this->game_over_callback = f;
 	}
 
-	// Function to render the board to the screen (graphical window)
-	void render(sf::RenderWindow *window) {
-		// Fill screen with brown bg color
-		window->clear(sf::Color(0xA67C5200));
-
-		// Get window size and sprite sizes
-		auto winSize = window->getSize();
-		auto holeSize = holeSprite.getLocalBounds();
-		auto moleSize = moleSprite.getLocalBounds();
-		
-		// Draw the holes or moles if there's a mole in the position
-		for (int i = 0; i < x; i++) {
-			for (int j = 0; j < y; j++) {
-				// Set the hole and mole sprite positions based on the window size, sprite size and current position on board
-				holeSprite.setPosition(sf::Vector2f(i * winSize.x/3 + 0.3*holeSize.width/2, j * winSize.y/3 + 0.3*holeSize.height/2));
-				moleSprite.setPosition(sf::Vector2f(i * winSize.x/3 + 0.3*moleSize.width/2, j * winSize.y/3 + 0.3*moleSize.height/2));
-				if (board[i][j]) {
-					window->draw(moleSprite);
-				} else {
-					window->draw(holeSprite);
-				}
-			}
+	// Update function to apply the posted spawns and whacks in order, then remove the moles whose lifetime has passed and count them as missed. To be called once per frame from the game loop, which makes it the owner of the game state. Only the expired deadlines are visited.
+	void update() {
+		auto now = m_clock->now();
+		bool changed = apply_events(now);
+
+		while (!deadlines.empty() && deadlines.top().deadline <= now) {
+			MoleDeadline d = deadlines.top();
+			deadlines.pop();
+			apply(GameEvent{GameEventType::Expire, -1, -1, d.mole, d.deadline}, now);
+			changed = true;
 		}
+		// Mark the end of the update in the replay log, so that a replay applies the same events before removing the expired moles
+		if (recorder && changed)
+			recorder->record(ReplayEventType::Update, 0, 0, now);
+		publish_next_deadline();
+	}
+
+	// Function to apply the posted spawns and whacks in order without removing the moles whose lifetime has passed, e.g. for replaying the events of an update before its expiries. To be called from the thread that owns the game state.
+	void apply_posted() {
+		apply_events(m_clock->now());
+		publish_next_deadline();
+	}
+
+	// Function to get the time at which the next mole vanishes, or the maximum time point if there are no moles, as of the last update (safe from any thread)
+	Clock::time_point get_next_deadline() {
+		return Clock::time_point(Clock::duration(next_deadline.load(std::memory_order_relaxed)));
+	}
+
+	// Function to check whether the game has nothing to update: no moles waiting for their deadline and no posted events. To be called from the thread that owns the game state.
+	bool is_idle() {
+		return deadlines.empty() && events.empty();
 	}
 
-	// Stop function to stop all threads
+	// Stop function to stop removing moles
 	void stop() {
-		for (int i = 0; i < x; i++)
-			for (int j = 0; j < y; j++) {
-				trt_mutex.lock();
-				terminate_remove_thread[i][j] = true;
-				trt_mutex.unlock();
-			}
+		deadlines = decltype(deadlines)();
+		publish_next_deadline();
 	}
 
 private:
 	int x, y;
-	std::vector<std::vector<bool>> board;
-	std::atomic_int n_whacked, n_missed, n_total;
-	std::vector<std::chrono::duration<double>> whack_times;
+	Board board;
+	std::atomic_int n_whacked, n_missed, n_total, n_dropped;
+	ResponseStats whack_stats;
+	std::atomic<double> avg_whack_time;
+	std::atomic<uint64_t> version;
 	std::mt19937 rd;
-	std::uniform_int_distribution<int> xdist, ydist;
-	std::vector<std::vector<std::chrono::high_resolution_clock::time_point>> mole_start_times;
+	uint32_t seed;
+	ReplayWriter *recorder = nullptr;
+	DifficultyController *difficulty = nullptr;
+	std::chrono::microseconds last_planned = std::chrono::microseconds(0);
+	std::chrono::microseconds plan_lateness = std::chrono::milliseconds(50);
+	Clock::time_point last_paced;
+	bool paced = false;
 	std::function<void()> game_over_callback;
-	std::vector<std::thread> m_threads;
-	std::vector<std::vector<bool>> terminate_remove_thread;
-	std::mutex trt_mutex = std::mutex();
-	sf::Texture moleTex, holeTex;
-	sf::Sprite moleSprite, holeSprite;
-
-	// Function to remove mole at a position in 6 seconds
-	void remove_mole(int x, int y) {
-		// Get the start time
-		auto start = std::chrono::high_resolution_clock::now();
-		// Wait until 6 seconds have passed
-		while (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - start).count() < 7) {
-			// Acquire the trt mutex
-			trt_mutex.lock();
-			// If the terminate_remove_thread for the location has been set, unset it, release mutex and return
-			if (terminate_remove_thread[x][y]) {
-				terminate_remove_thread[x][y] = false;
-				trt_mutex.unlock();
+	std::function<void()> wake_callback;
+	SpawnPlan plan;
+	size_t plan_cursor = 0;
+	std::priority_queue<MoleDeadline, std::vector<MoleDeadline>, MoleDeadlineLater> deadlines;
+	std::atomic<Clock::duration::rep> next_deadline = Clock::time_point::max().time_since_epoch().count();
+	EventQueue<GameEvent> events = EventQueue<GameEvent>(4096);
+	Clock::duration mole_lifetime = std::chrono::seconds(7);
+	Clock *m_clock;
+	// Function to post an event to be applied by the next update, counting it as dropped if the queue is full
+	void post(const GameEvent &e) {
+		if (!events.push(e))
+			n_dropped++;
+		else if (wake_callback)
+			wake_callback();
+	}
+
+	// Function to publish the time of the next deadline for other threads, from the thread that owns the game state
+	void publish_next_deadline() {
+		next_deadline.store((deadlines.empty() ? Clock::time_point::max() : deadlines.top().deadline).time_since_epoch().count(), std::memory_order_relaxed);
+	}
+
+	// Function to apply the posted events in order, spawning moles at the given time of the update. Returns whether any event was applied.
+	bool apply_events(Clock::time_point now) {
+		bool applied = false;
+		GameEvent e;
+		while (events.pop(e)) {
+			apply(e, now);
+			applied = true;
+		}
+		return applied;
+	}
+
+	// Function to apply an event to the game state at the given time of the update, on the thread that owns it
+	void apply(const GameEvent &e, Clock::time_point now) {
+		switch (e.type) {
+		case GameEventType::Spawn: {
+			if (board.is_full())
+				return;
+			int index;
+			if (e.x < 0) {
+				// Pick one of the empty locations directly
+				int k = std::uniform_int_distribution<int>(0, board.get_n_free() - 1)(rd);
+				index = board.get_free(k);
+			} else {
+				// Ignore locations that are not on the board, e.g. from a corrupt replay log
+				if (!board.contains(e.x, e.y))
+					return;
+				index = board.index(e.x, e.y);
+				if (board.is_occupied(index))
+					index = board.get_free(index % board.get_n_free());
+			}
+			spawn(index, now);
+			break;
+		}
+		case GameEventType::Whack: {
+			// Ignore whacks that are not on the board, so that they are neither recorded nor looked up
+			if (!board.contains(e.x, e.y))
 				return;
+			if (recorder)
+				recorder->record(ReplayEventType::Whack, e.x, e.y, e.time);
+			// Only a mole that was up when the whack happened can be whacked
+			int i = board.index(e.x, e.y);
+			if (board.is_occupied(i) && board.get_spawn_time(i) <= e.time && e.time < board.get_deadline(i)) {
+				// Add the response time in milliseconds to the whack statistics
+				auto reaction = e.time - board.get_spawn_time(i);
+				whack_stats.add(std::chrono::duration<double, std::milli>(reaction).count());
+				avg_whack_time = whack_stats.get_mean();
+				// Remove the mole, which makes its handle stale so that the mole's deadline is ignored
+				board.remove(i);
+				// Increment the number of moles whacked
+				n_whacked++;
+				version++;
+				if (difficulty) {
+					difficulty->on_hit(reaction);
+					set_mole_lifetime(difficulty->get_mole_lifetime());
+				}
+			}
+			break;
+		}
+		case GameEventType::Expire: {
+			// Skip the expiry if the mole has already been whacked (its handle is stale)
+			if (!board.is_alive(e.mole))
+				return;
+			int i = board.get_record(e.mole).cell;
+			if (recorder)
+				recorder->record(ReplayEventType::Expire, i % x, i / x, e.time);
+			board.remove(i);
+			n_missed++;
+			version++;
+			if (difficulty) {
+				difficulty->on_miss();
+				set_mole_lifetime(difficulty->get_mole_lifetime());
 			}
-			// Else, unlock mutex and wait
-			trt_mutex.unlock();
+			break;
+		}
+		}
+	}
+
+	// Function to place a mole at an empty index at the given time of the update. If the board becomes full, the game is reset and the game over callback function is called.
+	void spawn(int index, Clock::time_point now) {
+		// Set the board to have a mole there, with the time at which the mole is spawned and its deadline, and add the deadline to the deadline queue (nothing is spawned if the mole pool is exhausted)
+		MoleHandle mole = board.spawn(index, now, now + mole_lifetime);
+		if (!board.is_alive(mole))
+			return;
+		if (recorder)
+			recorder->record(ReplayEventType::Spawn, index % x, index / x, now);
+		deadlines.push(MoleDeadline{now + mole_lifetime, mole});
+		// Increment the total number of moles
+		n_total++;
+		version++;
+
+		// Check if the board is full of moles
+		bool board_full = board.is_full();
+
+		// If the board is full of moles, reset the game and call the game over callback function
+		if (board_full) {
+			this->reset();
+			this->game_over_callback();
 		}
-		// If the time has passed, remove mole and increment the number of moles missed.
-		board[x][y] = false;
-		n_missed++;
 	}
 };
 
@@ -12,17 +12,24 @@
 #include <vector>
 #include <regex>
 #include <iostream>
+#include <chrono>
+#include <thread>
 
-// Function to get the current data from the glove as a vector of doubles.
-std::vector<double> getCurrentData(serialib &serial) {
+// Function to get the current data from the glove as a vector of doubles. Waits at most 'timeout' for data to arrive (forever if zero) and returns an empty vector if none does.
+std::vector<double> getCurrentData(serialib &serial, std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) {
 	// Verify that the serial device is open
 	if (!serial.isDeviceOpen()) {
 		std::cerr << "Error: serial device not open" << std::endl;
 		exit(1);
 	}
 
-	// Wait for data to be available
-	while (!serial.available());
+	// Wait for data to be available, sleeping between checks instead of spinning (a line takes about 100 ms at 9600 baud)
+	auto start = std::chrono::steady_clock::now();
+	while (!serial.available()) {
+		if (timeout.count() > 0 && std::chrono::steady_clock::now() - start >= timeout)
+			return std::vector<double>();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
 
 	// Create the regex pattern for the desired data format
 	std::string rgxPattern = "";
@@ -15,9 +15,10 @@
 #include <string>
 #include <sstream>
 #include <chrono>
+#include "../clock/Clock.hpp"
 
 // Function to record a hand pose for a set amount of time
-std::vector<std::vector<double>> recordPose(serialib &serial, int nSecs = 10) {
+std::vector<std::vector<double>> recordPose(serialib &serial, int nSecs = 10, Clock &clock = Clock::system()) {
 	// Verify the serial device is open
 	if (!serial.isDeviceOpen()) {
 		std::cerr << "Error: serial device not open" << std::endl;
@@ -28,15 +29,15 @@ std::vector<std::vector<double>> recordPose(serialib &serial, int nSecs = 10) {
 	std::vector<std::vector<double>> data;
 	
 	// Get start time
-	auto start = std::chrono::high_resolution_clock::now();
+	auto start = clock.now();
 
 	// Loop for the desired time
-	while (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count() <= (nSecs * 1000)) {
+	while (std::chrono::duration_cast<std::chrono::milliseconds>(clock.now() - start).count() <= (nSecs * 1000)) {
 		// Get current data and add to data
 		std::vector<double> currentData = getCurrentData(serial);
 		data.push_back(currentData);
 		// Sleep for a while to not record too many samples
-		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		clock.sleep_for(std::chrono::milliseconds(1));
 	}
 
 	// Return the recorded data
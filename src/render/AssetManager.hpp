@@ -0,0 +1,75 @@
+/*
+ * Filename: AssetManager.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing the loading of the game's textures and font on a worker thread.
+ */
+
+#if !defined(ASSETMANAGER_HPP)
+#define ASSETMANAGER_HPP
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <future>
+#include <chrono>
+#include <SFML/Graphics.hpp>
+#include "GameRenderer.hpp"
+#include "../UI/Roboto_Italic_Font.hpp"
+
+// Characters drawn by the game's texts, rendered into the font's glyph texture while loading
+const std::string PRELOADED_GLYPHS = "0123456789.:-/ ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz!";
+
+// The AssetManager class starts loading the shared texture atlas and the font on a worker thread as soon as it is created (at launch, so that the loading overlaps the menu) and hands them back when they are ready. Creating renderers or texts after that does no loading on the window's thread. The getters wait for the worker thread, so they are also safe to call before it has finished.
+class AssetManager {
+public:
+	// Constructor accepting the character sizes the font is drawn at, whose glyphs are rendered while loading. Starts the worker thread.
+	AssetManager(std::vector<unsigned> glyph_sizes = {}) : glyph_sizes(glyph_sizes) {
+		loaded = std::async(std::launch::async, &AssetManager::load, this);
+	}
+
+	// Destructor waits for the worker thread, which writes to the assets
+	~AssetManager() {
+		wait();
+	}
+
+	// Function to check whether the assets have finished loading, without waiting
+	bool is_ready() {
+		return loaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+
+	// Function to wait for the assets to finish loading
+	void wait() {
+		if (loaded.valid())
+			loaded.wait();
+	}
+
+	// Function to get the shared texture atlas, which also keeps it loaded for the renderers created later
+	std::shared_ptr<GameTextures> get_textures() {
+		wait();
+		return textures;
+	}
+
+	// Function to get the font
+	sf::Font& get_font() {
+		wait();
+		return font;
+	}
+
+private:
+	std::vector<unsigned> glyph_sizes;
+	std::future<void> loaded;
+	std::shared_ptr<GameTextures> textures;
+	sf::Font font;
+
+	// Function run by the worker thread: uploads the atlas, parses the font and renders the glyphs of the game's texts at every character size
+	void load() {
+		textures = GameTextures::get();
+		font.loadFromMemory(Roboto_Italic_ttf, Roboto_Italic_ttf_len);
+		for (unsigned size : glyph_sizes)
+			for (char c : PRELOADED_GLYPHS)
+				font.getGlyph((sf::Uint32)c, size, false);
+	}
+};
+
+#endif // ASSETMANAGER_HPP
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+ * Filename: FrameProfiler.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class recording the time spent in every stage of a frame into a ring buffer.
+ */
+
+#if !defined(FRAMEPROFILER_HPP)
+#define FRAMEPROFILER_HPP
+
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+// Stages timed by the profiler. Polling the window for input, drawing and presenting run on the render loop and make up a frame. Gesture inference and the simulation step run on their own threads and at their own rates, so they are timed per step on their own timeline instead.
+enum class FrameStage { Input, Render, Present, Gesture, Simulation, Count };
+
+const int N_FRAME_STAGES = (int)FrameStage::Count;
+
+// Number of stages that make up a frame (the stages of the render loop, which come first)
+const int N_RENDER_STAGES = 3;
+
+// Names of the stages, for reports and the overlay
+const char *const FRAME_STAGE_NAMES[N_FRAME_STAGES] = { "Input", "Render", "Present", "Gesture", "Simulation" };
+
+// Struct for the record of a frame: the time spent in every stage of the render loop in microseconds
+typedef struct {
+	long long stages[N_RENDER_STAGES];
+} FrameRecord;
+
+// Struct for the statistics of a stage timed per step: the number of steps, and their total and longest time in microseconds
+typedef struct {
+	long long steps, total, max;
+} StepStats;
+
+// The FrameProfiler class collects the time spent in every stage of the frame being built and commits it to a ring buffer, allocated up front, when the frame ends. Only the most recent 'capacity' frames are kept. An iteration of the render loop that does not draw is skipped, so its time is not added to the next frame.
+// The stages of the render loop are added from its thread only. The gesture and simulation stages are added per step from their own threads to atomic counters that are never folded into a frame.
+class FrameProfiler {
+public:
+	// Class measuring the time from its construction to its destruction and adding it to a stage
+	class Scope {
+	public:
+		Scope(FrameProfiler &profiler, FrameStage stage) : profiler(&profiler), stage(stage), start(std::chrono::steady_clock::now()) {}
+
+		~Scope() {
+			profiler->add(stage, std::chrono::steady_clock::now() - start);
+		}
+
+	private:
+		FrameProfiler *profiler;
+		FrameStage stage;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// Constructor accepting the number of frames kept
+	FrameProfiler(size_t capacity = 240) : records(capacity) {
+		for (auto &p : pending)
+			p = 0;
+		for (int s = 0; s < N_FRAME_STAGES - N_RENDER_STAGES; s++) {
+			step_counts[s] = 0;
+			step_totals[s] = 0;
+			step_maxima[s] = 0;
+		}
+	}
+
+	// Function to add time spent in a stage: to the current frame for a stage of the render loop (from the render loop only), or as one step for the other stages (from any thread)
+	void add(FrameStage stage, std::chrono::steady_clock::duration d) {
+		long long us = std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+		int s = (int)stage;
+		if (s < N_RENDER_STAGES) {
+			pending[s] += us;
+			return;
+		}
+		s -= N_RENDER_STAGES;
+		step_counts[s].fetch_add(1, std::memory_order_relaxed);
+		step_totals[s].fetch_add(us, std::memory_order_relaxed);
+		long long longest = step_maxima[s].load(std::memory_order_relaxed);
+		while (us > longest && !step_maxima[s].compare_exchange_weak(longest, us, std::memory_order_relaxed));
+	}
+
+	// Function to end the current frame, committing it to the ring buffer, and start the next one. To be called from the render loop only.
+	void end_frame() {
+		FrameRecord &r = records[count % records.size()];
+		for (int s = 0; s < N_RENDER_STAGES; s++)
+			r.stages[s] = pending[s];
+		skip_frame();
+		count++;
+	}
+
+	// Function to drop the time added to the current frame, for an iteration of the render loop that did not draw. To be called from the render loop only.
+	void skip_frame() {
+		for (auto &p : pending)
+			p = 0;
+	}
+
+	// Function to get the number of frames kept (at most the capacity)
+	size_t size() {
+		return std::min(count, records.size());
+	}
+
+	// Function to get the maximum number of frames kept
+	size_t capacity() {
+		return records.size();
+	}
+
+	// Function to get a kept frame, from 0 for the oldest to size() - 1 for the most recent
+	const FrameRecord& get_frame(size_t k) {
+		return records[(count - size() + k) % records.size()];
+	}
+
+	// Function to check whether a stage is timed per step rather than per frame
+	static bool is_step_stage(FrameStage stage) {
+		return (int)stage >= N_RENDER_STAGES;
+	}
+
+	// Function to get the statistics of a stage timed per step since the profiler was created
+	StepStats get_step_stats(FrameStage stage) {
+		int s = (int)stage - N_RENDER_STAGES;
+		return StepStats{step_counts[s].load(std::memory_order_relaxed), step_totals[s].load(std::memory_order_relaxed), step_maxima[s].load(std::memory_order_relaxed)};
+	}
+
+	// Function to get the mean time of a stage in milliseconds: per frame over the kept frames for a stage of the render loop, or per step for the other stages
+	double get_mean(FrameStage stage) {
+		if (is_step_stage(stage)) {
+			StepStats stats = get_step_stats(stage);
+			return stats.steps ? stats.total / 1000.0 / stats.steps : 0;
+		}
+		size_t n = size();
+		long long total = 0;
+		for (size_t k = 0; k < n; k++)
+			total += get_frame(k).stages[(int)stage];
+		return n ? total / 1000.0 / n : 0;
+	}
+
+	// Function to get the total time of a frame in milliseconds
+	static double get_total(const FrameRecord &r) {
+		long long total = 0;
+		for (int s = 0; s < N_RENDER_STAGES; s++)
+			total += r.stages[s];
+		return total / 1000.0;
+	}
+
+	// Function to print the mean time of every stage of the render loop and of the whole frame over the kept frames, and the mean and longest time per step of the other stages that were run
+	void print(std::ostream &out = std::cout) {
+		double total = 0;
+		auto precision = out.precision();
+		out << std::fixed << std::setprecision(3);
+		for (int s = 0; s < N_RENDER_STAGES; s++) {
+			double mean = get_mean((FrameStage)s);
+			total += mean;
+			out << FRAME_STAGE_NAMES[s] << ": " << mean << " ms, ";
+		}
+		out << "frame: " << total << " ms over " << size() << " frames" << std::endl;
+		for (int s = N_RENDER_STAGES; s < N_FRAME_STAGES; s++) {
+			StepStats stats = get_step_stats((FrameStage)s);
+			if (stats.steps)
+				out << FRAME_STAGE_NAMES[s] << ": " << get_mean((FrameStage)s) << " ms per step, longest " << stats.max / 1000.0 << " ms over " << stats.steps << " steps" << std::endl;
+		}
+		out << std::defaultfloat << std::setprecision(precision);
+	}
+
+private:
+	std::vector<FrameRecord> records;
+	size_t count = 0;
+	long long pending[N_RENDER_STAGES];
+	std::atomic<long long> step_counts[N_FRAME_STAGES - N_RENDER_STAGES], step_totals[N_FRAME_STAGES - N_RENDER_STAGES], step_maxima[N_FRAME_STAGES - N_RENDER_STAGES];
+};
+
+#endif // FRAMEPROFILER_HPP
\ No newline at end of file
@@ -0,0 +1,235 @@
+/*
+ * Filename: GameRenderer.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing the graphics of a game board, kept apart from the game logic.
+ */
+
+#if !defined(GAMERENDERER_HPP)
+#define GAMERENDERER_HPP
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <SFML/Graphics.hpp>
+#include "GameAtlas.hpp"
+#include "../game/Board.hpp"
+#include "../clock/Clock.hpp"
+
+// Struct for the texture atlas holding the mole, the hole and a block of the background colour, shared by all the renderers in the process. The atlas is scaled and packed at build time (by atlasgen) and embedded as raw RGBA pixels, so it is uploaded without decoding.
+struct GameTextures {
+	sf::Texture atlas;
+	// Regions of the mole, the hole and the background colour in the atlas
+	sf::FloatRect mole, hole, fill;
+
+	GameTextures() {
+		atlas.create(GameAtlas_width, GameAtlas_height);
+		atlas.update(GameAtlas_rgba);
+		atlas.setSmooth(true);
+		// Mipmaps keep the sprites smooth when they are drawn smaller than the atlas, e.g. on large boards
+		atlas.generateMipmap();
+		mole = region(GameAtlas_mole);
+		hole = region(GameAtlas_hole);
+		fill = region(GameAtlas_fill);
+	}
+
+	// Function to convert a region of the generated atlas (x, y, width and height) to a rectangle
+	static sf::FloatRect region(const unsigned int r[4]) {
+		return sf::FloatRect((float)r[0], (float)r[1], (float)r[2], (float)r[3]);
+	}
+
+	// Function to get the shared textures, loading them if no renderer holds them
+	static std::shared_ptr<GameTextures> get() {
+		static std::mutex mutex;
+		static std::weak_ptr<GameTextures> shared;
+		std::lock_guard<std::mutex> lock(mutex);
+		auto textures = shared.lock();
+		if (!textures) {
+			textures = std::make_shared<GameTextures>();
+			shared = textures;
+		}
+		return textures;
+	}
+};
+
+// The GameRenderer class draws a board to a window. It only reads the occupancy of the board, which is safe from any thread, so the game logic (in musicmole-core) does not depend on SFML and the rendering can run on the window's thread while the game state is owned by the simulation.
+// The background, the holes and the moles are quads of one vertex array over the texture atlas, so a board of any size is drawn in a single draw call. The quads are laid out when the viewport size changes, and otherwise only the mole quads of the cells whose occupancy changed or that are animating are rewritten.
+// Moles pop up after they are spawned, sink into their hole just before their deadline and are squashed when whacked. The animations are computed from the spawn time and deadline the board publishes for every location, so they need no extra state from the game and no extra draw calls.
+class GameRenderer {
+public:
+	// Constructor accepting the board to draw, which must outlive the renderer, and the clock the game is timed against
+	GameRenderer(const Board &board, Clock &clock = Clock::system()) : board(&board), m_clock(&clock), drawn(board.get_n_words(), 0), moving(board.get_n_words(), 0), whacked_at(board.size(), Clock::time_point::min()) {
+		this->x = board.get_width();
+		this->y = board.get_height();
+
+		// Get the shared atlas. The quads are the background, then the holes, then the moles of every cell.
+		this->textures = GameTextures::get();
+		this->vertices = sf::VertexArray(sf::Quads, 4 * (1 + 2 * (size_t)board.size()));
+	}
+
+	// Function to render the board to a target (the graphical window, or a texture for rendering offscreen), into a viewport given as fractions of the target (the whole target by default) so that several games can share a window
+	void render(sf::RenderTarget *window, sf::FloatRect viewport = sf::FloatRect(0, 0, 1, 1)) {
+		// Lay out every quad again if the size of the viewport has changed, then update the moles that appeared, vanished or are animating
+		auto winSize = window->getSize();
+		sf::Vector2u size((unsigned)(winSize.x * viewport.width), (unsigned)(winSize.y * viewport.height));
+		if (size.x != layoutSize.x || size.y != layoutSize.y)
+			layout(size);
+		update_moles(m_clock->now());
+
+		// Draw in the coordinates of the viewport
+		sf::View view(sf::FloatRect(0, 0, (float)size.x, (float)size.y));
+		view.setViewport(viewport);
+		window->setView(view);
+		window->draw(vertices, sf::RenderStates(&textures->atlas));
+		window->setView(window->getDefaultView());
+	}
+
+	// Function to check whether a mole is animating, so that the board has to be drawn again even if the game has not changed
+	bool is_animating() {
+		return animating || m_clock->now() >= next_animation;
+	}
+
+	// Function to get the time at which the next animation starts (as of the last frame drawn), or the maximum time point if none is due
+	Clock::time_point get_next_animation() {
+		return next_animation;
+	}
+
+private:
+	const Board *board;
+	int x, y;
+	std::shared_ptr<GameTextures> textures;
+	sf::VertexArray vertices;
+	Clock *m_clock;
+	// Occupancy bitmask as of the last frame drawn, and bitmask of the mole quads that are not at rest
+	std::vector<uint64_t> drawn, moving;
+	// Time at which the mole at every location was seen to be whacked (the minimum time point if it was not)
+	std::vector<Clock::time_point> whacked_at;
+	// Whether a mole was animating in the last frame drawn, and the time at which the next animation starts
+	bool animating = false;
+	Clock::time_point next_animation = Clock::time_point::max();
+	sf::Vector2u layoutSize;
+	sf::Vector2f cellSize;
+	float side = 0;
+	// Fraction of the smaller side of a cell covered by a mole or hole
+	const float cell_fill = 0.9f;
+	// Durations of the pop-up, sink and squash animations
+	const Clock::duration pop_time = std::chrono::milliseconds(150), sink_time = std::chrono::milliseconds(250), squash_time = std::chrono::milliseconds(150);
+
+	// Function to get the centre of the cell at location x and y in window coordinates
+	sf::Vector2f cell_centre(int x, int y) {
+		return sf::Vector2f((x + 0.5f) * cellSize.x, (y + 0.5f) * cellSize.y);
+	}
+
+	// Function to set the quad starting at vertex v to cover a rectangle of the window with a region of the atlas
+	void set_quad(size_t v, sf::FloatRect rect, sf::FloatRect region) {
+		vertices[v + 0].position = sf::Vector2f(rect.left, rect.top);
+		vertices[v + 1].position = sf::Vector2f(rect.left + rect.width, rect.top);
+		vertices[v + 2].position = sf::Vector2f(rect.left + rect.width, rect.top + rect.height);
+		vertices[v + 3].position = sf::Vector2f(rect.left, rect.top + rect.height);
+		vertices[v + 0].texCoords = sf::Vector2f(region.left, region.top);
+		vertices[v + 1].texCoords = sf::Vector2f(region.left + region.width, region.top);
+		vertices[v + 2].texCoords = sf::Vector2f(region.left + region.width, region.top + region.height);
+		vertices[v + 3].texCoords = sf::Vector2f(region.left, region.top + region.height);
+	}
+
+	// Function to get the square of the window covered by the mole or hole of a cell index
+	sf::FloatRect cell_rect(int i) {
+		auto c = cell_centre(i % x, i / x);
+		return sf::FloatRect(c.x - 0.5f * side, c.y - 0.5f * side, side, side);
+	}
+
+	// Function to set the mole of a cell index, scaled horizontally and vertically about the bottom of its cell (a scale of 0 hides it by collapsing its quad, so it draws nothing)
+	void set_mole(int i, float sx, float sy) {
+		auto c = cell_centre(i % x, i / x);
+		float w = side * sx, h = side * sy, bottom = c.y + 0.5f * side;
+		set_quad(4 * (1 + (size_t)board->size() + i), sf::FloatRect(c.x - 0.5f * w, bottom - h, w, h), textures->mole);
+	}
+
+	// Function to get the fraction of an animation done at a time, from 0 at its start to 1 at its end
+	static float progress(Clock::time_point now, Clock::time_point start, Clock::duration length) {
+		return std::clamp(std::chrono::duration<float>(now - start).count() / std::chrono::duration<float>(length).count(), 0.0f, 1.0f);
+	}
+
+	// Function to ease an animation out with a small overshoot, from 0 at t = 0 to 1 at t = 1
+	static float ease_out_back(float t) {
+		const float c = 1.70158f;
+		return 1 + (c + 1) * (t - 1) * (t - 1) * (t - 1) + c * (t - 1) * (t - 1);
+	}
+
+	// Function to compute the cell size from the window and board sizes and lay out the background and hole quads. Every mole quad is rewritten by the next update.
+	void layout(sf::Vector2u winSize) {
+		layoutSize = winSize;
+		cellSize = sf::Vector2f((float)winSize.x / x, (float)winSize.y / y);
+		side = cell_fill * std::min(cellSize.x, cellSize.y);
+
+		set_quad(0, sf::FloatRect(0, 0, (float)winSize.x, (float)winSize.y), textures->fill);
+		for (int i = 0; i < board->size(); i++) {
+			set_quad(4 * (1 + (size_t)i), cell_rect(i), textures->hole);
+			moving[i / 64] |= uint64_t(1) << (i % 64);
+		}
+	}
+
+	// Function to rewrite the mole quads of the cells whose occupancy changed since the last frame or that are animating, found 64 cells at a time from the occupancy bitmask. A mole that vanished before its deadline was whacked.
+	void update_moles(Clock::time_point now) {
+		animating = false;
+		next_animation = Clock::time_point::max();
+		for (int w = 0; w < board->get_n_words(); w++) {
+			uint64_t bits = board->get_occupancy(w);
+			uint64_t dirty = bits ^ drawn[w];
+			drawn[w] = bits;
+
+			// Visit the moles, the cells that changed and the quads still moving (e.g. squashed moles)
+			uint64_t was_moving = moving[w];
+			uint64_t visit = bits | dirty | was_moving;
+			moving[w] = 0;
+			while (visit) {
+				int b = ctz64(visit);
+				int i = w * 64 + b;
+				visit &= visit - 1;
+
+				float sx = 1, sy = 1;
+				bool occupied = (bits >> b) & 1, changed = (dirty >> b) & 1, animated = true;
+				if (occupied) {
+					auto spawned = board->get_spawn_time(i), deadline = board->get_deadline(i);
+					if (changed)
+						whacked_at[i] = Clock::time_point::min();
+					if (now < spawned + pop_time) {
+						// Pop up out of the hole
+						sx = sy = ease_out_back(progress(now, spawned, pop_time));
+					} else if (now >= deadline - sink_time) {
+						// Sink into the hole, reaching it at the deadline
+						sy = 1 - progress(now, deadline - sink_time, sink_time);
+					} else {
+						animated = false;
+						next_animation = std::min(next_animation, deadline - sink_time);
+					}
+				} else {
+					if (changed && now < board->get_deadline(i))
+						whacked_at[i] = now;
+					if (now < whacked_at[i] + squash_time) {
+						// Squash flat into the hole
+						float t = progress(now, whacked_at[i], squash_time);
+						sx = 1 + 0.3f * t;
+						sy = 1 - t;
+					} else {
+						sx = sy = 0;
+						animated = false;
+					}
+				}
+
+				// Quads at rest are only rewritten when they change or come to rest
+				if (animated || changed || ((was_moving >> b) & 1))
+					set_mole(i, sx, sy);
+				if (animated) {
+					moving[w] |= uint64_t(1) << b;
+					animating = true;
+				}
+			}
+		}
+	}
+};
+
+#endif // GAMERENDERER_HPP
\ No newline at end of file
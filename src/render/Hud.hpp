@@ -0,0 +1,108 @@
+/*
+ * Filename: Hud.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing the score display of a station, redrawn only when a score changes.
+ */
+
+#if !defined(HUD_HPP)
+#define HUD_HPP
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <SFML/Graphics.hpp>
+
+// The Hud class displays the number of moles hit, missed and total and the average response time, aligned to the top right corner of an area of the window. Every value has a dirty bit, set only when the value changes, and only the texts of dirty values are formatted and laid out again. The texts are drawn into a cached texture whenever one of them changes, so a frame in which no value changed does no string or glyph work and draws a single sprite.
+class Hud {
+public:
+	// Constructor accepting the font, which must outlive the HUD, and the character size
+	Hud(const sf::Font &font, unsigned size = 24) {
+		for (int i = 0; i < N_VALUES; i++) {
+			texts[i].setFont(font);
+			texts[i].setFillColor(sf::Color::White);
+			texts[i].setCharacterSize(size);
+		}
+		this->line = font.getLineSpacing(size);
+	}
+
+	// Function to set the area of the window (in pixels) the HUD is aligned to, e.g. the viewport of the station
+	void set_area(sf::FloatRect area) {
+		this->area = area;
+		unsigned width = (unsigned)area.width, height = (unsigned)(N_VALUES * line + 2 * MARGIN);
+		if (width != cache.getSize().x || height != cache.getSize().y)
+			cache.create(width, height);
+		sprite.setTexture(cache.getTexture(), true);
+		sprite.setPosition(area.left, area.top);
+		dirty = ALL_DIRTY;
+		redraw = true;
+	}
+
+	// Function to set the values displayed, marking the values that changed as dirty
+	void update(int hit, int missed, int total, double hit_time) {
+		set(HIT, hit);
+		set(MISSED, missed);
+		set(TOTAL, total);
+		set(HIT_TIME, hit_time);
+	}
+
+	// Function to draw the HUD, laying out the dirty texts and redrawing the cached texture first if any value changed
+	void draw(sf::RenderTarget &target) {
+		if (dirty) {
+			for (int i = 0; i < N_VALUES; i++)
+				if (dirty & (1 << i))
+					layout(i);
+			dirty = 0;
+			redraw = true;
+		}
+		if (redraw) {
+			// Clear to transparent white, so that blending the white text into the texture does not darken its edges
+			cache.clear(sf::Color(255, 255, 255, 0));
+			for (int i = 0; i < N_VALUES; i++)
+				cache.draw(texts[i]);
+			cache.display();
+			redraw = false;
+		}
+		target.draw(sprite);
+	}
+
+private:
+	// Indices of the displayed values
+	enum { HIT, MISSED, TOTAL, HIT_TIME, N_VALUES };
+	static const uint8_t ALL_DIRTY = (1 << N_VALUES) - 1;
+	// Margin in pixels between the texts and the edges of the area
+	static constexpr float MARGIN = 10;
+
+	sf::Text texts[N_VALUES];
+	double values[N_VALUES] = { 0, 0, 0, 0 };
+	uint8_t dirty = ALL_DIRTY;
+	bool redraw = true;
+	float line;
+	sf::FloatRect area;
+	sf::RenderTexture cache;
+	sf::Sprite sprite;
+
+	// Function to store a value, setting its dirty bit if it changed
+	void set(int i, double value) {
+		if (value != values[i]) {
+			values[i] = value;
+			dirty |= 1 << i;
+		}
+	}
+
+	// Function to format the text of a value and align it to the right edge of the area
+	void layout(int i) {
+		static const char *labels[N_VALUES] = { "Hit: ", "Missed: ", "Total: ", "Average Response Time: " };
+		char buffer[64];
+		if (i == HIT_TIME)
+			std::snprintf(buffer, sizeof(buffer), "%s%0.2fms", labels[i], values[i]);
+		else
+			std::snprintf(buffer, sizeof(buffer), "%s%d", labels[i], (int)values[i]);
+		texts[i].setString(buffer);
+
+		auto bounds = texts[i].getLocalBounds();
+		texts[i].setPosition(area.width - bounds.left - bounds.width - MARGIN, MARGIN + i * line);
+	}
+};
+
+#endif // HUD_HPP
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*
+ * Filename: ProfilerOverlay.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing an overlay that graphs the frame times recorded by a frame profiler.
+ */
+
+#if !defined(PROFILEROVERLAY_HPP)
+#define PROFILEROVERLAY_HPP
+
+#include <cstdio>
+#include <string>
+#include <SFML/Graphics.hpp>
+#include "FrameProfiler.hpp"
+
+// Colours of the stages of a frame in the graph
+const sf::Color FRAME_STAGE_COLORS[N_RENDER_STAGES] = { sf::Color(0x4A90E2FF), sf::Color(0xF5A623FF), sf::Color(0x9B9B9BFF) };
+
+// The ProfilerOverlay class draws a rolling graph of the kept frames of a profiler in the bottom left corner of a target, one bar per frame stacked by stage, with a line at the budget of a 60 Hz frame and a legend of the mean time of every stage of a frame and the mean time per step of the gesture and simulation stages. The graph is one vertex array, and the legend is only formatted again every 'legend_period' frames.
+class ProfilerOverlay {
+public:
+	// Constructor accepting the font, which must outlive the overlay, and the profiler to graph
+	ProfilerOverlay(const sf::Font &font, FrameProfiler &profiler) : profiler(&profiler), graph(sf::Quads) {
+		legend.setFont(font);
+		legend.setCharacterSize(14);
+		legend.setFillColor(sf::Color::White);
+	}
+
+	// Function to toggle the overlay
+	void toggle() {
+		visible = !visible;
+	}
+
+	// Function to check whether the overlay is shown
+	bool is_visible() {
+		return visible;
+	}
+
+	// Function to draw the overlay to a target in its default view, if it is shown
+	void draw(sf::RenderTarget &target) {
+		if (!visible)
+			return;
+
+		auto size = target.getSize();
+		float left = margin, bottom = (float)size.y - margin;
+		size_t n = profiler->size();
+
+		// Panel, frame budget line and one stacked bar per frame
+		graph.clear();
+		quad(left - 4, bottom - height - 4, bar_width * profiler->capacity() + 8, height + 8, sf::Color(0, 0, 0, 160));
+		for (size_t k = 0; k < n; k++) {
+			const FrameRecord &r = profiler->get_frame(k);
+			float y = bottom;
+			for (int s = 0; s < N_RENDER_STAGES; s++) {
+				float h = std::min(r.stages[s] / 1000.0f * height / full_scale_ms, y - (bottom - height));
+				quad(left + k * bar_width, y - h, bar_width, h, FRAME_STAGE_COLORS[s]);
+				y -= h;
+			}
+		}
+		quad(left, bottom - height * 1000.0f / 60 / full_scale_ms, bar_width * profiler->capacity(), 1, sf::Color::White);
+		target.draw(graph);
+
+		// Update the legend every so often, so that it can be read
+		if (frames_since_legend++ % legend_period == 0) {
+			std::string text;
+			char line[64];
+			for (int s = 0; s < N_FRAME_STAGES; s++) {
+				if (FrameProfiler::is_step_stage((FrameStage)s))
+					std::snprintf(line, sizeof(line), "%s: %.3f ms/step\n", FRAME_STAGE_NAMES[s], profiler->get_mean((FrameStage)s));
+				else
+					std::snprintf(line, sizeof(line), "%s: %.2f ms\n", FRAME_STAGE_NAMES[s], profiler->get_mean((FrameStage)s));
+				text += line;
+			}
+			legend.setString(text);
+		}
+		legend.setPosition(left + bar_width * profiler->capacity() + 12, bottom - height);
+		target.draw(legend);
+	}
+
+private:
+	FrameProfiler *profiler;
+	sf::VertexArray graph;
+	sf::Text legend;
+	bool visible = false;
+	size_t frames_since_legend = 0;
+	// Size of the graph in pixels, the frame time at the top of the graph in milliseconds and the number of frames between legend updates
+	const float margin = 20, height = 120, bar_width = 2, full_scale_ms = 33.3f;
+	const size_t legend_period = 30;
+
+	// Function to append a rectangle of a colour to the graph
+	void quad(float x, float y, float w, float h, sf::Color color) {
+		graph.append(sf::Vertex(sf::Vector2f(x, y), color, sf::Vector2f()));
+		graph.append(sf::Vertex(sf::Vector2f(x + w, y), color, sf::Vector2f()));
+		graph.append(sf::Vertex(sf::Vector2f(x + w, y + h), color, sf::Vector2f()));
+		graph.append(sf::Vertex(sf::Vector2f(x, y + h), color, sf::Vector2f()));
+	}
+};
+
+#endif // PROFILEROVERLAY_HPP
\ No newline at end of file
@@ -0,0 +1,41 @@
+/*
+ * Filename: RedrawSignal.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing a signal that wakes the render loop when there is something new to draw.
+ */
+
+#if !defined(REDRAWSIGNAL_HPP)
+#define REDRAWSIGNAL_HPP
+
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+
+// The RedrawSignal class lets the render loop sleep while nothing changes instead of redrawing every display refresh. Any thread that changes what is drawn (e.g. the simulation step after applying a spawn, whack or expiry) notifies the signal, which wakes the render loop straight away.
+class RedrawSignal {
+public:
+	// Function to signal that there is something new to draw, from any thread
+	void notify() {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pending = true;
+		}
+		m_cv.notify_one();
+	}
+
+	// Function to sleep until the signal is notified or the timeout passes. Returns whether it was notified, and clears the signal.
+	bool wait_for(std::chrono::microseconds timeout) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		bool notified = m_cv.wait_for(lock, timeout, [&]() { return m_pending; });
+		m_pending = false;
+		return notified;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	bool m_pending = false;
+};
+
+#endif // REDRAWSIGNAL_HPP
\ No newline at end of file
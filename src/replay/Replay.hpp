@@ -0,0 +1,98 @@
+/*
+ * Filename: Replay.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Function for re-running a recorded game session headlessly from its replay log.
+ */
+
+#if !defined(REPLAY_HPP)
+#define REPLAY_HPP
+
+#include <string>
+#include <thread>
+#include <chrono>
+#include "ReplayLog.hpp"
+#include "../game/game.hpp"
+#include "../clock/Clock.hpp"
+
+// Struct for the result of a replay: whether the log was valid (a readable header and no corrupt records) and finished, its header, the counts recorded in the log and the counts of the replayed game, the number of records and the response time statistics of the replayed game
+typedef struct {
+	bool valid, complete;
+	ReplayHeader header;
+	ReplayFooter recorded, replayed;
+	size_t n_records;
+	ResponseStats stats;
+} ReplayResult;
+
+// Function to check whether a replay reproduced the recorded counts
+inline bool replay_matches(const ReplayResult &r) {
+	return r.valid && r.complete && r.recorded.n_whacked == r.replayed.n_whacked && r.recorded.n_missed == r.replayed.n_missed && r.recorded.n_total == r.replayed.n_total;
+}
+
+// Function to re-run the session recorded in a replay log on a manual clock. The spawns and whacks are applied to a new game in their recorded order, and the game removes its expired moles by itself at the recorded updates, so the replayed counts show whether the game logic reproduces the session. A speed of 0 runs as fast as possible, otherwise the replay is paced at that multiple of real time.
+inline ReplayResult replay_session(const std::string &path, double speed = 0) {
+	ReplayResult result = ReplayResult{};
+	ReplayReader reader(path);
+	result.valid = reader.is_valid();
+	if (!result.valid)
+		return result;
+	result.header = reader.get_header();
+
+	// Create the game on a manual clock with the recorded board size and mole lifetime
+	ManualClock clock;
+	Game game(result.header.width, result.header.height, clock);
+	game.set_mole_lifetime(std::chrono::nanoseconds(result.header.mole_lifetime));
+	game.set_game_over_callback([]() {});
+
+	auto origin = clock.now();
+	auto realStart = std::chrono::steady_clock::now();
+	// Advances the clock to a time of the log, unless it is already past it
+	auto advance = [&](Clock::time_point t) {
+		if (t <= clock.now())
+			return;
+		if (speed > 0)
+			std::this_thread::sleep_until(realStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>((t - origin) / speed));
+		clock.advance(t - clock.now());
+	};
+
+	ReplayRecord record;
+	while (reader.next(record)) {
+		result.n_records++;
+		auto t = origin + std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(record.time));
+		switch (record.type) {
+		// Lifetime changes apply to the moles spawned after them and carry no time
+		case ReplayEventType::Lifetime:
+			game.set_mole_lifetime(std::chrono::nanoseconds(record.time));
+			break;
+		// Spawns are placed where they were recorded, at the time of their update
+		case ReplayEventType::Spawn:
+			advance(t);
+			game.make_mole_at(record.x, record.y);
+			game.apply_posted();
+			break;
+		// Whacks keep their input time, which can be before records that were applied earlier, so the clock is not moved
+		case ReplayEventType::Whack:
+			game.whack_at(record.x, record.y, t);
+			game.apply_posted();
+			break;
+		// Moles are removed at the end of every recorded update, after the same events as in the session
+		case ReplayEventType::Update:
+			advance(t);
+			game.update();
+			break;
+		// Expiries are not fed, the game expires its moles when an update passes their deadlines
+		default:
+			break;
+		}
+	}
+
+	result.valid = !reader.is_corrupt();
+	result.complete = reader.has_footer();
+	result.recorded = reader.get_footer();
+	result.replayed = game.get_replay_footer();
+	result.stats = game.get_whack_stats();
+	game.stop();
+	return result;
+}
+
+#endif // REPLAY_HPP
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*
+ * Filename: ReplayLog.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Classes for writing and reading the compact binary event log of a game session.
+ */
+
+#if !defined(REPLAYLOG_HPP)
+#define REPLAYLOG_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include "../clock/Clock.hpp"
+
+// Types of the records in a replay log
+enum class ReplayEventType : uint8_t { Spawn = 1, Whack = 2, Expire = 3, End = 4, Lifetime = 5, Update = 6 };
+
+// Struct for a record of the replay log: the type, the location x and y on the board and the signed time in nanoseconds since the start of the session (negative for an input from before the start). Times are kept at the precision of the clock, so that a whack close to a deadline is judged the same way in a replay. Spawns are stamped with the time of the update that applied them. An Update record marks the end of an update that applied events or removed moles, with the time of the update, so that a replay applies the same events before removing the expired moles. For Lifetime records, which apply to the moles spawned after them, the time holds the new mole lifetime in nanoseconds instead.
+typedef struct {
+	ReplayEventType type;
+	uint16_t x, y;
+	int64_t time;
+} ReplayRecord;
+
+// Struct for the header of the replay log: the board size, the lifetime of a mole in nanoseconds, the seed of the random generator and the hash of the beat map (0 without a spawn plan)
+typedef struct {
+	int32_t width, height;
+	int64_t mole_lifetime;
+	uint64_t seed;
+	uint64_t beat_hash;
+} ReplayHeader;
+
+// Struct for the footer of the replay log, written after the End record: the final counts of the session
+typedef struct {
+	uint32_t n_whacked, n_missed, n_total;
+} ReplayFooter;
+
+// Magic number and version at the start of every replay log
+const char REPLAY_MAGIC[4] = { 'M', 'M', 'R', 'L' };
+const uint32_t REPLAY_VERSION = 3;
+
+// Largest number of locations on the board of a replay log that is accepted when reading it
+const int64_t REPLAY_MAX_CELLS = 1 << 20;
+
+// Largest width or height of the board of a replay log, since locations are stored in 16 bits
+const int32_t REPLAY_MAX_SIDE = 0xFFFF;
+
+// Size of an encoded record in bytes (type, x, y and time, little-endian and unpadded)
+const size_t REPLAY_RECORD_SIZE = 1 + 2 + 2 + 8;
+
+// Function to append an unsigned integer of n bytes to a buffer in little-endian order
+inline void put_le(std::vector<char> &buffer, uint64_t v, int n) {
+	for (int i = 0; i < n; i++)
+		buffer.push_back((char)((v >> (8 * i)) & 0xFF));
+}
+
+// Function to read an unsigned integer of n bytes in little-endian order from a stream. Returns false at the end of the stream.
+inline bool get_le(std::istream &in, uint64_t &v, int n) {
+	unsigned char bytes[8];
+	if (!in.read((char*)bytes, n))
+		return false;
+	v = 0;
+	for (int i = 0; i < n; i++)
+		v |= (uint64_t)bytes[i] << (8 * i);
+	return true;
+}
+
+// The ReplayWriter class encodes records into a buffer on the thread that owns the game state and hands full buffers to its own writer thread, so that the game never waits on the disk. Two buffers are swapped, so memory stays fixed however long the session is.
+class ReplayWriter {
+public:
+	// Constructor accepting the path of the log, its header, the clock the session is timed against and the number of records per block handed to the writer thread
+	ReplayWriter(const std::string &path, const ReplayHeader &header, Clock &clock = Clock::system(), size_t block = 4096) : file(path, std::ios::binary), m_clock(&clock), block(block * REPLAY_RECORD_SIZE) {
+		origin = m_clock->now();
+		front.reserve(this->block);
+		back.reserve(this->block);
+
+		// Write the header straight away, before the writer thread is started
+		std::vector<char> buffer(REPLAY_MAGIC, REPLAY_MAGIC + 4);
+		put_le(buffer, REPLAY_VERSION, 4);
+		put_le(buffer, (uint32_t)header.width, 4);
+		put_le(buffer, (uint32_t)header.height, 4);
+		put_le(buffer, (uint64_t)header.mole_lifetime, 8);
+		put_le(buffer, header.seed, 8);
+		put_le(buffer, header.beat_hash, 8);
+		file.write(buffer.data(), buffer.size());
+
+		m_thread = std::thread(&ReplayWriter::write, this);
+	}
+
+	// Destructor closes the log if it has not been closed
+	~ReplayWriter() {
+		close();
+	}
+
+	// Function to check whether the log file could be opened
+	bool is_open() {
+		return file.is_open();
+	}
+
+	// Function to record an event at a location and time. To be called from the thread that owns the game state only.
+	void record(ReplayEventType type, int x, int y, Clock::time_point time) {
+		put_le(front, (uint8_t)type, 1);
+		put_le(front, (uint16_t)x, 2);
+		put_le(front, (uint16_t)y, 2);
+		put_le(front, (uint64_t)(int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin).count(), 8);
+		if (front.size() >= block)
+			submit();
+	}
+
+	// Function to record a change of the mole lifetime (e.g. by a difficulty controller). To be called from the thread that owns the game state only.
+	void record_lifetime(std::chrono::nanoseconds lifetime) {
+		put_le(front, (uint8_t)ReplayEventType::Lifetime, 1);
+		put_le(front, 0, 2);
+		put_le(front, 0, 2);
+		put_le(front, (uint64_t)lifetime.count(), 8);
+		if (front.size() >= block)
+			submit();
+	}
+
+	// Function to get the time the session started at (times in the log are relative to it)
+	Clock::time_point get_origin() {
+		return origin;
+	}
+
+	// Function to end the log with the final counts of the session, flush it and stop the writer thread
+	void finish(const ReplayFooter &footer) {
+		if (finished)
+			return;
+		record(ReplayEventType::End, 0, 0, m_clock->now());
+		put_le(front, footer.n_whacked, 4);
+		put_le(front, footer.n_missed, 4);
+		put_le(front, footer.n_total, 4);
+		close();
+	}
+
+	// Function to flush the records and stop the writer thread (without writing the footer)
+	void close() {
+		if (finished)
+			return;
+		finished = true;
+		submit();
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_cv.notify_one();
+		if (m_thread.joinable())
+			m_thread.join();
+		file.close();
+	}
+
+private:
+	std::ofstream file;
+	Clock *m_clock;
+	Clock::time_point origin;
+	size_t block;
+	std::vector<char> front, back;
+	bool finished = false;
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	bool m_stop = false;
+
+	// Function to hand the front buffer to the writer thread, waiting only if the writer thread has not finished the previous block yet
+	void submit() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv.wait(lock, [&]() { return back.empty(); });
+		std::swap(front, back);
+		lock.unlock();
+		m_cv.notify_one();
+	}
+
+	// Function run by the writer thread, writing every block handed to it
+	void write() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (;;) {
+			m_cv.wait(lock, [&]() { return !back.empty() || m_stop; });
+			if (back.empty())
+				return;
+			// Write the block without holding the lock, then empty it for the next swap
+			lock.unlock();
+			file.write(back.data(), back.size());
+			lock.lock();
+			back.clear();
+			m_cv.notify_one();
+		}
+	}
+};
+
+// The ReplayReader class reads a replay log record by record
+class ReplayReader {
+public:
+	// Constructor accepting the path of the log. Reads and checks the header, including that the board size is positive, that its locations fit in a record and that it is not too large.
+	ReplayReader(const std::string &path) : file(path, std::ios::binary) {
+		char magic[4];
+		uint64_t version = 0, width = 0, height = 0, lifetime = 0;
+		valid = file.read(magic, 4) && std::equal(magic, magic + 4, REPLAY_MAGIC)
+			&& get_le(file, version, 4) && version == REPLAY_VERSION
+			&& get_le(file, width, 4) && get_le(file, height, 4) && get_le(file, lifetime, 8)
+			&& get_le(file, header.seed, 8) && get_le(file, header.beat_hash, 8);
+		header.width = (int32_t)width;
+		header.height = (int32_t)height;
+		header.mole_lifetime = (int64_t)lifetime;
+		valid = valid && header.width > 0 && header.height > 0 && header.width <= REPLAY_MAX_SIDE && header.height <= REPLAY_MAX_SIDE && (int64_t)header.width * header.height <= REPLAY_MAX_CELLS;
+	}
+
+	// Function to check whether the log has a valid header
+	bool is_valid() {
+		return valid;
+	}
+
+	// Function to get the header of the log
+	const ReplayHeader& get_header() {
+		return header;
+	}
+
+	// Function to read the next record. Returns false at the End record or the end of the file, and at a record of an unknown type or with a location that is not on the board, after which the log counts as corrupt. After the End record, the footer is available.
+	bool next(ReplayRecord &record) {
+		if (!valid || ended)
+			return false;
+		uint64_t type, x, y, time;
+		if (!get_le(file, type, 1) || !get_le(file, x, 2) || !get_le(file, y, 2) || !get_le(file, time, 8))
+			return false;
+		record = ReplayRecord{(ReplayEventType)type, (uint16_t)x, (uint16_t)y, (int64_t)time};
+		if (type < (uint64_t)ReplayEventType::Spawn || type > (uint64_t)ReplayEventType::Update || ((type == (uint64_t)ReplayEventType::Spawn || type == (uint64_t)ReplayEventType::Whack || type == (uint64_t)ReplayEventType::Expire) && (record.x >= header.width || record.y >= header.height))) {
+			corrupt = true;
+			return false;
+		}
+		if (record.type == ReplayEventType::End) {
+			uint64_t w = 0, m = 0, t = 0;
+			footer_read = get_le(file, w, 4) && get_le(file, m, 4) && get_le(file, t, 4);
+			footer = ReplayFooter{(uint32_t)w, (uint32_t)m, (uint32_t)t};
+			ended = true;
+			return false;
+		}
+		return true;
+	}
+
+	// Function to check whether a corrupt record has been read
+	bool is_corrupt() {
+		return corrupt;
+	}
+
+	// Function to check whether the End record and footer have been read (the log was finished, not cut off)
+	bool has_footer() {
+		return footer_read;
+	}
+
+	// Function to get the footer, after the End record has been read
+	const ReplayFooter& get_footer() {
+		return footer;
+	}
+
+private:
+	std::ifstream file;
+	ReplayHeader header = ReplayHeader{};
+	ReplayFooter footer = ReplayFooter{};
+	bool valid = false, ended = false, footer_read = false, corrupt = false;
+};
+
+#endif // REPLAYLOG_HPP
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+ * Filename: AudioClock.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class that extrapolates a coarse audio playing offset between updates using the steady clock.
+ */
+
+#if !defined(AUDIOCLOCK_HPP)
+#define AUDIOCLOCK_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include "../clock/Clock.hpp"
+
+// The AudioClock class reads the playing offset of an audio source (which only updates once per audio buffer) and extrapolates it between updates using the steady clock, so that beat times can be converted into predicted wall-clock times.
+class AudioClock {
+public:
+	// Constructor accepts a function returning the raw playing offset of the audio source, the audio output latency (i.e. the time between a sample being reported as played and it being heard) and the clock used to extrapolate.
+	AudioClock(std::function<std::chrono::microseconds()> offsetSource, std::chrono::microseconds latency = std::chrono::microseconds(0), Clock &clock = Clock::system()) : offsetSource(offsetSource), latency(latency), clock(clock) {
+		reset();
+	}
+
+	// Resets the anchor of the clock. To be called whenever playback is started, resumed or seeked.
+	void reset() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		anchorOffset = offsetSource();
+		anchorTime = clock.now();
+		lastRaw = anchorOffset;
+		lastPredicted = anchorOffset;
+	}
+
+	// Returns the offset of the audio currently being heard, extrapolated from the last update of the raw offset and compensated for output latency.
+	std::chrono::microseconds now() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return predict(clock.now()) - latency;
+	}
+
+	// Returns the predicted wall-clock time at which the given audio offset will be heard.
+	Clock::time_point toWallClock(std::chrono::microseconds audioOffset) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		predict(clock.now());
+		return anchorTime + std::chrono::duration_cast<Clock::duration>(audioOffset - anchorOffset + latency);
+	}
+
+	// Sets the audio output latency.
+	void setLatency(std::chrono::microseconds latency) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		this->latency = latency;
+	}
+
+	// Returns the audio output latency.
+	std::chrono::microseconds getLatency() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return latency;
+	}
+
+private:
+	std::function<std::chrono::microseconds()> offsetSource;
+	std::chrono::microseconds latency;
+	std::chrono::microseconds anchorOffset, lastRaw, lastPredicted;
+	Clock::time_point anchorTime;
+	Clock &clock;
+	std::mutex m_mutex;
+
+	// Maximum time to extrapolate past the last raw update, so that a paused or stalled source does not run away.
+	static constexpr std::chrono::microseconds maxExtrapolation = std::chrono::milliseconds(250);
+
+	// Reads the raw offset, re-anchors the clock if it has changed and returns the extrapolated (monotonic) offset at the given time. Must be called with the mutex held.
+	std::chrono::microseconds predict(Clock::time_point t) {
+		auto raw = offsetSource();
+		if (raw != lastRaw) {
+			lastRaw = raw;
+			anchorOffset = raw;
+			anchorTime = t;
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(t - anchorTime);
+		if (elapsed > maxExtrapolation)
+			elapsed = maxExtrapolation;
+
+		// Never report time going backwards unless the source itself was rewound by more than the extrapolation window
+		auto predicted = anchorOffset + elapsed;
+		if (predicted < lastPredicted && lastPredicted - predicted < maxExtrapolation)
+			predicted = lastPredicted;
+		lastPredicted = predicted;
+		return predicted;
+	}
+};
+
+#endif // AUDIOCLOCK_HPP
\ No newline at end of file
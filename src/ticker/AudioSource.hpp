@@ -0,0 +1,37 @@
+/*
+ * Filename: AudioSource.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Interface for the audio a musical ticker times its beats against.
+ */
+
+#if !defined(AUDIOSOURCE_HPP)
+#define AUDIOSOURCE_HPP
+
+#include <chrono>
+
+// The AudioSource class is the audio played by a MusicalTicker: it is started, paused and stopped with the ticker, and reports the offset it is playing at. The music file played in the game is one implementation (MusicFile), and a synthetic source can stand in for it, e.g. to benchmark the ticker headlessly.
+class AudioSource {
+public:
+	virtual ~AudioSource() {}
+
+	// Starts or resumes playing.
+	virtual void play() = 0;
+
+	// Pauses playing.
+	virtual void pause() = 0;
+
+	// Stops playing and rewinds to the start.
+	virtual void stop() = 0;
+
+	// Returns whether the source has stopped (e.g. at the end of the music).
+	virtual bool isStopped() = 0;
+
+	// Returns the offset being played. Like sf::Music, it may only advance once per audio buffer.
+	virtual std::chrono::microseconds getPlayingOffset() = 0;
+
+	// Returns the duration of the audio.
+	virtual std::chrono::microseconds getDuration() = 0;
+};
+
+#endif // AUDIOSOURCE_HPP
\ No newline at end of file
@@ -0,0 +1,180 @@
+/*
+ * Filename: ComposedTicker.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class deriving from the BaseTicker which merges several tick sources in timestamp order and calls the callback function for every event.
+ */
+
+#if !defined(COMPOSEDTICKER_HPP)
+#define COMPOSEDTICKER_HPP
+
+#include "baseticker.hpp"
+#include "TickSource.hpp"
+#include <chrono>
+#include <vector>
+#include <queue>
+#include <memory>
+#include <algorithm>
+
+// The ComposedTicker class derives from the BaseTicker class and merges any number of tick sources (beats, periodic, ramps) with a k-way merge on the single ticker thread, calling the callback function at the time of every merged event.
+class ComposedTicker : public BaseTicker {
+public:
+	// Constructor accepting the callback function. Sources are added with 'addSource'.
+	ComposedTicker(std::function<void()> callback) : BaseTicker(callback) {}
+
+	// Destructor stops the ticker thread before the sources are destroyed.
+	~ComposedTicker() {
+		BaseTicker::stop();
+	}
+
+	// Adds a tick source to be merged. Must be called while the ticker is not running.
+	void addSource(std::unique_ptr<TickSource> source) {
+		sources.push_back(std::move(source));
+		rewind();
+	}
+
+	// Sets the minimum time between two events. Events closer than this to the previous event are dropped, so that coinciding sources do not fire twice.
+	void setMinSpacing(std::chrono::microseconds spacing) {
+		minSpacing = spacing;
+	}
+
+	// Sets the floor period. If no source produces an event for this long, an extra event is produced (zero to disable).
+	void setFloorPeriod(std::chrono::microseconds period) {
+		floorPeriod = period;
+	}
+
+	// Returns the merged times of all events up to the given horizon. Must be called while the ticker is not running.
+	std::vector<std::chrono::microseconds> schedule(std::chrono::microseconds horizon) {
+		std::vector<std::chrono::microseconds> times;
+		rewind();
+		std::chrono::microseconds t;
+		while (nextEvent(t) && t <= horizon)
+			times.push_back(t);
+		rewind();
+		return times;
+	}
+
+	// Returns the time of the event the callback was last called for (to be used from within the callback).
+	std::chrono::microseconds getCurrentTick() {
+		return current;
+	}
+
+	// 'Start' function overrided for starting (or resuming) the timeline
+	void start() {
+		auto now = m_clock->now();
+		if (!started)
+			origin = now;
+		else if (paused)
+			origin += now - pausedAt;
+		started = true;
+		paused = false;
+		BaseTicker::start();
+	}
+
+	// 'Pause' function overrided for pausing the timeline
+	void pause() {
+		BaseTicker::pause();
+		pausedAt = m_clock->now();
+		paused = true;
+	}
+
+	// Implementation of the virtual 'run' function that takes the next merged event, sleeps until its predicted wall-clock time and calls the callback function.
+	void run() {
+		// Take the next event from the merge. If all sources are exhausted, stop the ticker.
+		if (!pending) {
+			if (!nextEvent(next)) {
+				BaseTicker::stop();
+				return;
+			}
+			pending = true;
+		}
+
+		// Skip events that were missed by more than the maximum lateness, so that they do not fire in a burst.
+		if (next + maxLateness < timelineNow()) {
+			pending = false;
+			return;
+		}
+
+		// Sleep until the predicted wall-clock time of the event, waking up at least every poll period to follow the timeline.
+		auto wake = m_clock->now() + pollPeriod;
+		m_clock->sleep_until(std::min(toWallClock(next), wake));
+
+		// If the event is now due, call the callback function directly on the ticker thread.
+		if (timelineNow() >= next) {
+			pending = false;
+			current = next;
+			if (m_telemetry)
+				m_telemetry->record(toWallClock(next), m_clock->now());
+			m_callback();
+		}
+	}
+
+protected:
+	std::vector<std::unique_ptr<TickSource>> sources;
+
+	// Returns the current time on the ticker's timeline. Defaults to the time of the ticker's clock since the ticker was started, excluding pauses.
+	virtual std::chrono::microseconds timelineNow() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(m_clock->now() - origin);
+	}
+
+	// Returns the time of the ticker's clock at which the given time on the timeline occurs.
+	virtual Clock::time_point toWallClock(std::chrono::microseconds time) {
+		return origin + std::chrono::duration_cast<Clock::duration>(time);
+	}
+
+	// Rewinds all sources and the merge state to the start.
+	void rewind() {
+		heap = decltype(heap)();
+		for (size_t i = 0; i < sources.size(); i++) {
+			sources[i]->reset();
+			std::chrono::microseconds t;
+			if (sources[i]->peek(t))
+				heap.push(std::make_pair(t, i));
+		}
+		last = std::chrono::microseconds(-1);
+		pending = false;
+	}
+
+	// Produces the next merged event, applying the minimum spacing and the floor period. Returns false if all sources are exhausted.
+	bool nextEvent(std::chrono::microseconds &time) {
+		while (!heap.empty()) {
+			// Pop the earliest event and push the next event of the same source
+			auto [t, i] = heap.top();
+
+			// Produce a floor event if the gap to the next event is too long
+			if (floorPeriod.count() > 0 && last.count() >= 0 && t - last > floorPeriod) {
+				last += floorPeriod;
+				time = last;
+				return true;
+			}
+
+			heap.pop();
+			sources[i]->pop();
+			std::chrono::microseconds n;
+			if (sources[i]->peek(n))
+				heap.push(std::make_pair(n, i));
+
+			// Drop events closer than the minimum spacing to the previous event
+			if (last.count() >= 0 && t - last < minSpacing)
+				continue;
+
+			last = t;
+			time = t;
+			return true;
+		}
+		return false;
+	}
+
+private:
+	std::priority_queue<std::pair<std::chrono::microseconds, size_t>, std::vector<std::pair<std::chrono::microseconds, size_t>>, std::greater<std::pair<std::chrono::microseconds, size_t>>> heap;
+	std::chrono::microseconds minSpacing = std::chrono::microseconds(0), floorPeriod = std::chrono::microseconds(0);
+	std::chrono::microseconds last = std::chrono::microseconds(-1), next, current = std::chrono::microseconds(0);
+	Clock::time_point origin, pausedAt;
+	bool pending = false, started = false, paused = false;
+
+	// Maximum time to sleep before re-reading the timeline, and maximum lateness after which an event is skipped
+	static constexpr std::chrono::milliseconds pollPeriod = std::chrono::milliseconds(10);
+	static constexpr std::chrono::milliseconds maxLateness = std::chrono::milliseconds(50);
+};
+
+#endif // COMPOSEDTICKER_HPP
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+ * Filename: MusicFile.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Audio source playing a music file, and function creating a musical ticker for the beats detected in a music file.
+ */
+
+#if !defined(MUSICFILE_HPP)
+#define MUSICFILE_HPP
+
+#include "MusicalTicker.hpp"
+#include "AudioSource.hpp"
+#include <string>
+#include <memory>
+#include <SFML/Audio.hpp>
+#include "../beat_detection/beat_detection.hpp"
+
+// The MusicFile class is an audio source streaming a music file with SFML
+class MusicFile : public AudioSource {
+public:
+	// Constructor accepting the path of the music file
+	MusicFile(std::string filename) {
+		music.openFromFile(filename);
+	}
+
+	void play() {
+		music.play();
+	}
+
+	void pause() {
+		music.pause();
+	}
+
+	void stop() {
+		music.stop();
+	}
+
+	bool isStopped() {
+		return music.getStatus() == sf::SoundSource::Stopped;
+	}
+
+	std::chrono::microseconds getPlayingOffset() {
+		return std::chrono::microseconds(music.getPlayingOffset().asMicroseconds());
+	}
+
+	std::chrono::microseconds getDuration() {
+		return std::chrono::microseconds(music.getDuration().asMicroseconds());
+	}
+
+private:
+	sf::Music music;
+};
+
+// Function to create a musical ticker that calls the callback function when a beat occurs in a music file. Reads the music file and performs beat detection with the given parameters, then plays the file with the given audio output latency.
+inline std::unique_ptr<MusicalTicker> loadMusicalTicker(std::string filename, std::function<void()> callback, std::chrono::microseconds analysisPeriod, double lowFreq, double highFreq, double threshold, std::chrono::microseconds ignorePeriod, std::chrono::microseconds latency = std::chrono::microseconds(0)) {
+	sf::SoundBuffer buf;
+	buf.loadFromFile(filename);
+	auto beats = detectBeatTimes(buf, analysisPeriod, lowFreq, highFreq, threshold, ignorePeriod);
+	return std::make_unique<MusicalTicker>(std::make_unique<MusicFile>(filename), beats, callback, latency);
+}
+
+#endif // MUSICFILE_HPP
\ No newline at end of file
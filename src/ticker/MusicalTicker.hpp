@@ -2,84 +2,120 @@
  * Filename: MusicalTicker.hpp
  * Author: Malolan Venkataraghavan
  * 
- * Class deriving from the BaseTicker which calls the callback function when a beat occurs in a specified music file.
+ * Class deriving from the ComposedTicker which calls the callback function when a beat occurs in the music being played.
  */
 
 #if !defined(MUSICALTICKER_HPP)
 #define MUSICALTICKER_HPP
 
-#include "baseticker.hpp"
+#include "ComposedTicker.hpp"
+#include "AudioClock.hpp"
+#include "AudioSource.hpp"
 #include <chrono>
 #include <vector>
-#include <SFML/Audio.hpp>
-#include "../beat_detection/beat_detection.hpp"
-#include <future>
+#include <memory>
 
-// MusicalTicker class deriving from the BaseTicker class that calls the callback function when a beat occurs in a specified music file.
-class MusicalTicker : public BaseTicker {
+// MusicalTicker class deriving from the ComposedTicker class that calls the callback function when a beat occurs in the music played by an audio source. Further tick sources can be added to be merged with the beats, all timed against the music. A ticker for a music file, with its beats detected, is created by loadMusicalTicker (MusicFile.hpp).
+class MusicalTicker : public ComposedTicker {
 public:
-	// Constructor accepts path of the music file, callback function, and the parameters required for beat detection. Reads the music file, performs beat detection and stores the times at which beats occur.
-	MusicalTicker(std::string filename, std::function<void()> callback, std::chrono::microseconds analysisPeriod, double lowFreq, double highFreq, double threshold, std::chrono::microseconds ignorePeriod) : BaseTicker(callback), analysisPeriod(analysisPeriod), lowFreq(lowFreq), highFreq(highFreq), threshold(threshold), ignorePeriod(ignorePeriod) {
-		sf::SoundBuffer buf;
-		buf.loadFromFile(filename);
-		this->beats = detectBeatTimes(buf, analysisPeriod, lowFreq, highFreq, threshold, ignorePeriod);
+	// Constructor accepts the audio source to play, the times of the beats in it, the callback function and the audio output latency. Adds the beats as the first tick source.
+	MusicalTicker(std::unique_ptr<AudioSource> audio, std::vector<std::chrono::microseconds> beats, std::function<void()> callback, std::chrono::microseconds latency = std::chrono::microseconds(0)) : ComposedTicker(callback), audio(std::move(audio)), beats(beats) {
+		makeAudioClock(latency);
 
-		this->music.openFromFile(filename);
+		addSource(std::make_unique<BeatSource>(this->beats));
+	}
+
+	// Destructor stops the ticker thread before the audio source is destroyed.
+	~MusicalTicker() {
+		BaseTicker::stop();
 	}
 
 	// 'Start' function overrided for starting the music
 	void start() {
+		this->audio->play();
+		this->audioClock->reset();
 		BaseTicker::start();
-		this->music.play();
 	}
 
-	// Implementation of the virtual 'run' function the gets the current offset of the music playing, checks if a beat is currently occuring and calls the callback function if true.
+	// Implementation of the virtual 'run' function that stops the ticker when the music has ended, and otherwise runs the merge of the tick sources against the audio clock.
 	void run() {
-		// Retrieve the offset of the currently playing music in microseconds.
-		int offset = music.getPlayingOffset().asMicroseconds();
-		
-		// Check if the music has ended by checking if the offset is greater or equal to the maximum song duration or the status of music is stopped. If so, stop the ticker.
-		if (offset >= music.getDuration().asMicroseconds() || music.getStatus() == sf::SoundSource::Stopped)
-			stop();
-		
-		// Check whether the last beat time has passed, and if so, update the lastBeat counter.
-		bool e = false;
-		int max_beats = beats.size();
-		while (beats[lastBeat].count() <= offset) {
-			lastBeat = lastBeat + 1 % max_beats;
-			if (music.getStatus() == sf::SoundSource::Stopped)
-				break;
-			e = true;
+		// Check if the music has ended by checking the status of the audio source. If so, stop the ticker.
+		if (audio->isStopped()) {
+			BaseTicker::stop();
+			return;
 		}
-		lastBeat -= e;
 
-		// If the current offset is greater than last beat time and less than 2000 microseconds after the last beat time.
-		auto b = beats[lastBeat].count();
-		if (offset >= b && offset <= (b + 2000)) {
-			auto ret = std::async(std::launch::async, m_callback);
-			lastBeat++;
-		}
+		ComposedTicker::run();
 	}
 
 	// 'Stop' function overrided for stopping the music
 	void stop() {
 		BaseTicker::stop();
-		this->music.stop();
+		this->audio->stop();
 	}
 
 	// 'Pause' function overrided for pausing the music
 	void pause() {
-		this->music.pause();
+		this->audio->pause();
 		BaseTicker::pause();
 	}
 
+	// Sets the audio output latency used to predict when a beat is heard.
+	void setLatency(std::chrono::microseconds latency) {
+		audioClock->setLatency(latency);
+	}
+
+	// 'SetClock' function overrided for rebuilding the audio clock on the new clock, so that the audio offsets are extrapolated and converted on the same time base the ticker sleeps on. Must be called while the ticker is not running.
+	void setClock(Clock &clock) {
+		BaseTicker::setClock(clock);
+		makeAudioClock(audioClock->getLatency());
+	}
+
+	// Only calls the callback function on every Nth beat. Must be called while the ticker is not running.
+	void setBeatDivisor(int every) {
+		sources[0] = std::make_unique<BeatSource>(beats, every);
+		rewind();
+	}
+
+	// Returns the times at which beats occur in the music.
+	const std::vector<std::chrono::microseconds>& getBeats() {
+		return beats;
+	}
+
+	// Returns the time of the beat (or other tick) the callback was last called for (to be used from within the callback).
+	std::chrono::microseconds getCurrentBeat() {
+		return getCurrentTick();
+	}
+
+	// Returns the merged times of all ticks within the duration of the music.
+	std::vector<std::chrono::microseconds> getSchedule() {
+		return schedule(audio->getDuration());
+	}
+
+	// Returns the offset of the music currently being heard, as predicted by the audio clock.
+	std::chrono::microseconds getOffset() {
+		return audioClock->now();
+	}
+
+protected:
+	// The timeline of a musical ticker is the music as heard by the player.
+	std::chrono::microseconds timelineNow() {
+		return audioClock->now();
+	}
+
+	Clock::time_point toWallClock(std::chrono::microseconds time) {
+		return audioClock->toWallClock(time);
+	}
+
 private:
-	std::chrono::microseconds analysisPeriod, ignorePeriod;
-	std::string filename;
-	double lowFreq, highFreq, threshold;
-	sf::Music music;
+	std::unique_ptr<AudioSource> audio;
+	std::unique_ptr<AudioClock> audioClock;
 	std::vector<std::chrono::microseconds> beats;
-	int lastBeat = 0;
+
+	// Function to build the audio clock reading the audio source's playing offset, extrapolated on the ticker's clock
+	void makeAudioClock(std::chrono::microseconds latency) {
+		audioClock = std::make_unique<AudioClock>([this]() { return audio->getPlayingOffset(); }, latency, *m_clock);
+	}
 };
 
 #endif // MUSICALTICKER_HPP
\ No newline at end of file
@@ -19,14 +19,32 @@ public:
 		m_period = std::chrono::milliseconds(millis);
 	}
 
-	// Implementation of the virutal 'run' function which calls the callback function and then sleeps for the specified period.
+	// The constructor accepting a finer period (e.g. for a fixed-rate simulation step that is not a whole number of milliseconds) and the callback function.
+	PeriodicTicker(std::chrono::microseconds period, std::function<void()> callback) : BaseTicker(callback) {
+		m_period = period;
+	}
+
+	// 'Start' function overrided for resetting the time of the first tick used by the telemetry
+	void start() {
+		m_next = m_clock->now();
+		BaseTicker::start();
+	}
+
+	// Implementation of the virutal 'run' function which sleeps until the next tick is due and then calls the callback function.
 	void run() {
+		m_clock->sleep_until(m_next);
+		// The clock may wake up early (e.g. a manual clock), in which case try again
+		if (m_clock->now() < m_next)
+			return;
+		if (m_telemetry)
+			m_telemetry->record(m_next, m_clock->now());
 		m_callback();
-		std::this_thread::sleep_for(m_period);
+		m_next += m_period;
 	}
 
 private:
-	std::chrono::milliseconds m_period;
+	std::chrono::microseconds m_period;
+	Clock::time_point m_next;
 };
 
 #endif // PERIODICTICKER_HPP
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+ * Filename: ProcessCpuTime.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Function for reading the CPU time used by the process.
+ */
+
+#if !defined(PROCESSCPUTIME_HPP)
+#define PROCESSCPUTIME_HPP
+
+#include <chrono>
+
+#ifdef _WIN32
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <sys/resource.h>
+#endif
+
+// Function returning the CPU time (user + system) used by the process so far
+inline std::chrono::microseconds processCpuTime() {
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+	auto toMicros = [](FILETIME f) { return ((((unsigned long long)f.dwHighDateTime) << 32) | f.dwLowDateTime) / 10; };
+	return std::chrono::microseconds(toMicros(kernel) + toMicros(user));
+#else
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return std::chrono::seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + std::chrono::microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+#endif
+}
+
+#endif // PROCESSCPUTIME_HPP
\ No newline at end of file
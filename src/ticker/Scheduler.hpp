@@ -0,0 +1,140 @@
+/*
+ * Filename: Scheduler.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class implementing a shared pool of worker threads that run periodic tasks.
+ */
+
+#if !defined(SCHEDULER_HPP)
+#define SCHEDULER_HPP
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <queue>
+#include <memory>
+#include <algorithm>
+#include "../clock/Clock.hpp"
+
+// The Scheduler class runs any number of periodic tasks (e.g. the simulation steps of several games) on a fixed pool of worker threads, so that the number of threads does not grow with the number of tasks. The tasks are kept in a deadline queue and the next due task is run by the first free worker. A task is never run by two workers at once, so a task may own state without locking.
+class Scheduler {
+public:
+	// Constructor accepting the number of worker threads and the clock the tasks are run by
+	Scheduler(unsigned workers = std::max(1u, std::thread::hardware_concurrency()), Clock &clock = Clock::system()) : m_clock(&clock) {
+		for (unsigned i = 0; i < std::max(1u, workers); i++)
+			m_workers.push_back(std::thread(&Scheduler::work, this));
+	}
+
+	// Destructor stops the worker threads
+	~Scheduler() {
+		stop();
+	}
+
+	// Adds a task that is run every period, starting now (or when it is resumed, if it is added paused), and returns its index. A task that falls behind (e.g. after a slow run, a stall or a system suspend) skips the periods it missed instead of being run back to back, so that it cannot take over a worker.
+	size_t every(std::chrono::microseconds period, std::function<void()> callback, bool paused = false) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_tasks.push_back(std::unique_ptr<Task>(new Task{period, callback, paused, !paused}));
+		if (!paused) {
+			m_queue.push(std::make_pair(m_clock->now(), m_tasks.size() - 1));
+			m_cv.notify_one();
+		}
+		return m_tasks.size() - 1;
+	}
+
+	// Pauses a task, so that it is not run again until it is resumed (e.g. while it has nothing to do). A task may pause itself from its callback.
+	void pause(size_t task) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_tasks[task]->paused = true;
+	}
+
+	// Resumes a paused task, running it straight away unless it is running already (from any thread)
+	void resume(size_t task) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Task *t = m_tasks[task].get();
+		t->paused = false;
+		if (t->scheduled)
+			return;
+		t->scheduled = true;
+		m_queue.push(std::make_pair(m_clock->now(), task));
+		m_cv.notify_one();
+	}
+
+	// Stops the worker threads after their current tasks and waits for them to exit. No task is run after this returns.
+	void stop() {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_cv.notify_all();
+		for (auto &t : m_workers)
+			if (t.joinable())
+				t.join();
+	}
+
+	// Returns the number of worker threads
+	size_t getWorkers() {
+		return m_workers.size();
+	}
+
+private:
+	// Struct for a periodic task: its period and callback function, whether it is paused and whether it is in the queue or running
+	struct Task {
+		std::chrono::microseconds period;
+		std::function<void()> callback;
+		bool paused, scheduled;
+	};
+
+	typedef std::pair<Clock::time_point, size_t> Entry;
+
+	Clock *m_clock;
+	std::vector<std::unique_ptr<Task>> m_tasks;
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> m_queue;
+	std::vector<std::thread> m_workers;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	bool m_stop = false;
+
+	// Function run by every worker thread: waits for the earliest task to be due, takes it off the queue while running it and puts it back with its next due time
+	void work() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (!m_stop) {
+			if (m_queue.empty()) {
+				m_cv.wait(lock);
+				continue;
+			}
+
+			auto [due, i] = m_queue.top();
+			if (m_clock->now() < due) {
+				m_clock->wait_until(m_cv, lock, due);
+				continue;
+			}
+			m_queue.pop();
+
+			// Run the task without holding the lock, so that other workers can run other tasks. A paused task is left out of the queue until it is resumed.
+			Task *task = m_tasks[i].get();
+			if (!task->paused) {
+				lock.unlock();
+				task->callback();
+				lock.lock();
+			}
+			if (task->paused) {
+				task->scheduled = false;
+				continue;
+			}
+
+			// Schedule the next run in the first period that has not started yet
+			auto next = due + task->period;
+			auto now = m_clock->now();
+			if (next <= now)
+				next += ((now - next) / task->period + 1) * task->period;
+			m_queue.push(std::make_pair(next, i));
+			// Wake a worker in case it is waiting for a later task or for an empty queue
+			m_cv.notify_one();
+		}
+	}
+};
+
+#endif // SCHEDULER_HPP
\ No newline at end of file
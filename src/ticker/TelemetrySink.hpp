@@ -0,0 +1,25 @@
+/*
+ * Filename: TelemetrySink.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Interface for recording the dispatches and wakeups of a ticker.
+ */
+
+#if !defined(TELEMETRYSINK_HPP)
+#define TELEMETRYSINK_HPP
+
+#include <chrono>
+
+// The TelemetrySink interface receives the dispatches and wakeups of a ticker (e.g. TickerTelemetry). The tickers only depend on this interface, so that including a ticker does not pull in the platform headers used to measure CPU time.
+class TelemetrySink {
+public:
+	virtual ~TelemetrySink() {}
+
+	// Records a dispatch. Called from the ticker thread only.
+	virtual void record(std::chrono::steady_clock::time_point scheduled, std::chrono::steady_clock::time_point actual) = 0;
+
+	// Records a wakeup of the ticker thread
+	virtual void wakeup() = 0;
+};
+
+#endif // TELEMETRYSINK_HPP
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*
+ * Filename: TickSource.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Classes implementing sources of tick events that can be merged by a ComposedTicker.
+ */
+
+#if !defined(TICKSOURCE_HPP)
+#define TICKSOURCE_HPP
+
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+// Base class for a source of tick events. A source produces the times of its events (offsets from the start of the ticker) in non-decreasing order.
+class TickSource {
+public:
+	virtual ~TickSource() {}
+
+	// Returns true and sets 'time' to the time of the next event, or returns false if the source is exhausted.
+	virtual bool peek(std::chrono::microseconds &time) = 0;
+
+	// Consumes the next event.
+	virtual void pop() = 0;
+
+	// Rewinds the source to its first event.
+	virtual void reset() = 0;
+};
+
+// Tick source producing every Nth beat of a precomputed list of beat times.
+class BeatSource : public TickSource {
+public:
+	// Constructor accepts the beat times and the divisor N (1 uses every beat).
+	BeatSource(const std::vector<std::chrono::microseconds> &beats, int every = 1) : beats(beats), every(std::max(every, 1)) {}
+
+	bool peek(std::chrono::microseconds &time) {
+		if (index >= beats.size())
+			return false;
+		time = beats[index];
+		return true;
+	}
+
+	void pop() {
+		index += every;
+	}
+
+	void reset() {
+		index = 0;
+	}
+
+private:
+	std::vector<std::chrono::microseconds> beats;
+	size_t every;
+	size_t index = 0;
+};
+
+// Tick source producing events at a fixed period between a start and (optional) end time.
+class PeriodicSource : public TickSource {
+public:
+	// Constructor accepts the period, the time of the first event and the time after which no events are produced (zero for no end).
+	PeriodicSource(std::chrono::microseconds period, std::chrono::microseconds start = std::chrono::microseconds(0), std::chrono::microseconds end = std::chrono::microseconds(0)) : period(period), start(start), end(end), next(start) {}
+
+	bool peek(std::chrono::microseconds &time) {
+		if (end.count() > 0 && next > end)
+			return false;
+		time = next;
+		return true;
+	}
+
+	void pop() {
+		next += period;
+	}
+
+	void reset() {
+		next = start;
+	}
+
+private:
+	std::chrono::microseconds period, start, end, next;
+};
+
+// Tick source whose period changes linearly from a start period to an end period over the ramp duration (a difficulty curve), then stays at the end period.
+class RampSource : public TickSource {
+public:
+	// Constructor accepts the initial period, the final period and the duration of the ramp.
+	RampSource(std::chrono::microseconds startPeriod, std::chrono::microseconds endPeriod, std::chrono::microseconds duration) : startPeriod(startPeriod), endPeriod(endPeriod), duration(duration) {}
+
+	bool peek(std::chrono::microseconds &time) {
+		time = next;
+		return true;
+	}
+
+	void pop() {
+		// Interpolate the period at the time of the current event
+		double f = (duration.count() > 0) ? std::min(1.0, (double)next.count() / duration.count()) : 1.0;
+		next += std::chrono::microseconds((long long)(startPeriod.count() + f * (endPeriod.count() - startPeriod.count())));
+	}
+
+	void reset() {
+		next = std::chrono::microseconds(0);
+	}
+
+private:
+	std::chrono::microseconds startPeriod, endPeriod, duration;
+	std::chrono::microseconds next = std::chrono::microseconds(0);
+};
+
+#endif // TICKSOURCE_HPP
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+ * Filename: TickerTelemetry.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Class for recording the scheduled and actual dispatch times of a ticker and reporting its jitter, CPU usage and wakeups.
+ */
+
+#if !defined(TICKERTELEMETRY_HPP)
+#define TICKERTELEMETRY_HPP
+
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <ctime>
+#include "TelemetrySink.hpp"
+#include "ProcessCpuTime.hpp"
+
+// Struct for a single dispatch record: the time the callback was scheduled for and the time it was actually called
+typedef struct {
+	std::chrono::steady_clock::time_point scheduled, actual;
+} TickRecord;
+
+// Struct for the summary of the recorded telemetry
+typedef struct {
+	size_t n;
+	std::chrono::microseconds p50, p99, max;
+	double cpuUsage;
+	double wakeupsPerSecond;
+} TickerReport;
+
+// The TickerTelemetry class records dispatches into a ring buffer that is allocated up front, so that recording does not allocate on the ticker thread. Only the most recent 'capacity' dispatches are kept.
+class TickerTelemetry : public TelemetrySink {
+public:
+	// Constructor accepting the capacity of the ring buffer
+	TickerTelemetry(size_t capacity = 4096) : records(capacity) {
+		begin();
+	}
+
+	// Starts (or restarts) the measurement period
+	void begin() {
+		count = 0;
+		wakeups = 0;
+		startTime = std::chrono::steady_clock::now();
+		startCpu = processCpuTime();
+	}
+
+	// Records a dispatch. To be called from the ticker thread only.
+	void record(std::chrono::steady_clock::time_point scheduled, std::chrono::steady_clock::time_point actual) {
+		size_t i = count.load(std::memory_order_relaxed);
+		records[i % records.size()] = TickRecord{scheduled, actual};
+		count.store(i + 1, std::memory_order_release);
+	}
+
+	// Records a wakeup of the ticker thread
+	void wakeup() {
+		wakeups.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Computes the summary of the measurement period so far. The jitter is the absolute difference between the scheduled and actual dispatch times.
+	TickerReport report() {
+		auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+		auto cpu = std::chrono::duration<double>(processCpuTime() - startCpu).count();
+
+		size_t n = std::min(count.load(std::memory_order_acquire), records.size());
+		std::vector<std::chrono::microseconds> jitter(n);
+		for (size_t i = 0; i < n; i++) {
+			auto d = std::chrono::duration_cast<std::chrono::microseconds>(records[i].actual - records[i].scheduled);
+			jitter[i] = (d.count() < 0) ? -d : d;
+		}
+		std::sort(jitter.begin(), jitter.end());
+
+		TickerReport r = TickerReport{};
+		r.n = n;
+		if (n > 0) {
+			r.p50 = jitter[(n - 1) * 50 / 100];
+			r.p99 = jitter[(n - 1) * 99 / 100];
+			r.max = jitter[n - 1];
+		}
+		r.cpuUsage = (elapsed > 0) ? cpu / elapsed : 0;
+		r.wakeupsPerSecond = (elapsed > 0) ? wakeups / elapsed : 0;
+		return r;
+	}
+
+	// Prints the summary to the given stream with a name for the ticker
+	void print(std::string name, std::ostream &out = std::cout) {
+		auto r = report();
+		out << name << ": " << r.n << " ticks"
+			<< ", jitter p50 " << r.p50.count() << " us"
+			<< ", p99 " << r.p99.count() << " us"
+			<< ", max " << r.max.count() << " us"
+			<< ", CPU " << r.cpuUsage * 100 << "%"
+			<< ", " << r.wakeupsPerSecond << " wakeups/s"
+			<< std::endl;
+	}
+
+private:
+	std::vector<TickRecord> records;
+	std::atomic<size_t> count;
+	std::atomic<size_t> wakeups;
+	std::chrono::steady_clock::time_point startTime;
+	std::chrono::microseconds startCpu;
+};
+
+#endif // TICKERTELEMETRY_HPP
\ No newline at end of file
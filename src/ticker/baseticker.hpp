@@ -11,6 +11,9 @@
 #include <iostream>
 #include <thread>
 #include <functional>
+#include <atomic>
+#include "TelemetrySink.hpp"
+#include "../clock/Clock.hpp"
 
 // Implements a BaseTicker class
 class BaseTicker {
@@ -21,15 +24,16 @@ public:
 	}
 
 	// Destructor of ticker object calls the stop function to terminate the thread.
-	~BaseTicker() {
+	virtual ~BaseTicker() {
 		stop();
 	}
 
-	// The stop function that instructs the thread to stop and then waits for the thread to exit.
-	void stop() {
+	// The stop function that instructs the thread to stop and then waits for the thread to exit (unless called from the ticker thread itself).
+	virtual void stop() {
 		m_running = false;
 		m_stop = true;
-		m_thread.join();
+		if (m_thread.joinable() && m_thread.get_id() != std::this_thread::get_id())
+			m_thread.join();
 	}
 
 	// The virtual 'run' function to be implemented in the derived class which executes the required logic of the type of ticker and calls the callback function.
@@ -39,21 +43,33 @@ public:
 	void m_run() {
 		while (!m_stop) {
 			while (m_running) {
+				if (m_telemetry)
+					m_telemetry->wakeup();
 				run();
 			}
 		}
 	}
 
 	// The 'start' function sets 'm_running' to true causing the thread to call the virtual 'run' function.
-	void start() {
+	virtual void start() {
 		m_running = true;
 	}
 
 	// The 'pause' function sets 'm_running' to false causing the thread to run without calling the virtual 'run' function.
-	void pause() {
+	virtual void pause() {
 		m_running = false;
 	}
 
+	// Sets the telemetry object that records the dispatches and wakeups of the ticker (nullptr to disable). Must be set before the ticker is started.
+	void setTelemetry(TelemetrySink *telemetry) {
+		m_telemetry = telemetry;
+	}
+
+	// Sets the clock the ticker is timed against. Must be set before the ticker is started.
+	virtual void setClock(Clock &clock) {
+		m_clock = &clock;
+	}
+
 	// Retuns whether or not the ticker is running.
 	bool isRunning() {
 		return m_running;
@@ -61,6 +77,8 @@ public:
 
 protected:
 	std::function<void()> m_callback;
+	TelemetrySink *m_telemetry = nullptr;
+	Clock *m_clock = &Clock::system();
 
 private:
 	std::thread m_thread;
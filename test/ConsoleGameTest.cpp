@@ -45,6 +45,7 @@ int main() {
 
 	// Game Loop
 	while (!end_game) {
+		game.update();
 		game.print_board();
 		std::cout << "Whacked: " << game.get_n_whacked() << std::endl;
 		std::cout << "Missed: " << game.get_n_missed() << std::endl;
@@ -1,8 +1,9 @@
 #include "../src/game/game.hpp"
+#include "../src/render/GameRenderer.hpp"
 #include "../src/controllers/NumericalController.hpp"
 #include "../src/controllers/GestureController.hpp"
 #include "../src/ticker/PeriodicTicker.hpp"
-#include "../src/ticker/MusicalTicker.hpp"
+#include "../src/ticker/MusicFile.hpp"
 #include "../src/UI/menu.hpp"
 
 int MAX_FPS = 30;
@@ -74,6 +75,7 @@ int main() {
 		exit(0);
 
 	Game game(3, 3);
+	GameRenderer renderer(game.get_board());
 	game.set_game_over_callback(&game_over_callback);
 
 	sf::Font font;
@@ -144,7 +146,7 @@ int main() {
 		ticker = std::make_unique<PeriodicTicker>(std::get<int>(ticker_params) * 1000, std::bind(&Game::make_mole, &game));
 	else if (ticker_params.index() == 1) {
 		MusicalTickerParams p = std::get<MusicalTickerParams>(ticker_params);
-		ticker = std::make_unique<MusicalTicker>(p.filename, std::bind(&Game::make_mole, &game), p.analysisPeriod, p.lowFreq, p.highFreq, p.threshold, p.ignorePeriod);
+		ticker = loadMusicalTicker(p.filename, std::bind(&Game::make_mole, &game), p.analysisPeriod, p.lowFreq, p.highFreq, p.threshold, p.ignorePeriod, p.latency);
 	}
 
 	fftw_cleanup();
@@ -197,8 +199,10 @@ int main() {
 			textBounds = total.getLocalBounds();
 			total.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 3.5*textBounds.height));
 
+			game.update();
+
 			window.clear();
-			game.render(&window);
+			renderer.render(&window);
 			window.draw(hit);
 			window.draw(missed);
 			window.draw(total);
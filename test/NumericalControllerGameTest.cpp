@@ -1,4 +1,5 @@
 #include "../src/game/game.hpp"
+#include "../src/render/GameRenderer.hpp"
 #include "../src/controllers/NumericalController.hpp"
 #include "../src/ticker/PeriodicTicker.hpp"
 
@@ -14,6 +15,7 @@ int main() {
 	auto windowSize = window.getSize();
 	
 	Game game(3, 3);
+	GameRenderer renderer(game.get_board());
 	game.set_game_over_callback(&game_over_callback);
 	std::unique_ptr<PeriodicTicker> ticker = std::make_unique<PeriodicTicker>(3000, std::bind(&Game::make_mole, &game));
 
@@ -85,8 +87,10 @@ int main() {
 			textBounds = total.getLocalBounds();
 			total.setPosition(sf::Vector2f(windowSize.x - textBounds.width - 10, 3.5*textBounds.height));
 
+			game.update();
+
 			window.clear();
-			game.render(&window);
+			renderer.render(&window);
 			window.draw(hit);
 			window.draw(missed);
 			window.draw(total);
@@ -0,0 +1,69 @@
+/*
+ * Test for the Board free location index
+ */
+
+#include "../src/game/Board.hpp"
+#include "check.hpp"
+#include <random>
+#include <iostream>
+
+int main() {
+	Board board(16, 16);
+	std::mt19937 rd(1);
+	auto now = Clock::system().now();
+
+	// Randomly fill and empty the board, checking the free and occupied locations against the occupancy bits.
+	for (int step = 0; step < 100000; step++) {
+		if (!board.is_full() && (board.get_n_occupied() == 0 || rd() % 2)) {
+			int i = board.get_free(rd() % board.get_n_free());
+			CHECK(!board.is_occupied(i));
+			board.spawn(i, now, now);
+		} else {
+			int i = board.get_occupied(rd() % board.get_n_occupied());
+			CHECK(board.is_occupied(i));
+			board.remove(i);
+		}
+		CHECK(board.count() == board.get_n_occupied());
+
+		// Check the scan of the occupancy bits against the occupied locations every so often.
+		if (step % 1000 == 0) {
+			int n = 0;
+			board.for_each_occupied([&](int i) {
+				CHECK(board.is_occupied(i));
+				n++;
+			});
+			CHECK(n == board.get_n_occupied());
+
+			// The occupancy words must agree with the occupied locations (the renderer diffs them between frames).
+			for (int i = 0; i < board.size(); i++)
+				CHECK((bool)((board.get_occupancy(i / 64) >> (i % 64)) & 1) == board.is_occupied(i));
+		}
+	}
+
+	// A handle to a removed mole must be stale, even after a new mole is spawned at the same location.
+	Board small(2, 2);
+	MoleHandle first = small.spawn(0, now, now);
+	small.remove(0);
+	MoleHandle second = small.spawn(0, now, now);
+	CHECK(!small.is_alive(first) && small.is_alive(second));
+	CHECK(small.get_mole(0).generation == second.generation);
+
+	// The times of the last mole at a location stay readable after it is removed (for animating it out).
+	small.spawn(1, now, now + std::chrono::seconds(1));
+	small.remove(1);
+	CHECK(small.get_spawn_time(1) == now && small.get_deadline(1) == now + std::chrono::seconds(1));
+
+	// Fill the board completely. The default pool holds exactly one mole per location, so every spawn must get a record.
+	while (!board.is_full())
+		CHECK(board.is_alive(board.spawn(board.get_free(0), now, now)));
+	std::cout << "Occupied: " << board.get_n_occupied() << " of " << board.size() << std::endl;
+	CHECK(board.count() == board.size());
+
+	// A smaller pool runs out before the board is full, and the location of the mole it could not create stays empty.
+	Board pooled(2, 2, 3);
+	for (int i = 0; i < 3; i++)
+		CHECK(pooled.is_alive(pooled.spawn(i, now, now)));
+	CHECK(!pooled.is_alive(pooled.spawn(3, now, now)) && !pooled.is_occupied(3));
+
+	return 0;
+}
\ No newline at end of file
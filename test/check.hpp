@@ -0,0 +1,25 @@
+/*
+ * Filename: check.hpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Macro for checking the results of the headless tests.
+ */
+
+#if !defined(CHECK_HPP)
+#define CHECK_HPP
+
+#include <iostream>
+#include <cstdlib>
+
+// Macro checking a condition of a test. If the condition does not hold, it is printed with its location and the test exits with a failure, so that the tests can be run unattended (e.g. by ctest).
+#define CHECK(...) check_condition((__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)
+
+// Function implementing the CHECK macro
+inline void check_condition(bool condition, const char *expression, const char *file, int line) {
+	if (!condition) {
+		std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+		std::exit(1);
+	}
+}
+
+#endif // CHECK_HPP
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+ * Test for ComposedTicker
+ */
+
+#include "../src/ticker/ComposedTicker.hpp"
+#include "check.hpp"
+#include <mutex>
+
+// Store start time of the ticker.
+std::chrono::steady_clock::time_point start_time;
+
+// Store the tick of every callback and the time it was called at, since the start.
+std::vector<std::pair<std::chrono::microseconds, std::chrono::microseconds>> callbacks;
+std::mutex callbacks_mutex;
+
+ComposedTicker *ticker;
+
+void callback() {
+	auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time);
+	std::lock_guard<std::mutex> lock(callbacks_mutex);
+	callbacks.push_back(std::make_pair(ticker->getCurrentTick(), now));
+	std::cout << "Tick at " << std::chrono::duration_cast<std::chrono::milliseconds>(ticker->getCurrentTick()).count() << " ms, called at " << now.count() / 1000 << " ms" << std::endl;
+}
+
+int main() {
+	// Synthetic beats every 250 ms for 2 seconds, then silence.
+	std::vector<std::chrono::microseconds> beats;
+	for (int i = 0; i < 8; i++)
+		beats.push_back(std::chrono::milliseconds(250 * i));
+
+	// Every second beat, plus a ramp from 1 s down to 300 ms, with a floor of one tick every 600 ms.
+	ticker = new ComposedTicker(&callback);
+	ticker->addSource(std::make_unique<BeatSource>(beats, 2));
+	ticker->addSource(std::make_unique<RampSource>(std::chrono::milliseconds(1000), std::chrono::milliseconds(300), std::chrono::seconds(4)));
+	ticker->setFloorPeriod(std::chrono::milliseconds(600));
+	ticker->setMinSpacing(std::chrono::milliseconds(50));
+
+	// Print the precomputed schedule. It must start at the first beat, be in order, keep the minimum spacing and leave no gap longer than the floor period.
+	auto schedule = ticker->schedule(std::chrono::seconds(4));
+	for (auto t : schedule)
+		std::cout << "Scheduled: " << std::chrono::duration_cast<std::chrono::milliseconds>(t).count() << " ms" << std::endl;
+	CHECK(schedule.size() >= 10);
+	CHECK(schedule[0] == beats[0]);
+	for (size_t i = 1; i < schedule.size(); i++) {
+		CHECK(schedule[i] - schedule[i - 1] >= std::chrono::milliseconds(50));
+		CHECK(schedule[i] - schedule[i - 1] <= std::chrono::milliseconds(600));
+	}
+
+	// Every second beat must be in the schedule.
+	for (size_t i = 0; i < beats.size(); i += 2)
+		CHECK(std::find(schedule.begin(), schedule.end(), beats[i]) != schedule.end());
+
+	// Start the ticker and idle until 10 callbacks have been made.
+	start_time = std::chrono::steady_clock::now();
+	ticker->start();
+	while (true) {
+		{
+			std::lock_guard<std::mutex> lock(callbacks_mutex);
+			if (callbacks.size() >= 10)
+				break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+
+	ticker->stop();
+	delete ticker;
+
+	// The callbacks must follow the schedule, and none may be called before its tick.
+	for (size_t i = 0; i < 10; i++) {
+		CHECK(callbacks[i].first == schedule[i]);
+		CHECK(callbacks[i].second >= callbacks[i].first);
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+/*
+ * Test that every header of the headless core compiles on its own include path, without SFML, FFTW or dlib
+ */
+
+#include "../src/clock/Clock.hpp"
+#include "../src/ticker/baseticker.hpp"
+#include "../src/ticker/TickSource.hpp"
+#include "../src/ticker/AudioSource.hpp"
+#include "../src/ticker/AudioClock.hpp"
+#include "../src/ticker/PeriodicTicker.hpp"
+#include "../src/ticker/MusicalTicker.hpp"
+#include "../src/ticker/ComposedTicker.hpp"
+#include "../src/ticker/Scheduler.hpp"
+#include "../src/ticker/ProcessCpuTime.hpp"
+#include "../src/ticker/TelemetrySink.hpp"
+#include "../src/ticker/TickerTelemetry.hpp"
+#include "../src/game/MolePool.hpp"
+#include "../src/game/Board.hpp"
+#include "../src/game/EventQueue.hpp"
+#include "../src/game/ResponseStats.hpp"
+#include "../src/game/Difficulty.hpp"
+#include "../src/game/SpawnPlan.hpp"
+#include "../src/game/game.hpp"
+#include "../src/replay/ReplayLog.hpp"
+#include "../src/replay/Replay.hpp"
+#include "../src/render/FrameProfiler.hpp"
+#include "../src/render/RedrawSignal.hpp"
+
+int main() {
+	return 0;
+}
\ No newline at end of file
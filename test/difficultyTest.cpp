@@ -0,0 +1,55 @@
+/*
+ * Test for the difficulty controller with simulated strong and weak players
+ */
+
+#include "../src/game/Difficulty.hpp"
+#include "check.hpp"
+#include <random>
+#include <iostream>
+
+// Function to feed a number of events from a player with the given hit rate and reaction times around the given mean
+void play(DifficultyController &difficulty, double hit_rate, double mean_ms, int events, std::mt19937 &rd) {
+	std::bernoulli_distribution hit(hit_rate);
+	std::normal_distribution<double> reaction(mean_ms, mean_ms / 4);
+	for (int i = 0; i < events; i++) {
+		if (hit(rd))
+			difficulty.on_hit(std::chrono::microseconds((long long)(1000 * std::max(50.0, reaction(rd)))));
+		else
+			difficulty.on_miss();
+	}
+}
+
+// Function to print the state of the difficulty controller
+void print(std::string name, DifficultyController &difficulty) {
+	std::cout << name << ": level " << difficulty.get_level() << ", hit rate " << difficulty.get_hit_rate() << ", p90 reaction " << difficulty.get_p90_reaction() << " ms, spawn period " << difficulty.get_spawn_period().count() << " ms, lifetime " << difficulty.get_mole_lifetime().count() << " ms" << std::endl;
+}
+
+int main() {
+	std::mt19937 rd(3);
+
+	// A strong player hitting 95% of moles within about 400 ms should be taken to the hardest level, with the lifetime still above their slower reactions
+	DifficultyController strong;
+	play(strong, 0.95, 400, 2000, rd);
+	print("Strong player", strong);
+	CHECK(strong.get_level() >= 0.99);
+	CHECK(strong.get_spawn_period() <= std::chrono::milliseconds(450));
+	CHECK(strong.get_mole_lifetime() >= std::chrono::milliseconds((long long)(1.5 * strong.get_p90_reaction())));
+
+	// A weak player hitting 40% of moles should stay at the easiest level
+	DifficultyController weak;
+	play(weak, 0.4, 1500, 2000, rd);
+	print("Weak player", weak);
+	CHECK(weak.get_level() <= 0.01);
+	CHECK(weak.get_spawn_period() >= std::chrono::milliseconds(1950));
+	CHECK(weak.get_mole_lifetime() >= std::chrono::milliseconds(6900));
+
+	// A player at the target rate should settle between the two, and the estimate of their 90th percentile reaction time should be close to the true value (mean + 1.28 standard deviations)
+	DifficultyController average;
+	play(average, 0.75, 800, 5000, rd);
+	print("Average player", average);
+	double p90 = 800 + 1.2816 * 200;
+	CHECK(average.get_level() > weak.get_level() && average.get_level() < strong.get_level());
+	CHECK(average.get_p90_reaction() >= 0.85 * p90 && average.get_p90_reaction() <= 1.15 * p90);
+
+	return 0;
+}
\ No newline at end of file
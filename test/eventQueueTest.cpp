@@ -0,0 +1,57 @@
+/*
+ * Test for the lock-free event queue with several producer threads and one consumer
+ */
+
+#include "../src/game/EventQueue.hpp"
+#include "check.hpp"
+#include <thread>
+#include <vector>
+#include <iostream>
+
+// Struct for a test item: the producer that pushed it and its sequence number for that producer
+typedef struct {
+	int producer, sequence;
+} Item;
+
+int main() {
+	const int producers = 4, items = 200000;
+	EventQueue<Item> queue(256);
+
+	// Start the producers, retrying while the queue is full.
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; p++) {
+		threads.push_back(std::thread([&queue, p]() {
+			for (int i = 0; i < items; i++)
+				while (!queue.push(Item{p, i}))
+					std::this_thread::yield();
+		}));
+	}
+
+	// Consume every item, checking that the items of each producer arrive in order.
+	std::vector<int> next(producers, 0);
+	int received = 0;
+	Item item;
+	while (received < producers * items) {
+		bool empty = queue.empty();
+		if (!queue.pop(item)) {
+			CHECK(empty);
+			std::this_thread::yield();
+			continue;
+		}
+		CHECK(item.producer >= 0 && item.producer < producers);
+		CHECK(item.sequence == next[item.producer]);
+		next[item.producer] = item.sequence + 1;
+		received++;
+	}
+
+	for (auto &t : threads)
+		t.join();
+
+	// Every item of every producer must have been received, and the queue must be empty afterwards.
+	std::cout << "Received: " << received << " of " << producers * items << std::endl;
+	for (int p = 0; p < producers; p++)
+		CHECK(next[p] == items);
+	CHECK(queue.empty() && !queue.pop(item));
+
+	return 0;
+}
\ No newline at end of file
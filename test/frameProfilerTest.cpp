@@ -0,0 +1,53 @@
+/*
+ * Test for the frame profiler keeping the stages of the render loop apart from the simulation steps
+ */
+
+#include "../src/render/FrameProfiler.hpp"
+#include "check.hpp"
+#include <thread>
+#include <vector>
+
+int main() {
+	FrameProfiler profiler(4);
+	const auto ms = std::chrono::milliseconds(1);
+
+	// An iteration of the render loop that does not draw adds nothing to the next frame.
+	profiler.add(FrameStage::Input, 5 * ms);
+	profiler.skip_frame();
+	profiler.add(FrameStage::Input, 1 * ms);
+	profiler.add(FrameStage::Render, 2 * ms);
+	profiler.add(FrameStage::Present, 3 * ms);
+
+	// Simulation steps from other threads are timed per step and never folded into a frame.
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++)
+		threads.push_back(std::thread([&profiler, t, ms]() {
+			for (int i = 0; i < 1000; i++)
+				profiler.add(FrameStage::Simulation, (i == 500 && t == 2) ? 7 * ms : ms);
+		}));
+	for (auto &t : threads)
+		t.join();
+	profiler.end_frame();
+
+	CHECK(profiler.size() == 1);
+	const FrameRecord &r = profiler.get_frame(0);
+	CHECK(r.stages[(int)FrameStage::Input] == 1000 && r.stages[(int)FrameStage::Render] == 2000 && r.stages[(int)FrameStage::Present] == 3000);
+	CHECK(FrameProfiler::get_total(r) == 6.0);
+
+	StepStats stats = profiler.get_step_stats(FrameStage::Simulation);
+	CHECK(stats.steps == 4000 && stats.total == 4006000 && stats.max == 7000);
+	CHECK(profiler.get_mean(FrameStage::Simulation) > 1.0 && profiler.get_mean(FrameStage::Simulation) < 1.01);
+	CHECK(profiler.get_step_stats(FrameStage::Gesture).steps == 0 && profiler.get_mean(FrameStage::Gesture) == 0);
+
+	// Only the most recent frames are kept, and the mean of a stage of the render loop is taken over them.
+	for (int f = 0; f < 6; f++) {
+		profiler.add(FrameStage::Render, (f + 1) * ms);
+		profiler.end_frame();
+	}
+	CHECK(profiler.size() == 4);
+	CHECK(profiler.get_frame(0).stages[(int)FrameStage::Render] == 3000 && profiler.get_frame(3).stages[(int)FrameStage::Render] == 6000);
+	CHECK(profiler.get_mean(FrameStage::Render) == 4.5 && profiler.get_mean(FrameStage::Input) == 0);
+
+	profiler.print();
+	return 0;
+}
\ No newline at end of file
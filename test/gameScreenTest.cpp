@@ -1,4 +1,5 @@
 #include "../src/game/game.hpp"
+#include "../src/render/GameRenderer.hpp"
 
 bool end_game = false;
 
@@ -12,6 +13,7 @@ int main() {
 	auto windowSize = window.getSize();
 	
 	Game game(3, 3);
+	GameRenderer renderer(game.get_board());
 	game.set_game_over_callback(&game_over_callback);
 
 	game.make_mole();
@@ -30,8 +32,10 @@ int main() {
 					window.close();
 			}
 
+			game.update();
+
 			window.clear();
-			game.render(&window);
+			renderer.render(&window);
 			window.display();
 		}
 	} catch (std::exception e) {
@@ -3,7 +3,7 @@
  */
 
 #include <SFML/Graphics.hpp>
-#include "../src/ticker/MusicalTicker.hpp"
+#include "../src/ticker/MusicFile.hpp"
 #include <iostream>
 
 bool trigger = false;
@@ -17,7 +17,7 @@ void callback() {
 int main() {
 	std::unique_ptr<MusicalTicker> ticker;
 	try {
-		ticker = std::make_unique<MusicalTicker>(MUSIC_FILE, callback, std::chrono::milliseconds(10), 60, 500, 0.7, std::chrono::milliseconds(100));
+		ticker = loadMusicalTicker(MUSIC_FILE, callback, std::chrono::milliseconds(10), 60, 500, 0.7, std::chrono::milliseconds(100));
 	} catch(std::exception e) {
 		std::cout << "Error: " << e.what() << std::endl;
 	}
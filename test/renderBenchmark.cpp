@@ -0,0 +1,120 @@
+/*
+ * Benchmark for rendering the game screen. Draws synthetic board states at several board sizes into an offscreen render target (no window, so it also runs on machines with only software OpenGL), reports the frames per second and the CPU time per frame, and checks that the frames are drawn and that every board size reaches a minimum frame rate (0 to only check the frames). The render target still needs an OpenGL context, which needs an X display on UNIX systems, e.g. run it under xvfb-run -a.
+ *
+ * Usage: renderBenchmark [frames per board size] [minimum frames per second] [width height]
+ */
+
+#include "../src/render/GameRenderer.hpp"
+#include "../src/render/AssetManager.hpp"
+#include "../src/render/Hud.hpp"
+#include "../src/render/FrameProfiler.hpp"
+#include "../src/ticker/ProcessCpuTime.hpp"
+#include "../src/clock/Clock.hpp"
+#include "check.hpp"
+#include <random>
+#include <string>
+
+// Time between two frames at 60 Hz
+const std::chrono::microseconds FRAME_PERIOD(16667);
+
+// Time a synthetic mole stays up if it is not whacked
+const std::chrono::milliseconds MOLE_LIFETIME(1500);
+
+// Renders the given number of frames of a board of the given size, prints the report and returns the frames per second
+double benchmark(int width, int height, int frames, sf::RenderTexture &target, sf::Font &font) {
+	ManualClock clock;
+	Board board(width, height);
+	GameRenderer renderer(board, clock);
+	Hud hud(font);
+	hud.set_area(sf::FloatRect(0, 0, (float)target.getSize().x, (float)target.getSize().y));
+	FrameProfiler profiler(frames);
+	std::mt19937 rd(0);
+	int hit = 0, missed = 0, total = 0;
+
+	// Synthetic frame: moles whose deadline passed expire, a few random moles are whacked and new moles are spawned until half the board is up
+	auto step = [&]() {
+		clock.advance(FRAME_PERIOD);
+		auto now = clock.now();
+		for (int k = board.get_n_occupied() - 1; k >= 0; k--) {
+			int i = board.get_occupied(k);
+			if (board.get_deadline(i) <= now) {
+				board.remove(i);
+				missed++;
+			}
+			else if (rd() % 32 == 0) {
+				board.remove(i);
+				hit++;
+			}
+		}
+		while (board.get_n_occupied() < board.size() / 2 && !board.is_full()) {
+			board.spawn(board.get_free(rd() % board.get_n_free()), now, now + MOLE_LIFETIME);
+			total++;
+		}
+		hud.update(hit, missed, total, hit ? 400.0 + hit % 100 : 0);
+	};
+
+	auto draw = [&]() {
+		target.clear();
+		renderer.render(&target);
+		hud.draw(target);
+	};
+
+	// Warm up (first uploads, glyphs and vertex array sizing), then measure
+	for (int f = 0; f < 10; f++) {
+		step();
+		draw();
+		target.display();
+	}
+
+	auto startTime = std::chrono::steady_clock::now();
+	auto startCpu = processCpuTime();
+	for (int f = 0; f < frames; f++) {
+		step();
+		{
+			FrameProfiler::Scope scope(profiler, FrameStage::Render);
+			draw();
+		}
+		{
+			FrameProfiler::Scope scope(profiler, FrameStage::Present);
+			target.display();
+		}
+		profiler.end_frame();
+	}
+	// Read the target back so that the frames queued in the driver are finished before the clock stops
+	sf::Image image = target.getTexture().copyToImage();
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	auto cpu = std::chrono::duration<double, std::milli>(processCpuTime() - startCpu).count();
+
+	std::cout << "Board " << width << "x" << height << ": " << frames / elapsed << " frames per second, " << cpu / frames << " ms CPU time per frame" << std::endl;
+	std::cout << "    ";
+	profiler.print();
+
+	// Every frame was profiled, the synthetic game was played, and the last frame is not blank (the board covers pixels that the clear colour does not)
+	CHECK(profiler.size() == (size_t)frames);
+	CHECK(total > 0 && hit > 0 && hit + missed + board.get_n_occupied() == total);
+	bool drawn = false;
+	for (unsigned y = 0; y < image.getSize().y && !drawn; y += 7)
+		for (unsigned x = 0; x < image.getSize().x && !drawn; x += 7)
+			drawn = image.getPixel(x, y) != sf::Color::Black;
+	CHECK(drawn);
+	return frames / elapsed;
+}
+
+int main(int argc, char **argv) {
+	int frames = (argc > 1) ? std::stoi(argv[1]) : 600;
+	double min_fps = (argc > 2) ? std::stod(argv[2]) : 30;
+	sf::Vector2u size = (argc > 4) ? sf::Vector2u(std::stoi(argv[3]), std::stoi(argv[4])) : sf::Vector2u(1920, 1080);
+
+	AssetManager assets({ 24 });
+	sf::RenderTexture target;
+	if (!target.create(size.x, size.y)) {
+		std::cout << "Could not create an offscreen render target" << std::endl;
+		return 1;
+	}
+
+	std::cout << "Rendering " << frames << " frames per board size at " << size.x << "x" << size.y << std::endl;
+	for (int side : { 3, 8, 16, 32 })
+		CHECK(benchmark(side, side, frames, target, assets.get_font()) >= min_fps);
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+ * Test for recording a game session to a replay log and replaying it headlessly
+ */
+
+#include "../src/replay/Replay.hpp"
+#include "check.hpp"
+#include <random>
+#include <cstdio>
+#include <iostream>
+
+int main() {
+	const std::string path = "replayTest.mmr";
+
+	// Record a simulated 10 minute session on a manual clock, stepping the simulation every 4 ms, with the difficulty adapting the spawn period and mole lifetime
+	{
+		ManualClock clock;
+		Game game(4, 4, clock);
+		game.set_game_over_callback([]() {});
+		DifficultyController difficulty;
+		game.set_difficulty(&difficulty);
+		ReplayWriter recorder(path, game.get_replay_header(), clock, 64);
+		game.set_recorder(&recorder);
+
+		// Seeded random player that whacks a random location now and then, with the input taking a few milliseconds to be applied
+		std::mt19937 rd(7);
+		std::bernoulli_distribution press(0.004);
+		std::uniform_int_distribution<int> loc(1, 4), delay(0, 3);
+
+		auto start = clock.now();
+		auto next_spawn = start;
+		while (clock.now() - start < std::chrono::minutes(10)) {
+			if (clock.now() >= next_spawn) {
+				game.make_mole_paced();
+				next_spawn += std::chrono::milliseconds(100);
+			}
+			if (press(rd)) {
+				auto &board = game.get_board();
+				int x = loc(rd), y = loc(rd);
+				// Mostly aim for moles so that there are hits
+				for (int i = 0; i < board.size(); i++)
+					if (board.is_occupied(i) && rd() % 2) {
+						x = i % 4 + 1;
+						y = i / 4 + 1;
+						break;
+					}
+				game.whack_at(x - 1, y - 1, clock.now() - std::chrono::milliseconds(delay(rd)));
+			}
+			game.update();
+			clock.advance(std::chrono::milliseconds(4));
+		}
+
+		recorder.finish(game.get_replay_footer());
+		std::cout << "Recorded: " << game.get_n_whacked() << " whacked, " << game.get_n_missed() << " missed, " << game.get_n_total() << " total, average " << game.get_avg_whack_time() << " ms" << std::endl;
+		std::cout << "Final difficulty level " << difficulty.get_level() << ", spawn period " << difficulty.get_spawn_period().count() << " ms, lifetime " << difficulty.get_mole_lifetime().count() << " ms" << std::endl;
+	}
+
+	// Replay the session as fast as possible
+	auto real = std::chrono::steady_clock::now();
+	ReplayResult r = replay_session(path);
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - real).count();
+
+	std::cout << "Replayed " << r.n_records << " records in " << elapsed << " ms: " << r.replayed.n_whacked << " whacked, " << r.replayed.n_missed << " missed, " << r.replayed.n_total << " total, average " << r.stats.get_mean() << " ms" << std::endl;
+	CHECK(r.valid && r.complete);
+	CHECK(r.recorded.n_total > 0 && r.recorded.n_whacked > 0 && r.recorded.n_missed > 0);
+	CHECK(replay_matches(r));
+
+	// A whack just before the deadline of a mole is a hit in the replay too, even when the times are not whole microseconds apart
+	{
+		ManualClock clock;
+		Game game(4, 4, clock);
+		game.set_game_over_callback([]() {});
+		game.set_mole_lifetime(std::chrono::milliseconds(500));
+		ReplayWriter recorder(path, game.get_replay_header(), clock);
+		game.set_recorder(&recorder);
+		clock.advance(std::chrono::nanoseconds(300));
+		game.make_mole_at(1, 2);
+		game.update();
+		game.whack_at(1, 2, clock.now() + std::chrono::milliseconds(500) - std::chrono::nanoseconds(100));
+		clock.advance(std::chrono::milliseconds(500));
+		game.update();
+		CHECK(game.get_n_whacked() == 1);
+		recorder.finish(game.get_replay_footer());
+		game.stop();
+	}
+	r = replay_session(path);
+	CHECK(replay_matches(r) && r.replayed.n_whacked == 1);
+
+	// A whack applied in the same update as a later spawn hits a mole whose deadline has passed by the update, since the update applies its events before removing the mole. The replay removes the mole only at the recorded update too.
+	{
+		ManualClock clock;
+		Game game(4, 4, clock);
+		game.set_game_over_callback([]() {});
+		game.set_mole_lifetime(std::chrono::milliseconds(500));
+		ReplayWriter recorder(path, game.get_replay_header(), clock);
+		game.set_recorder(&recorder);
+		game.make_mole_at(0, 0);
+		game.update();
+		auto input = clock.now() + std::chrono::milliseconds(499);
+		clock.advance(std::chrono::milliseconds(600));
+		game.make_mole_at(3, 3);
+		game.whack_at(0, 0, input);
+		game.update();
+		CHECK(game.get_n_whacked() == 1 && game.get_n_missed() == 0 && game.get_n_total() == 2);
+		recorder.finish(game.get_replay_footer());
+		game.stop();
+	}
+	r = replay_session(path);
+	CHECK(replay_matches(r) && r.replayed.n_whacked == 1 && r.replayed.n_missed == 0);
+
+	// A whack from before the start of the log keeps its negative time, and whacks and spawns that are not on the board are neither applied nor recorded
+	{
+		ManualClock clock;
+		Game game(4, 4, clock);
+		game.set_game_over_callback([]() {});
+		ReplayWriter recorder(path, game.get_replay_header(), clock);
+		game.set_recorder(&recorder);
+		game.whack_at(0, 0, clock.now() - std::chrono::milliseconds(5));
+		game.whack_at(-1, 0, clock.now());
+		game.whack_at(0, 4, clock.now());
+		game.make_mole_at(4, 0);
+		game.make_mole_at(0, -1);
+		game.update();
+		CHECK(game.get_n_total() == 0 && game.get_board().count() == 0);
+		recorder.finish(game.get_replay_footer());
+		game.stop();
+	}
+	{
+		ReplayReader reader(path);
+		ReplayRecord record;
+		CHECK(reader.next(record));
+		CHECK(record.type == ReplayEventType::Whack && record.time == -5000000);
+		CHECK(reader.next(record) && record.type == ReplayEventType::Update && record.time == 0);
+		CHECK(!reader.next(record) && reader.has_footer() && !reader.is_corrupt());
+	}
+
+	// A header with a board size that is not positive, or with a side too long for the locations in a record, is rejected
+	for (int width : { 0, -3, 70000 }) {
+		ReplayWriter(path, ReplayHeader{width, 4, 1000, 0, 0}).finish(ReplayFooter{});
+		CHECK(!ReplayReader(path).is_valid());
+		CHECK(!replay_session(path).valid);
+	}
+
+	// A record with a location that is not on the board makes the log corrupt instead of reaching the game
+	{
+		ManualClock clock;
+		ReplayWriter recorder(path, ReplayHeader{4, 4, 1000000000, 0, 0}, clock);
+		recorder.record(ReplayEventType::Spawn, 1, 1, clock.now());
+		recorder.record(ReplayEventType::Whack, 9, 1, clock.now());
+		recorder.finish(ReplayFooter{0, 0, 1});
+	}
+	{
+		ReplayReader reader(path);
+		ReplayRecord record;
+		CHECK(reader.is_valid() && reader.next(record) && !reader.next(record));
+		CHECK(reader.is_corrupt() && !reader.has_footer());
+	}
+	r = replay_session(path);
+	CHECK(!r.valid && !replay_matches(r));
+	std::remove(path.c_str());
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+/*
+ * Test for the streaming response time statistics against exact values
+ */
+
+#include "../src/game/ResponseStats.hpp"
+#include "check.hpp"
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+int main() {
+	ResponseStats stats;
+	std::vector<double> samples;
+	std::mt19937 rd(1);
+	// Response times are skewed like real reaction times, so use a log-normal distribution around 400ms
+	std::lognormal_distribution<double> dist(std::log(400.0), 0.5);
+
+	for (int i = 0; i < 100000; i++) {
+		double x = dist(rd);
+		stats.add(x);
+		samples.push_back(x);
+	}
+
+	// Compute the exact statistics from the stored samples
+	double sum = 0;
+	for (auto x : samples)
+		sum += x;
+	double mean = sum / samples.size();
+	double m2 = 0;
+	for (auto x : samples)
+		m2 += (x - mean) * (x - mean);
+	double stddev = std::sqrt(m2 / (samples.size() - 1));
+	std::sort(samples.begin(), samples.end());
+	auto exact = [&](double p) { return samples[(size_t)(p * (samples.size() - 1))]; };
+
+	std::cout << "Mean: " << stats.get_mean() << " (exact " << mean << ")" << std::endl;
+	std::cout << "Standard deviation: " << stats.get_stddev() << " (exact " << stddev << ")" << std::endl;
+	std::cout << "p50: " << stats.get_p50() << " (exact " << exact(0.5) << ")" << std::endl;
+	std::cout << "p90: " << stats.get_p90() << " (exact " << exact(0.9) << ")" << std::endl;
+	std::cout << "p99: " << stats.get_p99() << " (exact " << exact(0.99) << ")" << std::endl;
+
+	// Check the estimates, allowing the percentiles a relative error of 2%.
+	auto close = [](double a, double b, double tolerance) { return std::abs(a - b) <= tolerance * std::abs(b); };
+	CHECK(close(stats.get_mean(), mean, 1e-9) && close(stats.get_stddev(), stddev, 1e-9));
+	CHECK(stats.get_min() == samples.front() && stats.get_max() == samples.back());
+	CHECK(close(stats.get_p50(), exact(0.5), 0.02));
+	CHECK(close(stats.get_p90(), exact(0.9), 0.02));
+	CHECK(close(stats.get_p99(), exact(0.99), 0.02));
+
+	// With five samples or fewer the percentiles are exact, whatever order the samples arrive in.
+	ResponseStats few;
+	double values[5] = { 500, 100, 400, 200, 300 };
+	for (int i = 0; i < 5; i++) {
+		few.add(values[i]);
+		std::vector<double> sorted(values, values + i + 1);
+		std::sort(sorted.begin(), sorted.end());
+		CHECK(few.get_p50() == sorted[(size_t)std::lround(0.5 * i)]);
+		CHECK(few.get_p99() == sorted[(size_t)std::lround(0.99 * i)]);
+	}
+
+	return 0;
+}
\ No newline at end of file
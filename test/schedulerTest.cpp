@@ -0,0 +1,98 @@
+/*
+ * Test for the shared scheduler running many periodic tasks on a small pool of workers
+ */
+
+#include "../src/ticker/Scheduler.hpp"
+#include "../src/clock/Clock.hpp"
+#include "check.hpp"
+#include <atomic>
+#include <iostream>
+
+int main() {
+	const int tasks = 8;
+	const auto period = std::chrono::milliseconds(5);
+	const auto duration = std::chrono::milliseconds(500);
+	const auto stall = std::chrono::milliseconds(100);
+
+	// Count the runs of every task, and check that no task is ever run by two workers at once.
+	std::atomic<int> runs[tasks], running[tasks];
+	for (int i = 0; i < tasks; i++) {
+		runs[i] = 0;
+		running[i] = 0;
+	}
+
+	{
+		Scheduler scheduler(2);
+		for (int i = 0; i < tasks; i++) {
+			scheduler.every(period, [&, i]() {
+				CHECK(running[i]++ == 0);
+				// The first task stalls once, e.g. like a step blocked on I/O
+				if (i == 0 && runs[i] == 10)
+					std::this_thread::sleep_for(stall);
+				runs[i]++;
+				running[i]--;
+			});
+		}
+		std::this_thread::sleep_for(duration);
+		scheduler.stop();
+	}
+
+	// Every task should have run about once per period. The stalled task must skip the periods it missed instead of catching up on them.
+	int expected = (int)(duration / period);
+	for (int i = 0; i < tasks; i++) {
+		int n = (i == 0) ? (int)((duration - stall) / period) : expected;
+		std::cout << "Task " << i << ": " << runs[i] << " runs (expected about " << n << ")" << std::endl;
+		CHECK(runs[i] >= n * 9 / 10 && runs[i] <= n + 3);
+	}
+
+	// A task added paused is not run until it is resumed, and a task that pauses itself is not run again until it is resumed.
+	{
+		Scheduler scheduler(1);
+		std::atomic<int> idle(0), paused(0);
+		size_t task = 0;
+		size_t first = scheduler.every(period, [&]() { idle++; }, true);
+		task = scheduler.every(period, [&]() {
+			if (++paused % 5 == 0)
+				scheduler.pause(task);
+		}, true);
+		scheduler.resume(task);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		CHECK(idle == 0 && paused == 5);
+		scheduler.resume(task);
+		scheduler.resume(first);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		CHECK(idle > 0 && paused == 10);
+		scheduler.stop();
+	}
+
+	// On a manual clock, a task is run only when the clock is advanced to its due time, and a task that falls behind skips the periods it missed.
+	{
+		ManualClock clock;
+		Scheduler scheduler(1, clock);
+		std::atomic<int> manual(0);
+		scheduler.every(std::chrono::milliseconds(10), [&]() { manual++; });
+		// Waits (in real time) for the worker to run the task the given number of times
+		auto wait = [&](int n) {
+			auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (manual < n && std::chrono::steady_clock::now() < limit)
+				std::this_thread::yield();
+			// Give the worker time to run the task again, if it wrongly would
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			CHECK(manual == n);
+		};
+		wait(1);
+		for (int i = 1; i <= 20; i++) {
+			clock.advance(std::chrono::milliseconds(10));
+			wait(1 + i);
+		}
+		clock.advance(std::chrono::milliseconds(35));
+		wait(22);
+		clock.advance(std::chrono::milliseconds(4));
+		wait(22);
+		clock.advance(std::chrono::milliseconds(1));
+		wait(23);
+		scheduler.stop();
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * Simulates a whole game session with a periodic ticker, random whacks and mole expiries on a manual clock, far faster than real time.
+ */
+
+#include "../src/game/game.hpp"
+#include "../src/ticker/PeriodicTicker.hpp"
+#include "check.hpp"
+#include <atomic>
+#include <algorithm>
+
+bool end_game = false;
+
+void game_over_callback() {
+	end_game = true;
+	std::cout << "Game over!" << std::endl;
+}
+
+int main() {
+	// Play the session on a manual clock, which only advances when the test advances it. The session runs as fast as the machine allows (far more than 1000 times real time) and every spawn and whack happens at the same game time on every run, however the threads are scheduled.
+	ManualClock clock;
+
+	Game game(3, 3, clock);
+	game.set_game_over_callback(&game_over_callback);
+
+	// Spawn a mole every 800 ms of game time, counting the ticks so that the test can wait for the ticker thread
+	std::atomic<long long> ticks(0);
+	PeriodicTicker ticker(800, [&game, &ticks]() {
+		game.make_mole();
+		ticks++;
+	});
+	ticker.setClock(clock);
+
+	// Seeded random whacks so that the player behaviour is repeatable
+	std::mt19937 rd(42);
+	std::bernoulli_distribution hit(0.3);
+
+	auto start = clock.now();
+	auto realStart = std::chrono::steady_clock::now();
+	ticker.start();
+
+	// Simulate 10 minutes of game time in steps of 100 ms, trying to whack every mole once per step. After every step, wait for the ticker to have fired every tick that is due, so that the update applies exactly the spawns up to the current game time.
+	while (!end_game && clock.now() - start < std::chrono::minutes(10)) {
+		while (ticks < (clock.now() - start) / std::chrono::milliseconds(800) + 1)
+			std::this_thread::yield();
+		game.update();
+		auto &board = game.get_board();
+		for (int i = 0; i < game.get_x(); i++)
+			for (int j = 0; j < game.get_y(); j++)
+				if (board.is_occupied(i, j) && hit(rd))
+					game.whack(i + 1, j + 1);
+		clock.advance(std::chrono::milliseconds(100));
+	}
+
+	// Apply the spawn of the last tick that was due, then stop
+	while (ticks < (clock.now() - start) / std::chrono::milliseconds(800) + 1)
+		std::this_thread::yield();
+	ticker.stop();
+	game.update();
+	game.stop();
+
+	auto real = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - realStart).count();
+	auto simulated = std::chrono::duration_cast<std::chrono::seconds>(clock.now() - start).count();
+
+	std::cout << "Simulated " << simulated << " s in " << real << " ms (" << simulated * 1000.0 / std::max<long long>(real, 1) << "x real time)" << std::endl;
+	std::cout << "Whacked: " << game.get_n_whacked() << std::endl;
+	std::cout << "Missed: " << game.get_n_missed() << std::endl;
+	std::cout << "Total: " << game.get_n_total() << std::endl;
+	std::cout << "Average Whack Time: " << game.get_avg_whack_time() << " ms" << std::endl;
+	auto stats = game.get_whack_stats();
+	std::cout << "Whack Time p50/p90/p99: " << stats.get_p50() << " / " << stats.get_p90() << " / " << stats.get_p99() << " ms" << std::endl;
+
+	// The whole session must have been played, with a mole spawned at the start and every 800 ms after it, and no events dropped
+	CHECK(!end_game && simulated == 600);
+	CHECK(ticks == 751 && game.get_n_total() == 751);
+	CHECK(game.get_n_dropped() == 0);
+
+	// Trying every mole 10 times per second of game time with a 30% hit chance, a mole survives its lifetime of 7 seconds with a chance of 0.7^70, so none may be missed
+	CHECK(game.get_n_missed() == 0);
+
+	// Every mole is either whacked, missed or still on the board, and every response time is within the lifetime
+	CHECK(game.get_n_whacked() + game.get_n_missed() + game.get_board().count() == game.get_n_total());
+	CHECK(stats.get_min() >= 0 && stats.get_max() <= std::chrono::duration<double, std::milli>(game.get_mole_lifetime()).count());
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+/*
+ * Test for SpawnPlan
+ */
+
+#include "../src/game/SpawnPlan.hpp"
+#include "../src/game/game.hpp"
+#include "check.hpp"
+#include <iostream>
+
+int main() {
+	// Create synthetic beat times every 500 ms.
+	std::vector<std::chrono::microseconds> beats;
+	for (int i = 0; i < 20; i++)
+		beats.push_back(std::chrono::milliseconds(500 * i));
+
+	// Create two plans with the same seed and one with a different seed.
+	SpawnPlan a(beats, 3, 3, 42), b(beats, 3, 3, 42), c(beats, 3, 3, 43);
+	CHECK(a.size() == beats.size() && b.size() == a.size() && c.size() == a.size());
+
+	// Print the plan. Plans with the same seed must be identical, and every spawn must be on the board.
+	bool different = false;
+	for (size_t i = 0; i < a.size(); i++) {
+		auto sa = a.get_spawns()[i], sb = b.get_spawns()[i], sc = c.get_spawns()[i];
+		std::cout << sa.time.count() << " us: (" << sa.x << ", " << sa.y << ")" << std::endl;
+		CHECK(sa.time == beats[i]);
+		CHECK(sa.time == sb.time && sa.x == sb.x && sa.y == sb.y);
+		CHECK(sa.x >= 0 && sa.x < 3 && sa.y >= 0 && sa.y < 3);
+		if (sa.x != sc.x || sa.y != sc.y)
+			different = true;
+	}
+
+	// A different seed must change the plan.
+	CHECK(different);
+
+	// A game following the plan spawns the beats as they come. After a stall, the beats missed by more than the maximum lateness are skipped instead of spawned in one burst.
+	ManualClock clock;
+	Game game(3, 3, clock);
+	game.set_game_over_callback([]() {});
+	game.set_spawn_plan(a);
+	game.advance_plan(std::chrono::milliseconds(0));
+	game.advance_plan(std::chrono::milliseconds(520));
+	game.update();
+	CHECK(game.get_n_total() == 2);
+	game.advance_plan(std::chrono::milliseconds(9030));
+	game.update();
+	CHECK(game.get_n_total() == 3 && game.get_board().count() == 3);
+	game.stop();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+/*
+ * Benchmark for the timing of the tickers. Drives each ticker headlessly (the MusicalTicker plays a synthetic audio source instead of music) and reports the jitter between scheduled and actual dispatch, the CPU usage and the wakeups per second.
+ *
+ * Usage: tickerBenchmark [seconds per ticker] [maximum p99 jitter in us]
+ */
+
+#include "../src/ticker/PeriodicTicker.hpp"
+#include "../src/ticker/MusicalTicker.hpp"
+#include "../src/ticker/TickerTelemetry.hpp"
+#include "check.hpp"
+#include <string>
+
+// Fake audio source whose playing offset only advances once per audio buffer, like sf::Music (1024 samples at 44.1 kHz)
+class FakeAudio : public AudioSource {
+public:
+	FakeAudio(std::chrono::microseconds duration) : duration(duration) {}
+
+	void play() {
+		start = std::chrono::steady_clock::now();
+		playing = true;
+	}
+
+	void pause() {
+		playing = false;
+	}
+
+	void stop() {
+		playing = false;
+	}
+
+	bool isStopped() {
+		return !playing || getPlayingOffset() >= duration;
+	}
+
+	std::chrono::microseconds getPlayingOffset() {
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+		return (elapsed / bufferPeriod) * bufferPeriod;
+	}
+
+	std::chrono::microseconds getDuration() {
+		return duration;
+	}
+
+private:
+	std::chrono::microseconds duration;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	bool playing = false;
+	const std::chrono::microseconds bufferPeriod = std::chrono::microseconds(23220);
+};
+
+// Maximum 99th percentile jitter accepted, and maximum wakeups per second (a spinning ticker thread wakes far more often)
+std::chrono::microseconds maxJitter(5000);
+const double maxWakeupsPerSecond = 1000;
+
+// Runs a ticker for the given duration with telemetry attached, prints the report and checks it against the expected period between ticks
+void benchmark(std::string name, BaseTicker &ticker, TickerTelemetry &telemetry, std::chrono::seconds duration, std::chrono::microseconds period) {
+	ticker.setTelemetry(&telemetry);
+	telemetry.begin();
+	ticker.start();
+	std::this_thread::sleep_for(duration);
+	ticker.stop();
+	telemetry.print(name);
+
+	// Every tick must have been dispatched, on time and without busy waiting
+	auto r = telemetry.report();
+	auto expected = (size_t)(duration / period);
+	CHECK(r.n + 2 >= expected && r.n <= expected + 2);
+	CHECK(r.p99 <= maxJitter);
+	CHECK(r.wakeupsPerSecond <= maxWakeupsPerSecond);
+}
+
+void callback() {}
+
+int main(int argc, char **argv) {
+	std::chrono::seconds duration(argc > 1 ? std::stoi(argv[1]) : 10);
+	if (argc > 2)
+		maxJitter = std::chrono::microseconds(std::stoi(argv[2]));
+
+	// Synthetic beat map at 128 BPM
+	std::vector<std::chrono::microseconds> beats;
+	for (std::chrono::microseconds t(0); t < duration + std::chrono::seconds(1); t += std::chrono::microseconds(468750))
+		beats.push_back(t);
+
+	{
+		TickerTelemetry telemetry;
+		PeriodicTicker ticker(100, &callback);
+		benchmark("PeriodicTicker (100 ms)", ticker, telemetry, duration, std::chrono::milliseconds(100));
+	}
+
+	{
+		TickerTelemetry telemetry;
+		ComposedTicker ticker(&callback);
+		ticker.addSource(std::make_unique<PeriodicSource>(std::chrono::milliseconds(100)));
+		benchmark("ComposedTicker (100 ms periodic)", ticker, telemetry, duration, std::chrono::milliseconds(100));
+	}
+
+	{
+		TickerTelemetry telemetry;
+		MusicalTicker ticker(std::make_unique<FakeAudio>(duration + std::chrono::seconds(1)), beats, &callback);
+		benchmark("MusicalTicker (128 BPM, fake audio source)", ticker, telemetry, duration, std::chrono::microseconds(468750));
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*
+ * Filename: atlasgen.cpp
+ * Author: Malolan Venkataraghavan
+ *
+ * Build step that scales the mole and hole art down to the size they are displayed at, packs them into one texture atlas and writes it as a header of raw RGBA pixels.
+ * Usage: atlasgen <mole.png> <hole.png> <sprite size> <output.hpp>
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <SFML/Graphics.hpp>
+
+// Gap in pixels between the sprites in the atlas, so that the smaller mipmap levels of one sprite do not blend in its neighbour
+const unsigned PAD = 8;
+// Side of the block of the background colour, of which only the middle is sampled
+const unsigned FILL_SIZE = 16;
+// Background colour (brown, opaque)
+const uint8_t FILL_COLOR[4] = { 0xA6, 0x7C, 0x52, 0xFF };
+
+// Struct for an image of RGBA pixels
+typedef struct {
+	unsigned width, height;
+	std::vector<uint8_t> pixels;
+} Bitmap;
+
+// Function to scale an image down to size x size by averaging the source pixels covered by every destination pixel. The colours are weighted by alpha, so that transparent pixels do not darken the edges of the sprite.
+Bitmap downscale(const sf::Image &image, unsigned size) {
+	auto src = image.getSize();
+	const uint8_t *in = image.getPixelsPtr();
+	Bitmap out = Bitmap{size, size, std::vector<uint8_t>(4 * size * size)};
+
+	for (unsigned dy = 0; dy < size; dy++) {
+		unsigned y0 = dy * src.y / size, y1 = std::max(y0 + 1, (dy + 1) * src.y / size);
+		for (unsigned dx = 0; dx < size; dx++) {
+			unsigned x0 = dx * src.x / size, x1 = std::max(x0 + 1, (dx + 1) * src.x / size);
+			double r = 0, g = 0, b = 0, a = 0;
+			for (unsigned y = y0; y < y1; y++) {
+				for (unsigned x = x0; x < x1; x++) {
+					const uint8_t *p = in + 4 * ((size_t)y * src.x + x);
+					r += p[0] * p[3];
+					g += p[1] * p[3];
+					b += p[2] * p[3];
+					a += p[3];
+				}
+			}
+			uint8_t *q = &out.pixels[4 * ((size_t)dy * size + dx)];
+			unsigned n = (x1 - x0) * (y1 - y0);
+			q[0] = a > 0 ? (uint8_t)(r / a + 0.5) : 0;
+			q[1] = a > 0 ? (uint8_t)(g / a + 0.5) : 0;
+			q[2] = a > 0 ? (uint8_t)(b / a + 0.5) : 0;
+			q[3] = (uint8_t)(a / n + 0.5);
+		}
+	}
+	return out;
+}
+
+// Function to copy an image into a larger one at x and y
+void blit(Bitmap &dst, const Bitmap &src, unsigned x, unsigned y) {
+	for (unsigned j = 0; j < src.height; j++)
+		std::copy_n(&src.pixels[4 * (size_t)j * src.width], 4 * src.width, &dst.pixels[4 * ((size_t)(y + j) * dst.width + x)]);
+}
+
+// Function to write a region of the atlas as an array of x, y, width and height
+void write_region(std::ostream &out, const std::string &name, unsigned x, unsigned y, unsigned w, unsigned h) {
+	out << "const unsigned int GameAtlas_" << name << "[4] = { " << x << ", " << y << ", " << w << ", " << h << " };\n";
+}
+
+int main(int argc, char **argv) {
+	if (argc != 5) {
+		std::cerr << "Usage: atlasgen <mole.png> <hole.png> <sprite size> <output.hpp>" << std::endl;
+		return 1;
+	}
+
+	sf::Image mole, hole;
+	if (!mole.loadFromFile(argv[1]) || !hole.loadFromFile(argv[2])) {
+		std::cerr << "atlasgen: could not load the sprites" << std::endl;
+		return 1;
+	}
+	unsigned size = (unsigned)std::stoul(argv[3]);
+
+	// Pack the scaled mole and hole and the block of the background colour side by side
+	Bitmap atlas = Bitmap{2 * size + 2 * PAD + FILL_SIZE, std::max(size, FILL_SIZE), {}};
+	atlas.pixels.assign(4 * (size_t)atlas.width * atlas.height, 0);
+	blit(atlas, downscale(mole, size), 0, 0);
+	blit(atlas, downscale(hole, size), size + PAD, 0);
+	Bitmap fill = Bitmap{FILL_SIZE, FILL_SIZE, std::vector<uint8_t>(4 * FILL_SIZE * FILL_SIZE)};
+	for (size_t i = 0; i < fill.pixels.size(); i++)
+		fill.pixels[i] = FILL_COLOR[i % 4];
+	blit(atlas, fill, 2 * size + 2 * PAD, 0);
+
+	std::ofstream out(argv[4]);
+	out << "/*\n * Filename: GameAtlas.hpp\n *\n * Texture atlas of the mole, the hole and the background colour as raw RGBA pixels. Generated by atlasgen at build time, do not edit.\n */\n\n";
+	out << "#if !defined(GAMEATLAS_HPP)\n#define GAMEATLAS_HPP\n\n";
+	out << "const unsigned int GameAtlas_width = " << atlas.width << ";\n";
+	out << "const unsigned int GameAtlas_height = " << atlas.height << ";\n\n";
+	out << "// Regions of the mole, the hole and the background colour in the atlas: x, y, width and height\n";
+	write_region(out, "mole", 0, 0, size, size);
+	write_region(out, "hole", size + PAD, 0, size, size);
+	write_region(out, "fill", 2 * size + 2 * PAD + FILL_SIZE / 4, FILL_SIZE / 4, FILL_SIZE / 2, FILL_SIZE / 2);
+	out << "\nconst unsigned char GameAtlas_rgba[] = {";
+	char hex[8];
+	for (size_t i = 0; i < atlas.pixels.size(); i++) {
+		std::snprintf(hex, sizeof(hex), "0x%02x", atlas.pixels[i]);
+		out << (i % 12 == 0 ? "\n  " : " ") << hex << (i + 1 < atlas.pixels.size() ? "," : "");
+	}
+	out << "\n};\n\n#endif // GAMEATLAS_HPP\n";
+
+	if (!out) {
+		std::cerr << "atlasgen: could not write " << argv[4] << std::endl;
+		return 1;
+	}
+	return 0;
+}
\ No newline at end of file